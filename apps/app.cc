@@ -1,51 +1,181 @@
-#include <chrono>   // std::chrono::high_resolution_clock, std::chrono::duration_cast
-#include <stdlib.h> // EXIT_SUCCESS, EXIT_FAILURE
-#include <vector>   // std::vector
+#include <chrono>      // std::chrono::high_resolution_clock, std::chrono::duration_cast
+#include <cstdint>     // std::uint64_t
+#include <optional>    // std::optional
+#include <random>      // std::random_device
+#include <stdlib.h>    // EXIT_SUCCESS, EXIT_FAILURE
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <utility>     // std::to_underlying
+#include <vector>      // std::vector
 
 #include "fmt/core.h"
-#include "raylib.h" // InitWindow, SetTargetFPS,
+#include "raylib.h" // InitWindow, SetTargetFPS, EnableEventWaiting, SetConfigFlags, TraceLog
 
-#include "gui/screenlib.hpp" // ScreenManager
+#include "gui/screenlib.hpp"           // ScreenManager, FramePacing, GameScreenState
+#include "search/bidirectionallib.hpp" // search::Algorithm
+#include "utils/randomlib.hpp"         // ParseSeed
 
 #define TARGET_FPS 60
+#define REDUCED_FPS 30
 
-int main(void)
+/// @brief Applies the frame pacing to the main loop
+/// @param pacing The frame pacing
+static void ApplyFramePacing(FramePacing pacing)
+{
+    if (pacing == FramePacing::EVENT_DRIVEN)
+    {
+        // Block in EndDrawing() until there is an input event
+        EnableEventWaiting();
+        SetTargetFPS(TARGET_FPS);
+    }
+    else if (pacing == FramePacing::FULL)
+    {
+        // Match high refresh rate displays so the slides stay smooth
+        const int refreshRate = GetMonitorRefreshRate(GetCurrentMonitor());
+
+        DisableEventWaiting();
+        SetTargetFPS((refreshRate > TARGET_FPS) ? refreshRate : TARGET_FPS);
+    }
+    else
+    {
+        DisableEventWaiting();
+        SetTargetFPS(REDUCED_FPS);
+    }
+}
+
+/// @brief Gets the master seed from "--seed <n>", or a fresh one
+/// NOTE: a seed that is not a number gets a warning and a fresh one, rather than seed 0
+/// @param argc The number of arguments
+/// @param argv The arguments
+/// @return The master seed
+static std::uint64_t GetMasterSeed(int argc, char *argv[])
+{
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (std::string_view(argv[i]) != "--seed")
+        {
+            continue;
+        }
+
+        if (const std::optional<std::uint64_t> seed = ParseSeed(argv[i + 1]))
+        {
+            return *seed;
+        }
+
+        TraceLog(LOG_WARNING, "GAME: Invalid seed %s, using a fresh one", argv[i + 1]);
+        break;
+    }
+
+    return (static_cast<std::uint64_t>(std::random_device{}()) << 32) | std::random_device{}();
+}
+
+/// @brief Gets the solver of the new puzzles from "--solver bidirectional|parallel", or IDA*
+/// @param argc The number of arguments
+/// @param argv The arguments
+/// @return The solver
+static search::Algorithm GetAlgorithm(int argc, char *argv[])
+{
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (std::string_view(argv[i]) != "--solver")
+        {
+            continue;
+        }
+
+        if (std::string_view(argv[i + 1]) == "bidirectional")
+        {
+            return search::Algorithm::BIDIRECTIONAL_BFS;
+        }
+        if (std::string_view(argv[i + 1]) == "parallel")
+        {
+            return search::Algorithm::PARALLEL_IDA_STAR;
+        }
+    }
+
+    return search::Algorithm::IDA_STAR;
+}
+
+/// @brief Gets the file of the puzzles to play first from "--import <path>", or none
+/// @param argc The number of arguments
+/// @param argv The arguments
+/// @return The path, empty if there is none
+static std::string GetImportPath(int argc, char *argv[])
+{
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (std::string_view(argv[i]) == "--import")
+        {
+            return argv[i + 1];
+        }
+    }
+
+    return {};
+}
+
+int main(int argc, char *argv[])
 {
     const int screenWidth = 1200;
     const int screenHeight = 1200;
+    const int minScreenSize = 400;
     bool shouldClose = false;
 
+    // Every screen is laid out relative to the window so it can be resized freely
+    SetConfigFlags(FLAG_WINDOW_RESIZABLE);
     InitWindow(screenWidth, screenHeight, "8 Puzzle Game");
+    SetWindowMinSize(minScreenSize, minScreenSize);
 
     // Initialize audo device
     InitAudioDevice();
 
-    // Initialize all required variables and load all required data here!
-    ScreenManager manager{};
+    // Every random number is derived from one seed, so a run can be replayed with --seed
+    const std::uint64_t seed = GetMasterSeed(argc, argv);
+    TraceLog(LOG_INFO, "GAME: Master seed %llu", static_cast<unsigned long long>(seed));
 
-    // Set desired framerate (frames-per-second)
-    SetTargetFPS(TARGET_FPS);
-
-    while (!WindowShouldClose() &&
-           !shouldClose) // Detect window close button, ESC key, or user's selection
+    // The screens unload all loaded data (textures, fonts, audio) when the block ends
     {
-        // Update
-        manager.Update();
-
-        shouldClose = manager.GetWindowShouldBeClosed();
-
-        // Draw
-        BeginDrawing();
-
-        ClearBackground(RAYWHITE);
-        manager.Draw();
-
-        EndDrawing();
+        // Initialize all required variables and load all required data here!
+        ScreenManager manager{seed, GetAlgorithm(argc, argv), GetImportPath(argc, argv)};
+
+        // Log every transition so the flow between the screens can be followed
+        manager.AddTransitionHook(
+            [](GameScreenState from, GameScreenState to)
+            {
+                TraceLog(LOG_DEBUG, "SCREEN: %d -> %d", std::to_underlying(from),
+                         std::to_underlying(to));
+            });
+
+        // Set desired framerate (frames-per-second)
+        FramePacing curPacing = FramePacing::FULL;
+        ApplyFramePacing(curPacing);
+
+        while (!WindowShouldClose() &&
+               !shouldClose) // Detect window close button, ESC key, or user's selection
+        {
+            // Update
+            manager.Update();
+
+            shouldClose = manager.GetWindowShouldBeClosed();
+
+            // Slow down or wait for events when the screen has nothing to animate
+            if (const FramePacing pacing = manager.GetFramePacing(); pacing != curPacing)
+            {
+                ApplyFramePacing(pacing);
+                curPacing = pacing;
+            }
+
+            // Draw
+            BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+            manager.Draw();
+
+            EndDrawing();
+
+            // The moves answered in this frame are on the screen now
+            manager.OnFramePresented();
+        }
     }
 
-    // Unload all loaded data (textures, fonts, audio) here!
-    manager.~ScreenManager();
-
     // Close audio device
     CloseAudioDevice();
 
@@ -0,0 +1,49 @@
+#include <atomic>   // std::atomic
+#include <chrono>   // std::chrono::milliseconds
+#include <csignal>  // std::signal, SIGINT, SIGTERM
+#include <stdlib.h> // EXIT_SUCCESS, EXIT_FAILURE
+#include <thread>   // std::this_thread::sleep_for
+
+#include "fmt/core.h"
+
+#include "stats/leaderboardlib.hpp"       // stats::Leaderboard
+#include "stats/leaderboardserverlib.hpp" // stats::LeaderboardServer, stats::defaultLeaderboardPath
+
+static std::atomic<bool> shouldStop{false};
+
+/// @brief Stops the server on SIGINT and SIGTERM
+/// @param signal The signal
+static void HandleSignal(int /*signal*/)
+{
+    shouldStop.store(true);
+}
+
+/// @brief Serves one leaderboard to all the kiosks on this host
+///
+/// Usage: leaderboard [socket path] [leaderboard file]
+int main(int argc, char *argv[])
+{
+    const char *socketPath = (argc > 1) ? argv[1] : stats::defaultLeaderboardSocket;
+    const char *filePath = (argc > 2) ? argv[2] : stats::defaultLeaderboardPath;
+
+    std::signal(SIGINT, HandleSignal);
+    std::signal(SIGTERM, HandleSignal);
+
+    stats::Leaderboard leaderboard{filePath};
+    stats::LeaderboardServer server{leaderboard, socketPath};
+    if (!server.IsListening())
+    {
+        fmt::print(stderr, "Could not listen on {}\n", socketPath);
+        return EXIT_FAILURE;
+    }
+
+    fmt::print("Serving {} on {}\n", filePath, socketPath);
+
+    // The server answers on its own thread, this one only waits for a signal
+    while (!shouldStop.load())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,191 @@
+#include <cstdint>       // std::int64_t, std::uint64_t
+#include <cstdlib>       // std::strtoll, std::strtoull
+#include <span>          // std::span
+#include <stdlib.h>      // EXIT_SUCCESS, EXIT_FAILURE
+#include <string>        // std::string
+#include <string_view>   // std::string_view
+#include <unordered_set> // std::unordered_set
+#include <vector>        // std::vector
+
+#include "fmt/core.h"
+
+#include "creator/creatorlib.hpp"    // creator::GetRandomLayout
+#include "creator/puzzlepacklib.hpp" // creator::PackPuzzle, creator::WritePack
+#include "search/distancelib.hpp"    // search::DistanceTable
+#include "search/idastarlib.hpp"     // search::IdaStar
+#include "search/packedstatelib.hpp" // search::Pack, search::Slide, search::moves
+#include "utils/randomlib.hpp"       // RandomService, Xoshiro256
+
+namespace
+{
+/// @brief The options of the packer
+struct Options
+{
+    std::string path = "resources/puzzles.pack";
+    std::uint64_t count = 365;
+    std::uint64_t minMoves = 16;
+    std::uint64_t maxMoves = 26;
+    std::uint64_t seed = 1;
+    std::int64_t firstDay = creator::GetToday();
+};
+
+/// @brief Reads the options
+/// @param argc The number of arguments
+/// @param argv The arguments
+/// @return The options
+Options ParseOptions(int argc, char *argv[])
+{
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const std::string_view name(argv[i]);
+        const char *value = argv[i + 1];
+        if (name == "--out")
+        {
+            options.path = value;
+        }
+        else if (name == "--count")
+        {
+            options.count = std::strtoull(value, nullptr, 10);
+        }
+        else if (name == "--min")
+        {
+            options.minMoves = std::strtoull(value, nullptr, 10);
+        }
+        else if (name == "--max")
+        {
+            options.maxMoves = std::strtoull(value, nullptr, 10);
+        }
+        else if (name == "--seed")
+        {
+            options.seed = std::strtoull(value, nullptr, 10);
+        }
+        else if (name == "--first-day")
+        {
+            options.firstDay = std::strtoll(value, nullptr, 10);
+        }
+    }
+
+    return options;
+}
+
+/// @brief Checks that a solution is valid and optimal
+/// @param layout The start layout
+/// @param dirs The directions of the empty piece
+/// @param distanceTable The table that gives the optimal moves
+/// @return TRUE if the solution reaches the goal in the optimal number of moves
+bool Verify(std::span<const int> layout, std::span<const short> dirs,
+            const search::DistanceTable &distanceTable)
+{
+    constexpr int N = constants::EIGHT_PUZZLE_SIZE;
+
+    if (distanceTable.GetDistance(layout) != dirs.size())
+    {
+        return false;
+    }
+
+    search::PackedState state = search::Pack(layout);
+    int posX = 0;
+    while (search::GetPiece(state, posX) != 0)
+    {
+        posX++;
+    }
+
+    for (const short dir : dirs)
+    {
+        int target = -1;
+        for (const search::Move &move : search::moves)
+        {
+            if (move.dir == dir)
+            {
+                target = search::GetTarget(posX, move, N);
+            }
+        }
+
+        if (target < 0)
+        {
+            return false;
+        }
+
+        state = search::Slide(state, posX, target);
+        posX = target;
+    }
+
+    std::vector<int> goal{1, 2, 3, 4, 5, 6, 7, 8, constants::EMPTY};
+    return state == search::Pack(goal);
+}
+} // namespace
+
+/// @brief Builds a pack of solved and verified puzzles for the kiosks
+///
+/// Usage: packer [--out path] [--count n] [--min moves] [--max moves] [--seed n]
+///               [--first-day days since the epoch]
+int main(int argc, char *argv[])
+{
+    const Options options = ParseOptions(argc, argv);
+    if ((options.count == 0) || (options.minMoves == 0) ||
+        (options.minMoves > options.maxMoves) ||
+        (options.maxMoves > static_cast<std::uint64_t>(creator::maxPackedMoves)))
+    {
+        fmt::print(stderr, "Invalid options, the moves must be within 1 to {}\n",
+                   creator::maxPackedMoves);
+        return EXIT_FAILURE;
+    }
+
+    const search::DistanceTable distanceTable;
+    search::IdaStar solver;
+    Xoshiro256 rng = RandomService(options.seed).MakeStream(RandomStream::CREATOR);
+
+    std::vector<creator::PackedPuzzle> puzzles;
+    puzzles.reserve(options.count);
+    std::unordered_set<search::PackedState> seen;
+
+    // Give up if the band is too narrow to hold that many different puzzles
+    const std::uint64_t maxAttempts = options.count * 10'000;
+    std::uint64_t attempts = 0;
+    while ((puzzles.size() < options.count) && (attempts++ < maxAttempts))
+    {
+        const std::vector<int> layout = creator::GetRandomLayout(rng);
+
+        // The table filters on difficulty before the solver does any work
+        const unsigned distance = distanceTable.GetDistance(layout);
+        if ((distance < options.minMoves) || (distance > options.maxMoves) ||
+            !seen.insert(search::Pack(layout)).second)
+        {
+            continue;
+        }
+
+        size_t posX = 0;
+        while (layout[posX] != constants::EMPTY)
+        {
+            posX++;
+        }
+
+        const std::vector<short> dirs = solver.Solve(layout, static_cast<int>(posX));
+        if (!Verify(layout, dirs, distanceTable))
+        {
+            fmt::print(stderr, "The solution of puzzle {} failed verification\n", puzzles.size());
+            return EXIT_FAILURE;
+        }
+
+        puzzles.push_back(creator::PackPuzzle(layout, dirs));
+    }
+
+    if (puzzles.size() < options.count)
+    {
+        fmt::print(stderr, "Only found {} puzzles within {} to {} moves\n", puzzles.size(),
+                   options.minMoves, options.maxMoves);
+        return EXIT_FAILURE;
+    }
+
+    if (!creator::WritePack(options.path, puzzles, options.firstDay))
+    {
+        fmt::print(stderr, "Could not write {}\n", options.path);
+        return EXIT_FAILURE;
+    }
+
+    fmt::print("Wrote {} puzzles ({} to {} moves) to {}\n", puzzles.size(), options.minMoves,
+               options.maxMoves, options.path);
+
+    return EXIT_SUCCESS;
+}
@@ -1,21 +1,25 @@
 #include <algorithm> // std::generate
+#include <array>     // std::array
 #include <cstddef>
-#include <fstream> // std::ofstream
-#include <vector>  // std::vector
+#include <cstdint>   // std::uint64_t
+#include <fstream>   // std::ofstream
+#include <span>      // std::span
+#include <vector>    // std::vector
 
 #include "nanobench.h" // ankerl::nanobench::Bench
 
 #include "gui/colourlib.hpp"
 #include "raylib.h"
-#include "slidr/math/mathlib.hpp"
-
-#include "raylib.h"
+#include "utils/randomlib.hpp" // RandomService, Xoshiro256
 
 namespace
 {
 constexpr std::array<Color, 6> CONFETTI_COLOURS{LIGHT_CORAL, APRICOT,  LEMON,
                                                 MINT,        SKY_BLUE, LAVENDER};
 constexpr int NUM_OF_CONFETTI = 2'000;
+
+// A fixed seed so every run draws the same numbers
+constexpr std::uint64_t BENCHMARK_SEED = 20240501;
 } // namespace
 
 struct Confetti
@@ -46,7 +50,8 @@ class Dummy
 {
 public:
     Dummy()
-        : confetti_(NUM_OF_CONFETTI)
+        : confetti_(NUM_OF_CONFETTI),
+          rng_(RandomService(BENCHMARK_SEED).MakeStream(RandomStream::BENCHMARK))
     {
     }
 
@@ -56,13 +61,13 @@ public:
         while (itr != confetti_.end())
         {
             itr->active = true;
-            itr->position = (Vector2){(float)GetRandomValue(0, GetScreenWidth()),
-                                      (float)GetRandomValue(-GetScreenHeight() * 0.25, 0)};
-            itr->velocity = (Vector2){GetNormalFloatDist(0, 100), GetNormalFloatDist(0, 100)};
-            itr->size = (Vector2){(float)GetRandomValue(5, 12), (float)GetRandomValue(8, 20)};
-            itr->orientation = (float)GetRandomValue(0, 360);
-            itr->omega = GetNormalFloatDist(-150, 150);
-            itr->colour = CONFETTI_COLOURS[GetUniformIntDist(0, CONFETTI_COLOURS.size() - 1)];
+            itr->position = (Vector2){(float)rng_.NextInt(0, GetScreenWidth()),
+                                      (float)rng_.NextInt(-GetScreenHeight() * 0.25, 0)};
+            itr->velocity = (Vector2){rng_.NextNormal(0, 100), rng_.NextNormal(0, 100)};
+            itr->size = (Vector2){(float)rng_.NextInt(5, 12), (float)rng_.NextInt(8, 20)};
+            itr->orientation = (float)rng_.NextInt(0, 360);
+            itr->omega = rng_.NextNormal(-150, 150);
+            itr->colour = CONFETTI_COLOURS[rng_.NextInt(0, CONFETTI_COLOURS.size() - 1)];
 
             ++itr;
         }
@@ -72,24 +77,55 @@ public:
     {
         std::generate(
             confetti_.begin(), confetti_.end(),
-            []()
+            [this]()
             {
                 return Confetti{
                     // Use designated initializer
-                    .position = {(float)GetRandomValue(0, GetScreenWidth()),
-                                 (float)GetRandomValue(-GetScreenHeight() * 0.25, 0)},
-                    .velocity = {GetNormalFloatDist(0, 100), GetNormalFloatDist(0, 100)},
-                    .size = (float)GetRandomValue(5, 12),
-                    (float)GetRandomValue(8, 20),
-                    .orientation = (float)GetRandomValue(0, 360),
-                    .omega = GetNormalFloatDist(-150, 150),
-                    .colour = CONFETTI_COLOURS[GetUniformIntDist(0, CONFETTI_COLOURS.size() - 1)],
+                    .position = {(float)rng_.NextInt(0, GetScreenWidth()),
+                                 (float)rng_.NextInt(-GetScreenHeight() * 0.25, 0)},
+                    .velocity = {rng_.NextNormal(0, 100), rng_.NextNormal(0, 100)},
+                    .size = {(float)rng_.NextInt(5, 12), (float)rng_.NextInt(8, 20)},
+                    .orientation = (float)rng_.NextInt(0, 360),
+                    .omega = rng_.NextNormal(-150, 150),
+                    .colour = CONFETTI_COLOURS[rng_.NextInt(0, CONFETTI_COLOURS.size() - 1)],
                     .active = true};
             });
     }
 
+    void ConstructorC()
+    {
+        // Draw every field for all the confetti in one go, one value per field, then scatter them
+        const size_t n = confetti_.size();
+        const std::span<int> ints{ints_};
+        rng_.FillInt(ints.first(n), 0, GetScreenWidth());
+        rng_.FillInt(ints.subspan(n, n), (int)(-GetScreenHeight() * 0.25), 0);
+        rng_.FillInt(ints.subspan(2 * n, n), 5, 12);
+        rng_.FillInt(ints.subspan(3 * n, n), 8, 20);
+        rng_.FillInt(ints.subspan(4 * n, n), 0, 360);
+        rng_.FillInt(ints.subspan(5 * n, n), 0, CONFETTI_COLOURS.size() - 1);
+
+        const std::span<float> normals{normals_};
+        rng_.FillNormal(normals.first(2 * n), 0, 100);
+        rng_.FillNormal(normals.subspan(2 * n, n), -150, 150);
+
+        for (size_t i = 0; i < n; i++)
+        {
+            Confetti &c = confetti_[i];
+            c.active = true;
+            c.position = {(float)ints_[i], (float)ints_[n + i]};
+            c.velocity = {normals_[i], normals_[n + i]};
+            c.size = {(float)ints_[2 * n + i], (float)ints_[3 * n + i]};
+            c.orientation = (float)ints_[4 * n + i];
+            c.omega = normals_[2 * n + i];
+            c.colour = CONFETTI_COLOURS[ints_[5 * n + i]];
+        }
+    }
+
 private:
     std::vector<Confetti> confetti_;
+    Xoshiro256 rng_;
+    std::array<int, 6 * NUM_OF_CONFETTI> ints_;
+    std::array<float, 3 * NUM_OF_CONFETTI> normals_;
 };
 
 int main()
@@ -113,6 +149,14 @@ int main()
                  Dummy d{};
                  d.ConstructorB();
 
+                 ankerl::nanobench::doNotOptimizeAway(d);
+             })
+        .run("Batch",
+             [&]
+             {
+                 Dummy d{};
+                 d.ConstructorC();
+
                  ankerl::nanobench::doNotOptimizeAway(d);
              });
 
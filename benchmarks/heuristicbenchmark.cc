@@ -0,0 +1,116 @@
+#include <array>   // std::array
+#include <cstdint> // std::uint64_t
+#include <fstream> // std::ofstream
+#include <utility> // std::move
+#include <vector>  // std::vector
+
+#include "fmt/core.h"
+#include "nanobench.h" // ankerl::nanobench::Bench
+
+#include "creator/creatorlib.hpp"   // creator::GetRandomLayout
+#include "search/heuristicslib.hpp" // search::HeuristicKind
+#include "search/idastarlib.hpp"    // search::IdaStar
+#include "utils/randomlib.hpp"      // RandomService, Xoshiro256
+
+namespace
+{
+constexpr size_t NUM_OF_PUZZLES = 64;
+
+// A fixed seed so every run solves the same puzzles
+constexpr std::uint64_t BENCHMARK_SEED = 20240703;
+
+// Small enough to clear before every puzzle, big enough for the bounds of one
+constexpr size_t TABLE_MEMORY = size_t{64} << 10;
+
+/// @brief A puzzle to solve
+struct Puzzle
+{
+    std::vector<int> layout;
+    int posX;
+};
+
+/// @brief A heuristic and its name
+struct Candidate
+{
+    const char *name;
+    search::HeuristicKind kind;
+};
+
+constexpr std::array<Candidate, 3> CANDIDATES{{
+    {"Manhattan", search::HeuristicKind::MANHATTAN},
+    {"Linear conflict", search::HeuristicKind::LINEAR_CONFLICT},
+    {"Walking distance", search::HeuristicKind::WALKING_DISTANCE},
+}};
+
+/// @brief Draws random puzzles
+/// @return The puzzles
+std::vector<Puzzle> GetPuzzles()
+{
+    Xoshiro256 rng = RandomService(BENCHMARK_SEED).MakeStream(RandomStream::BENCHMARK);
+
+    std::vector<Puzzle> puzzles;
+    for (size_t i = 0; i < NUM_OF_PUZZLES; i++)
+    {
+        Puzzle puzzle{creator::GetRandomLayout(rng), 0};
+        while (puzzle.layout[static_cast<size_t>(puzzle.posX)] != constants::EMPTY)
+        {
+            puzzle.posX++;
+        }
+        puzzles.push_back(std::move(puzzle));
+    }
+
+    return puzzles;
+}
+} // namespace
+
+int main()
+{
+    std::ofstream file("./build/benchmarks/heuristic-results.csv");
+    ankerl::nanobench::Bench bench;
+
+    const std::vector<Puzzle> puzzles = GetPuzzles();
+
+    // The bounds are forgotten before every puzzle, so one puzzle does not help the next
+    std::uint64_t manhattanNodes = 0;
+    for (const Candidate &candidate : CANDIDATES)
+    {
+        search::IdaStar solver(candidate.kind, TABLE_MEMORY);
+
+        std::uint64_t nodes = 0;
+        for (const Puzzle &puzzle : puzzles)
+        {
+            solver.ForgetBounds();
+            solver.Solve(puzzle.layout, puzzle.posX);
+            nodes += solver.GetExpandedNodes();
+        }
+
+        if (candidate.kind == search::HeuristicKind::MANHATTAN)
+        {
+            manhattanNodes = nodes;
+        }
+        fmt::print("{}: {} nodes ({:.1f}% of Manhattan)\n", candidate.name, nodes,
+                   100.0 * static_cast<double>(nodes) / static_cast<double>(manhattanNodes));
+    }
+
+    bench.minEpochIterations(5)
+        .batch(static_cast<double>(puzzles.size()))
+        .unit("puzzle")
+        .title("Heuristics");
+    for (const Candidate &candidate : CANDIDATES)
+    {
+        search::IdaStar solver(candidate.kind, TABLE_MEMORY);
+        bench.run(candidate.name,
+                  [&]
+                  {
+                      for (const Puzzle &puzzle : puzzles)
+                      {
+                          solver.ForgetBounds();
+                          ankerl::nanobench::doNotOptimizeAway(
+                              solver.Solve(puzzle.layout, puzzle.posX));
+                      }
+                  });
+    }
+
+    // Render the results to a csv file
+    bench.render(ankerl::nanobench::templates::csv(), file);
+}
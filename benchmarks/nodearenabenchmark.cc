@@ -0,0 +1,96 @@
+#include <cstdint> // std::uint64_t
+#include <fstream> // std::ofstream
+#include <memory>  // std::shared_ptr, std::make_shared
+#include <vector>  // std::vector
+
+#include "nanobench.h"            // ankerl::nanobench::Bench
+#include "slidr/node/nodelib.hpp" // Node
+
+#include "creator/creatorlib.hpp"    // creator::GetRandomLayout
+#include "search/nodearenalib.hpp"   // search::NodeArena
+#include "search/packedstatelib.hpp" // search::moves
+#include "utils/randomlib.hpp"       // RandomService, Xoshiro256
+
+namespace
+{
+constexpr size_t NUM_OF_MOVES = 10'000;
+
+// A fixed seed so every run walks the same moves
+constexpr std::uint64_t BENCHMARK_SEED = 20240612;
+
+/// @brief A random walk of the empty piece
+struct Walk
+{
+    std::vector<int> layout;
+    std::vector<short> dirs;
+};
+
+/// @brief Draws a start layout and a walk of valid moves from it
+/// @return The walk
+Walk GetWalk()
+{
+    Xoshiro256 rng = RandomService(BENCHMARK_SEED).MakeStream(RandomStream::BENCHMARK);
+
+    Walk walk{creator::GetRandomLayout(rng), {}};
+
+    // The arena itself tells which moves stay on the board
+    search::NodeArena arena(NUM_OF_MOVES + 1);
+    search::NodeIndex node = arena.AddRoot(walk.layout);
+    while (walk.dirs.size() < NUM_OF_MOVES)
+    {
+        const short dir = search::moves[static_cast<size_t>(rng.NextInt(0, 3))].dir;
+        if (const search::NodeIndex child = arena.AddChild(node, dir); child != search::noNode)
+        {
+            walk.dirs.push_back(dir);
+            node = child;
+        }
+    }
+
+    return walk;
+}
+} // namespace
+
+int main()
+{
+    std::ofstream file("./build/benchmarks/nodearena-results.csv");
+    ankerl::nanobench::Bench bench;
+
+    const Walk walk = GetWalk();
+
+    // Both keep every node of the walk alive until the end, like the history of a game
+    search::NodeArena arena(NUM_OF_MOVES + 1);
+    bench.minEpochIterations(20)
+        .batch(static_cast<double>(walk.dirs.size()))
+        .unit("move")
+        .title("History nodes")
+        .run("shared_ptr<Node>",
+             [&]
+             {
+                 std::vector<std::shared_ptr<Node>> history;
+                 history.push_back(std::make_shared<Node>(walk.layout));
+                 for (const short dir : walk.dirs)
+                 {
+                     const std::shared_ptr<Node> &top = history.back();
+                     auto [childLayout, childPosX] = top->GetNextLayout(dir);
+                     history.push_back(std::make_shared<Node>(childLayout, childPosX,
+                                                              top->GetDepth() + 1, top, dir));
+                 }
+
+                 ankerl::nanobench::doNotOptimizeAway(history.back()->GetDepth());
+             })
+        .run("NodeArena",
+             [&]
+             {
+                 arena.Reset();
+                 search::NodeIndex node = arena.AddRoot(walk.layout);
+                 for (const short dir : walk.dirs)
+                 {
+                     node = arena.AddChild(node, dir);
+                 }
+
+                 ankerl::nanobench::doNotOptimizeAway(arena[node].depth);
+             });
+
+    // Render the results to a csv file
+    bench.render(ankerl::nanobench::templates::csv(), file);
+}
@@ -0,0 +1,105 @@
+#include <cstdint> // std::uint32_t, std::uint64_t
+#include <fstream> // std::ofstream
+#include <span>    // std::span
+#include <vector>  // std::vector
+
+#include "nanobench.h" // ankerl::nanobench::Bench
+
+#include "creator/creatorlib.hpp"    // creator::GetRandomLayout
+#include "search/packedstatelib.hpp" // search::Pack, search::PackedState
+#include "search/rankinglib.hpp"     // search::Rank, search::HalfRank, search::RankBatch
+#include "utils/randomlib.hpp"       // RandomService, Xoshiro256
+
+namespace
+{
+constexpr size_t NUM_OF_STATES = 4'096;
+
+// A fixed seed so every run ranks the same states
+constexpr std::uint64_t BENCHMARK_SEED = 20240501;
+
+/// @brief Ranks a permutation by counting the smaller values after each position
+/// @param digits The permutation
+/// @return The rank in [0, 9!)
+std::uint32_t NaiveRank(const search::Digits &digits)
+{
+    std::uint32_t rank = 0;
+    for (size_t i = 0; i < digits.size() - 1; i++)
+    {
+        std::uint32_t smaller = 0;
+        for (size_t j = i + 1; j < digits.size(); j++)
+        {
+            smaller += (digits[j] < digits[i]);
+        }
+        rank += smaller * search::factorials[digits.size() - 1 - i];
+    }
+
+    return rank;
+}
+
+/// @brief Draws solvable states
+/// @return The packed states
+std::vector<search::PackedState> GetStates()
+{
+    Xoshiro256 rng = RandomService(BENCHMARK_SEED).MakeStream(RandomStream::BENCHMARK);
+
+    std::vector<search::PackedState> states(NUM_OF_STATES);
+    for (search::PackedState &state : states)
+    {
+        state = search::Pack(creator::GetRandomLayout(rng));
+    }
+
+    return states;
+}
+} // namespace
+
+int main()
+{
+    std::ofstream file("./build/benchmarks/ranking-results.csv");
+    ankerl::nanobench::Bench bench;
+
+    const std::vector<search::PackedState> states = GetStates();
+    std::vector<std::uint32_t> ranks(states.size());
+
+    bench.minEpochIterations(100)
+        .batch(static_cast<double>(states.size()))
+        .unit("state")
+        .title("Ranking")
+        .run("Naive O(n^2)",
+             [&]
+             {
+                 for (size_t i = 0; i < states.size(); i++)
+                 {
+                     ranks[i] = NaiveRank(search::ToDigits(states[i]));
+                 }
+
+                 ankerl::nanobench::doNotOptimizeAway(ranks);
+             })
+        .run("Popcount O(n)",
+             [&]
+             {
+                 search::RankBatch(states, ranks);
+
+                 ankerl::nanobench::doNotOptimizeAway(ranks);
+             })
+        .run("Half rank",
+             [&]
+             {
+                 search::HalfRankBatch(states, ranks);
+
+                 ankerl::nanobench::doNotOptimizeAway(ranks);
+             })
+        .run("Half unrank",
+             [&]
+             {
+                 std::uint64_t sum = 0;
+                 for (const std::uint32_t rank : ranks)
+                 {
+                     sum += search::HalfUnrank(rank)[0];
+                 }
+
+                 ankerl::nanobench::doNotOptimizeAway(sum);
+             });
+
+    // Render the results to a csv file
+    bench.render(ankerl::nanobench::templates::csv(), file);
+}
@@ -0,0 +1,194 @@
+#include <algorithm>     // std::max
+#include <cstdint>       // std::uint32_t, std::uint64_t
+#include <fstream>       // std::ofstream
+#include <thread>        // std::thread
+#include <tuple>         // std::tuple
+#include <unordered_set> // std::unordered_set
+#include <utility>       // std::pair, std::move
+#include <vector>        // std::vector
+
+#include "fmt/core.h"
+#include "nanobench.h" // ankerl::nanobench::Bench
+
+#include "search/bidirectionallib.hpp"   // search::BidirectionalSearch
+#include "search/distancelib.hpp"        // search::DistanceTable
+#include "search/idastarlib.hpp"         // search::IdaStar
+#include "search/packedstatelib.hpp"     // search::Pack, search::Slide, search::moves
+#include "search/parallelidastarlib.hpp" // search::ParallelIdaStar
+#include "search/rankinglib.hpp"         // search::HalfUnrank, search::numOfHalfRanks
+#include "utils/threadpoollib.hpp"       // ThreadPool
+
+namespace
+{
+constexpr int N = constants::EIGHT_PUZZLE_SIZE;
+
+// The puzzles at least this deep are the ones worth comparing
+constexpr unsigned MIN_DEPTH = 28;
+constexpr size_t NUM_OF_PUZZLES = 8;
+
+/// @brief A puzzle to solve
+struct Puzzle
+{
+    std::vector<int> layout;
+    int posX;
+};
+
+/// @brief Picks deep puzzles spread over the whole table
+/// @param table The table that gives the optimal moves
+/// @return The puzzles
+std::vector<Puzzle> GetDeepPuzzles(const search::DistanceTable &table)
+{
+    std::vector<Puzzle> puzzles;
+    for (std::uint32_t rank = 0;
+         (rank < search::numOfHalfRanks) && (puzzles.size() < NUM_OF_PUZZLES); rank += 7)
+    {
+        const search::Digits digits = search::HalfUnrank(rank);
+
+        Puzzle puzzle{std::vector<int>(digits.size()), 0};
+        for (size_t i = 0; i < digits.size(); i++)
+        {
+            puzzle.layout[i] = (digits[i] == 0) ? constants::EMPTY : digits[i];
+            puzzle.posX = (digits[i] == 0) ? static_cast<int>(i) : puzzle.posX;
+        }
+
+        if (table.GetDistance(puzzle.layout) >= MIN_DEPTH)
+        {
+            puzzles.push_back(std::move(puzzle));
+        }
+    }
+
+    return puzzles;
+}
+
+/// @brief Counts the nodes a breadth-first search from the start expands before the goal
+/// @param puzzle The puzzle
+/// @return The number of nodes
+std::uint64_t CountForwardBfs(const Puzzle &puzzle)
+{
+    const search::PackedState goal = search::Pack(std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8,
+                                                                   constants::EMPTY});
+
+    std::unordered_set<search::PackedState> visited{search::Pack(puzzle.layout)};
+    std::vector<std::pair<search::PackedState, int>> frontier{
+        {search::Pack(puzzle.layout), puzzle.posX}};
+    std::vector<std::pair<search::PackedState, int>> next;
+
+    std::uint64_t expanded = 0;
+    while (!frontier.empty())
+    {
+        for (const auto &[state, posX] : frontier)
+        {
+            if (state == goal)
+            {
+                return expanded;
+            }
+            expanded++;
+
+            for (const search::Move &move : search::moves)
+            {
+                const int target = search::GetTarget(posX, move, N);
+                if (target < 0)
+                {
+                    continue;
+                }
+
+                const search::PackedState child = search::Slide(state, posX, target);
+                if (visited.insert(child).second)
+                {
+                    next.emplace_back(child, target);
+                }
+            }
+        }
+
+        frontier.swap(next);
+        next.clear();
+    }
+
+    return expanded;
+}
+} // namespace
+
+int main()
+{
+    std::ofstream file("./build/benchmarks/solver-results.csv");
+    ankerl::nanobench::Bench bench;
+
+    const search::DistanceTable table;
+    const std::vector<Puzzle> puzzles = GetDeepPuzzles(table);
+
+    // Compare the work of each solver on the same puzzles
+    search::IdaStar idaStar;
+    search::BidirectionalSearch bidirectional;
+    for (const Puzzle &puzzle : puzzles)
+    {
+        const size_t length = idaStar.Solve(puzzle.layout, puzzle.posX).size();
+        bidirectional.Solve(puzzle.layout, puzzle.posX);
+
+        fmt::print("{} moves: forward BFS {} nodes, IDA* {} nodes, bidirectional {} nodes "
+                   "({} KiB)\n",
+                   length, CountForwardBfs(puzzle), idaStar.GetExpandedNodes(),
+                   bidirectional.GetExpandedNodes(), bidirectional.GetPeakMemory() / 1024);
+    }
+
+    // Show how evenly the parallel solver spreads the work over the pool
+    ThreadPool pool(std::max(1U, std::thread::hardware_concurrency()));
+    search::ParallelIdaStar parallel(pool);
+    for (const Puzzle &puzzle : puzzles)
+    {
+        const size_t length = parallel.Solve(puzzle.layout, puzzle.posX).size();
+
+        fmt::print("{} moves: parallel IDA* {} nodes, per worker", length,
+                   parallel.GetExpandedNodes());
+        for (const std::uint64_t expanded : parallel.GetExpandedNodesPerWorker())
+        {
+            fmt::print(" {}", expanded);
+        }
+        fmt::print("\n");
+    }
+
+    // The tables keep their bounds between puzzles, so the hits grow over the runs
+    const search::TableCounters idaStarCounters = idaStar.GetTableCounters();
+    const search::TableCounters parallelCounters = parallel.GetTableCounters();
+    for (const auto &[name, table, counters] :
+         {std::tuple{"IDA*", &idaStar.GetTable(), &idaStarCounters},
+          std::tuple{"Parallel IDA*", &parallel.GetTable(), &parallelCounters}})
+    {
+        fmt::print("{} table: {} slots, {} hits, {} misses, {} collisions\n", name,
+                   table->GetCapacity(), counters->hits, counters->misses, counters->collisions);
+    }
+
+    bench.minEpochIterations(5)
+        .batch(static_cast<double>(puzzles.size()))
+        .unit("puzzle")
+        .title("Deep puzzles")
+        .run("IDA*",
+             [&]
+             {
+                 for (const Puzzle &puzzle : puzzles)
+                 {
+                     ankerl::nanobench::doNotOptimizeAway(
+                         idaStar.Solve(puzzle.layout, puzzle.posX));
+                 }
+             })
+        .run("Bidirectional BFS",
+             [&]
+             {
+                 for (const Puzzle &puzzle : puzzles)
+                 {
+                     ankerl::nanobench::doNotOptimizeAway(
+                         bidirectional.Solve(puzzle.layout, puzzle.posX));
+                 }
+             })
+        .run("Parallel IDA*",
+             [&]
+             {
+                 for (const Puzzle &puzzle : puzzles)
+                 {
+                     ankerl::nanobench::doNotOptimizeAway(
+                         parallel.Solve(puzzle.layout, puzzle.posX));
+                 }
+             });
+
+    // Render the results to a csv file
+    bench.render(ankerl::nanobench::templates::csv(), file);
+}
@@ -1,54 +1,36 @@
 #ifndef INCLUDE_CREATOR_CREATORLIB_H_
 #define INCLUDE_CREATOR_CREATORLIB_H_
 
-#include <algorithm> // std::shuffle
-#include <chrono>    // std::chrono
-#include <random>    // std::mt19937
-#include <span>      // std::span
-#include <vector>    // std::vector
+#include <span>    // std::span
+#include <utility> // std::swap
+#include <vector>  // std::vector
 
 #include "slidr/constants/constantslib.hpp" // constants::EMPTY
 
+#include "creator/paritylib.hpp" // creator::ParityTracker
+#include "utils/randomlib.hpp"   // Xoshiro256
+
 namespace creator
 {
-bool Solvable(std::span<const int> layout)
-{
-    int cnt = 0;
-
-    for (size_t i = 0; i < constants::EIGHT_PUZZLE_NUM - 1; i++)
-    {
-        for (size_t j = i + 1; j < constants::EIGHT_PUZZLE_NUM; j++)
-        {
-            int left = layout[i];
-            int right = layout[j];
-            if ((left != constants::EMPTY) && (right != constants::EMPTY) && (left > right))
-            {
-                ++cnt;
-            }
-        }
-    }
-
-    return ((cnt % 2) == 0) ? true : false;
-}
-
-std::vector<int> GetRandomLayout()
+/// @brief Creates a random solvable layout
+/// @param rng The generator of the caller
+/// @return The layout
+inline std::vector<int> GetRandomLayout(Xoshiro256 &rng)
 {
     std::vector<int> layout{1, 2, 3, 4, 5, 6, 7, 8, constants::EMPTY};
-    unsigned seed = std::chrono::high_resolution_clock::now().time_since_epoch().count();
-    std::mt19937 g(seed);
+    rng.Shuffle(std::span(layout));
 
-    for (size_t i = 0; i < 1'000'000; i++)
+    // Half of the shuffles cannot reach the goal; swapping two pieces other than the empty one
+    // flips that, and since it pairs the two halves one to one the result stays uniform
+    ParityTracker tracker(layout);
+    if (!tracker.IsSolvable())
     {
-        std::shuffle(layout.begin(), layout.end(), g);
-
-        if (Solvable(std::span(layout)))
-        {
-            return layout;
-        }
+        const size_t first = (tracker.GetPosX() == 0) ? 1 : 0;
+        const size_t second = (tracker.GetPosX() <= 1) ? 2 : 1;
+        std::swap(layout[first], layout[second]);
     }
 
-    // Return a default one if we could not find a solvable puzzle
-    return {1, 2, 7, 4, constants::EMPTY, 5, 8, 3, 6};
+    return layout;
 }
 } // namespace creator
 
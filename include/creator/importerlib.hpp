@@ -0,0 +1,145 @@
+#ifndef INCLUDE_CREATOR_IMPORTERLIB_H_
+#define INCLUDE_CREATOR_IMPORTERLIB_H_
+
+#include <array>              // std::array
+#include <atomic>             // std::atomic
+#include <condition_variable> // std::condition_variable
+#include <cstdint>            // std::uint64_t
+#include <deque>              // std::deque
+#include <istream>            // std::istream
+#include <mutex>              // std::mutex
+#include <optional>           // std::optional
+#include <span>               // std::span
+#include <string>             // std::string
+#include <string_view>        // std::string_view
+#include <thread>             // std::thread
+#include <unordered_set>      // std::unordered_set
+
+#include "creator/puzzlepacklib.hpp" // creator::PackedPuzzle, creator::Puzzle
+#include "search/idastarlib.hpp"     // search::IdaStar
+#include "search/packedstatelib.hpp" // search::PackedState
+
+namespace creator
+{
+/// @brief The first bytes of a binary puzzle list, the packed start states (8 bytes each) follow
+inline constexpr std::array<char, 8> listMagic{'8', 'P', 'Z', 'L', 'I', 'S', 'T', '1'};
+
+/// @brief The number of solved puzzles an importer keeps ready by default
+inline constexpr size_t defaultImportCapacity = 256;
+
+/// @brief Parses a line of a text puzzle list
+/// NOTE: the numbers are not checked, IsValidLayout() tells if they form a layout
+/// @param line The line, one number per piece separated by spaces or commas, 0 for the empty one
+/// @param layout The layout to fill, constants::EMPTY for the empty piece
+/// @return FALSE if the line does not hold exactly one number per piece
+bool ParseLine(std::string_view line, std::span<int> layout) noexcept;
+
+/// @brief The counts of the layouts an importer has seen
+struct ImportStats
+{
+    /// @brief The layouts read from the file
+    std::uint64_t read;
+
+    /// @brief The layouts that are malformed or already solved
+    std::uint64_t invalid;
+
+    /// @brief The layouts that cannot reach the goal
+    std::uint64_t unsolvable;
+
+    /// @brief The layouts that were seen before
+    std::uint64_t duplicates;
+
+    /// @brief The puzzles that were solved and queued for play
+    std::uint64_t queued;
+};
+
+/// @brief Streams user-supplied layouts into a queue of solved puzzles
+///
+/// A background thread reads the file one layout at a time, so only the
+/// packed states seen so far (for the deduplication) and a bounded number of
+/// solved puzzles are held in memory; the thread waits while the queue is full
+/// and the game takes puzzles off the front. A text file has one layout per
+/// line, nine numbers separated by spaces or commas with 0 for the empty
+/// piece, and lines starting with '#' are comments. A binary file starts with
+/// listMagic and is followed by packed states.
+class PuzzleImporter
+{
+public:
+    /// @brief Starts importing a file in the background
+    /// @param path The path to the file, nothing is imported if it is empty
+    /// @param capacity The number of solved puzzles to keep ready
+    explicit PuzzleImporter(const std::string &path, size_t capacity = defaultImportCapacity);
+
+    ~PuzzleImporter();
+
+    PuzzleImporter(const PuzzleImporter &) = delete;
+
+    PuzzleImporter &operator=(const PuzzleImporter &) = delete;
+
+    /// @brief Takes the next solved puzzle without waiting
+    /// @return The puzzle, nullopt if none is ready
+    std::optional<Puzzle> TryPop();
+
+    /// @brief Checks if the whole file was read
+    /// @return TRUE once the importer will not queue any more puzzles
+    inline bool IsFinished() const noexcept { return finished_.load(std::memory_order_acquire); }
+
+    /// @brief Gets the counts of the layouts seen so far
+    /// @return The counts
+    ImportStats GetStats() const noexcept;
+
+private:
+    /// @brief Reads the file and queues its puzzles until the end or the importer is destroyed
+    void ImportLoop();
+
+    /// @brief Reads the layouts of a text file
+    /// @param in The stream positioned at the start of the file
+    void ReadText(std::istream &in);
+
+    /// @brief Reads the packed states of a binary file
+    /// @param in The stream positioned after the magic
+    void ReadBinary(std::istream &in);
+
+    /// @brief Validates, deduplicates, solves and queues a layout
+    /// @param layout The layout, constants::EMPTY for the empty piece
+    /// @return FALSE if the importer is being destroyed
+    bool Offer(std::span<const int> layout);
+
+private:
+    /// @brief The path to the file
+    std::string path_;
+
+    /// @brief The most puzzles the queue holds
+    size_t capacity_;
+
+    /// @brief The start states seen so far (only touched by the import thread)
+    std::unordered_set<search::PackedState> seen_;
+
+    /// @brief The solver of the optimal solutions (only touched by the import thread)
+    search::IdaStar solver_;
+
+    /// @brief Guards the queue and the stop flag
+    std::mutex mutex_;
+
+    /// @brief Wakes the import thread when there is room in the queue or the importer stops
+    std::condition_variable cv_;
+
+    /// @brief The solved puzzles that are not played yet
+    std::deque<PackedPuzzle> ready_;
+
+    /// @brief TRUE once the importer is being destroyed, set under the mutex so the wait sees it
+    std::atomic<bool> stop_;
+
+    /// @brief TRUE once the whole file was read
+    std::atomic<bool> finished_;
+
+    /// @brief The counts of the layouts, one per field of ImportStats
+    std::array<std::atomic<std::uint64_t>, 5> counts_;
+
+    /// @brief The thread that reads, validates and solves the layouts
+    /// NOTE: declared last so everything above exists before it starts
+    std::thread importer_;
+};
+} // namespace creator
+
+#endif // INCLUDE_CREATOR_IMPORTERLIB_H_
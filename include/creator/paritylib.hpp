@@ -0,0 +1,87 @@
+#ifndef INCLUDE_CREATOR_PARITYLIB_H_
+#define INCLUDE_CREATOR_PARITYLIB_H_
+
+#include <span> // std::span
+
+#include "slidr/constants/constantslib.hpp" // constants::EMPTY
+
+namespace creator
+{
+/// @brief The most pieces a layout can have, a 16x16 board
+inline constexpr size_t maxNumOfPieces = 256;
+
+/// @brief Gets the side of a square board
+/// @param numOfPieces The number of pieces, the empty one included
+/// @return The number of pieces in each row, 0 if they do not fill a square of at least 2x2
+size_t GetSide(size_t numOfPieces) noexcept;
+
+/// @brief Checks if a layout holds every piece exactly once
+/// @param layout The layout of an N×N board, pieces 1 to N×N - 1 and the empty one
+/// @param empty The value of the empty piece, which must not be one of the other pieces
+/// @return TRUE if the layout is square and every piece appears exactly once
+bool IsValidLayout(std::span<const int> layout, int empty = constants::EMPTY) noexcept;
+
+/// @brief Checks if a valid layout is an odd permutation of the goal
+///
+/// The empty piece counts as piece N×N. A permutation of n elements with c
+/// cycles is a product of n - c swaps, so one pass over the cycles gives the
+/// parity in O(n) instead of counting the inversions in O(n²).
+/// @param layout A valid layout
+/// @param empty The value of the empty piece
+/// @return TRUE if it takes an odd number of swaps to reach the goal
+bool IsOddPermutation(std::span<const int> layout, int empty = constants::EMPTY) noexcept;
+
+/// @brief Checks if a valid layout can reach the goal, on a board of any size
+/// @param layout A valid layout
+/// @param empty The value of the empty piece
+/// @return TRUE if it can reach the goal
+bool IsSolvable(std::span<const int> layout, int empty = constants::EMPTY) noexcept;
+
+/// @brief Tracks the solvability of a layout as it changes, in O(1) per change
+///
+/// A move of the empty piece is a swap, which flips the parity of the
+/// permutation, and a step, which flips the parity of the distance of the
+/// empty piece to its goal; a layout is solvable when the two agree, so moves
+/// never change it. Any other swap flips the permutation alone.
+class ParityTracker
+{
+public:
+    /// @brief Starts tracking a layout
+    /// @param layout A valid layout
+    /// @param empty The value of the empty piece
+    explicit ParityTracker(std::span<const int> layout, int empty = constants::EMPTY) noexcept;
+
+    /// @brief Records that two pieces were swapped
+    /// @param posA The position of the first piece
+    /// @param posB The position of the second piece
+    void Swap(size_t posA, size_t posB) noexcept;
+
+    /// @brief Records a move of the empty piece to a neighbouring position
+    /// @param target The position of the empty piece after the move
+    inline void Move(size_t target) noexcept { Swap(posX_, target); }
+
+    /// @brief Checks if the layout is an odd permutation of the goal
+    /// @return TRUE if it takes an odd number of swaps to reach the goal
+    inline bool IsOdd() const noexcept { return odd_; }
+
+    /// @brief Checks if the layout can reach the goal
+    /// @return TRUE if it can reach the goal, FALSE if the layout was not valid
+    bool IsSolvable() const noexcept;
+
+    /// @brief Gets the position of the empty piece
+    /// @return The position of the empty piece
+    inline size_t GetPosX() const noexcept { return posX_; }
+
+private:
+    /// @brief The number of pieces in each row and column
+    size_t side_;
+
+    /// @brief The position of the empty piece
+    size_t posX_;
+
+    /// @brief TRUE if the layout is an odd permutation of the goal
+    bool odd_;
+};
+} // namespace creator
+
+#endif // INCLUDE_CREATOR_PARITYLIB_H_
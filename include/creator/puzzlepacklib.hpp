@@ -0,0 +1,153 @@
+#ifndef INCLUDE_CREATOR_PUZZLEPACKLIB_H_
+#define INCLUDE_CREATOR_PUZZLEPACKLIB_H_
+
+#include <array>   // std::array
+#include <cstdint> // std::int64_t, std::uint8_t, std::uint32_t, std::uint64_t
+#include <span>    // std::span
+#include <string>  // std::string
+#include <vector>  // std::vector
+
+#include "search/packedstatelib.hpp" // search::PackedState
+
+namespace creator
+{
+/// @brief The longest solution that fits into a packed puzzle (2 bits per move)
+constexpr int maxPackedMoves = 32;
+
+/// @brief The first bytes of a pack file
+struct PackHeader
+{
+    /// @brief "8PZPACK" and the version
+    std::array<char, 8> magic;
+
+    /// @brief The number of puzzles that follow the header
+    std::uint32_t numOfPuzzles;
+
+    /// @brief The fewest optimal moves of a puzzle in the pack
+    std::uint8_t minMoves;
+
+    /// @brief The most optimal moves of a puzzle in the pack
+    std::uint8_t maxMoves;
+
+    /// @brief Reserved for later versions (always 0)
+    std::array<std::uint8_t, 2> reserved;
+
+    /// @brief The day (since the epoch, UTC) that gets the first puzzle
+    std::int64_t firstDay;
+
+    /// @brief The FNV-1a hash of all the puzzles
+    std::uint64_t checksum;
+};
+
+/// @brief A puzzle and its optimal solution as it is stored in a pack file
+struct PackedPuzzle
+{
+    /// @brief The start layout
+    search::PackedState startState;
+
+    /// @brief The solution, 2 bits per move (an index into search::moves), first move lowest
+    std::uint64_t solution;
+
+    /// @brief The number of optimal moves
+    std::uint8_t optimalMoves;
+
+    /// @brief The position of the empty piece
+    std::uint8_t posX;
+
+    /// @brief Reserved for later versions (always 0)
+    std::array<std::uint8_t, 6> reserved;
+};
+
+static_assert(sizeof(PackHeader) == 32, "the on-disk header must stay 32 bytes");
+static_assert(sizeof(PackedPuzzle) == 24, "the on-disk puzzle must stay 24 bytes");
+
+/// @brief A puzzle taken out of a pack
+struct Puzzle
+{
+    /// @brief The start layout
+    std::vector<int> layout;
+
+    /// @brief The directions of the empty piece of an optimal solution
+    std::vector<short> dirs;
+};
+
+/// @brief Gets the current day
+/// @return The number of days since the epoch (UTC)
+std::int64_t GetToday();
+
+/// @brief Packs a puzzle and its solution
+/// @param layout The start layout
+/// @param dirs The directions of the empty piece of an optimal solution (at most maxPackedMoves)
+/// @return The packed puzzle
+PackedPuzzle PackPuzzle(std::span<const int> layout, std::span<const short> dirs);
+
+/// @brief Checks if a packed puzzle can be unpacked
+/// @param packed The packed puzzle
+/// @return TRUE if the solution fits and the start layout is a valid layout
+bool IsValidPuzzle(const PackedPuzzle &packed) noexcept;
+
+/// @brief Unpacks a puzzle and its solution
+/// @param packed The packed puzzle (see IsValidPuzzle)
+/// @return The puzzle
+Puzzle UnpackPuzzle(const PackedPuzzle &packed);
+
+/// @brief Writes a pack file
+/// @param path The path to the file (replaced if it exists)
+/// @param puzzles The puzzles in the order they are served
+/// @param firstDay The day that gets the first puzzle
+/// @return FALSE if the file could not be written
+bool WritePack(const std::string &path, std::span<const PackedPuzzle> puzzles,
+               std::int64_t firstDay);
+
+/// @brief A read-only pack of puzzles with known optimal solutions
+///
+/// The file is mapped into memory and checked once when it is opened, so
+/// taking a puzzle out is an index into the mapping. Every kiosk that maps the
+/// same file serves the same puzzle on the same day.
+class PuzzlePack
+{
+public:
+    /// @brief Maps a pack file, the pack is empty if the file is missing or corrupted
+    /// @param path The path to the file
+    explicit PuzzlePack(const std::string &path);
+
+    ~PuzzlePack();
+
+    PuzzlePack(const PuzzlePack &) = delete;
+
+    PuzzlePack &operator=(const PuzzlePack &) = delete;
+
+    /// @brief Checks if the pack has any puzzles
+    /// @return TRUE if the file was mapped and is valid
+    inline bool IsLoaded() const noexcept { return !puzzles_.empty(); }
+
+    /// @brief Gets the number of puzzles
+    /// @return The number of puzzles
+    inline size_t GetSize() const noexcept { return puzzles_.size(); }
+
+    /// @brief Gets the index of the puzzle of a day
+    /// @param day The number of days since the epoch (UTC)
+    /// @return The index, the pack starts over once every puzzle was served
+    size_t GetDailyIndex(std::int64_t day) const noexcept;
+
+    /// @brief Gets a puzzle
+    /// @param index The index of the puzzle (wraps around)
+    /// @return The puzzle, only valid if the pack is loaded
+    Puzzle Get(size_t index) const;
+
+private:
+    /// @brief The start of the mapping, nullptr if nothing is mapped
+    void *mapping_;
+
+    /// @brief The size of the mapping in bytes
+    size_t mappingSize_;
+
+    /// @brief The header inside the mapping
+    PackHeader header_;
+
+    /// @brief The puzzles inside the mapping
+    std::span<const PackedPuzzle> puzzles_;
+};
+} // namespace creator
+
+#endif // INCLUDE_CREATOR_PUZZLEPACKLIB_H_
@@ -3,10 +3,14 @@
 
 #include <string> // std::string
 
+#include "gui/layoutlib.hpp" // gui::Layout
+
 class RaylibAnimation
 {
 public:
-    RaylibAnimation();
+    /// @brief Constructs the animation
+    /// @param layout The layout of the screens
+    explicit RaylibAnimation(const gui::Layout &layout);
 
     ~RaylibAnimation() = default;
 
@@ -32,15 +36,12 @@ public:
     };
 
 private:
+    /// @brief The layout of the screens
+    const gui::Layout &layout_;
+
     /// @brief The current state of the game
     LoadingState curState_;
 
-    /// @brief The width of the main screen
-    int screenWidth_;
-
-    /// @brief The height of the main screen
-    int screenHeight_;
-
     /// @brief The hight of the left side of the rectangle
     int leftSideRecHeight_;
 
@@ -55,12 +56,6 @@ private:
     /// @brief The alpha (saturation) that controls the fading
     float alpha_;
 
-    /// @brief The position x of the logo
-    const int logoPositionX_;
-
-    /// @brief The position y of the logo
-    const int logoPositionY_;
-
     /// @brief The bottom side rectangle width
     int bottomSideRecWidth_;
 
@@ -0,0 +1,91 @@
+#ifndef INCLUDE_GUI_ARENALIB_H_
+#define INCLUDE_GUI_ARENALIB_H_
+
+#include <atomic>  // std::atomic
+#include <cstdint> // std::uint8_t
+#include <vector>  // std::vector
+
+#include "gui/atlaslib.hpp"          // Atlas
+#include "gui/layoutlib.hpp"         // gui::Layout, gui::arenaNumOfBoards
+#include "search/distancelib.hpp"    // search::DistanceTable
+#include "search/packedstatelib.hpp" // search::PackedState
+#include "utils/randomlib.hpp"       // RandomService, Xoshiro256
+#include "utils/threadpoollib.hpp"   // ThreadPool
+
+/// @brief Many boards that solve themselves at the same time
+///
+/// The boards are kept as parallel arrays of packed states rather than Board
+/// objects, so stepping all of them is a tight loop that is split across the
+/// thread pool, and drawing all of them is a single batch from the atlas.
+class Arena
+{
+public:
+    /// @brief Constructs the arena
+    /// @param atlas The atlas that holds the pieces
+    /// @param layout The layout of the screens
+    /// @param distanceTable The table that gives the optimal moves
+    /// @param pool The pool that steps the boards
+    /// @param random The service that seeds the generator of every board
+    Arena(const Atlas &atlas, const gui::Layout &layout,
+          const search::DistanceTable &distanceTable, ThreadPool &pool,
+          const RandomService &random);
+
+    /// @brief Updates the state
+    void Update();
+
+    /// @brief Draws all the boards
+    void Draw() const;
+
+    /// @brief Shuffles all the boards
+    void Reset();
+
+    /// @brief Gets the number of puzzles solved since the last reset
+    /// @return The number of puzzles
+    inline unsigned GetNumOfSolved() const noexcept
+    {
+        return numOfSolved_.load(std::memory_order_relaxed);
+    }
+
+private:
+    /// @brief Moves every board in [begin, end) one step closer to the goal
+    /// @param begin The first board
+    /// @param end One past the last board
+    void Step(size_t begin, size_t end);
+
+    /// @brief Gives a board a new random puzzle
+    /// @param idx The index of the board
+    void Shuffle(size_t idx);
+
+private:
+    /// @brief The atlas that holds the pieces
+    const Atlas &atlas_;
+
+    /// @brief The layout of the screens
+    const gui::Layout &layout_;
+
+    /// @brief The table that gives the optimal moves
+    const search::DistanceTable &distanceTable_;
+
+    /// @brief The pool that steps the boards
+    ThreadPool &pool_;
+
+    /// @brief The packed state of each board
+    std::vector<search::PackedState> states_;
+
+    /// @brief The position of the empty piece of each board
+    std::vector<std::uint8_t> posX_;
+
+    /// @brief The number of steps each solved board rests before it is shuffled
+    std::vector<std::uint8_t> restSteps_;
+
+    /// @brief The generator of each board, so the workers never share one
+    std::vector<Xoshiro256> rngs_;
+
+    /// @brief The time since the last step in seconds
+    float stepTimer_;
+
+    /// @brief The number of puzzles solved since the last reset
+    std::atomic<unsigned> numOfSolved_;
+};
+
+#endif // INCLUDE_GUI_ARENALIB_H_
@@ -0,0 +1,163 @@
+#ifndef INCLUDE_GUI_ATLASLIB_H_
+#define INCLUDE_GUI_ATLASLIB_H_
+
+#include <array>   // std::array
+#include <utility> // std::to_underlying
+
+#include "raylib.h" // Texture2D, Rectangle, Vector2, Color
+
+namespace gui
+{
+/// @brief The sprites that are baked into the atlas
+enum class Sprite
+{
+    // Puzzle pieces
+    PieceOne = 0,
+    PieceTwo,
+    PieceThree,
+    PieceFour,
+    PieceFive,
+    PieceSix,
+    PieceSeven,
+    PieceEight,
+
+    // Board texts
+    UndoTxt,
+    RedoTxt,
+    RestartTxt,
+    HelpTxt,
+    HintTxt,
+    MovesTxt,
+    OptimalMovesTxt,
+    UserMovesTxt,
+    RankTxt,
+    TimeRankTxt,
+    RankOfTxt,
+    HistoryTxt,
+    HistoryNodesTxt,
+    HistoryKibTxt,
+
+    // Screen texts
+    GreetingTitleTxt,
+    TitleInstrTxt,
+    MenuInstrTxt,
+    SettingsInstrTxt,
+    CelebrationInstrTxt,
+    SadInstrTxt,
+    PepTalkTxt,
+    EndingInstrTxt,
+    ArenaInstrTxt,
+    RestartBtnTxt,
+    NewGameBtnTxt,
+
+    // Menu texts
+    MenuNewGameTxt,
+    MenuArenaTxt,
+    MenuSettingsTxt,
+    MenuQuitTxt,
+
+    // Settings texts
+    BackToMenuTxt,
+    MainVolumeTxt,
+    BackgroundMusicOnTxt,
+    BackgroundMusicOffTxt,
+
+    // The size of the enum
+    SpriteN
+};
+
+/// @brief The font sizes of the pre-rasterized digits
+enum class DigitSize
+{
+    Small = 0,
+    Large,
+
+    // The size of the enum
+    DigitSizeN
+};
+
+/// @brief Gets the sprite of a puzzle piece
+/// @param num The number on the piece (1-based)
+/// @return The sprite of the piece
+inline Sprite GetPieceSprite(int num) { return static_cast<Sprite>(num - 1); }
+} // namespace gui
+
+/// @brief A single texture that holds every static sprite and text of the UI
+///
+/// The atlas is also bound as the shapes texture so rectangles and lines sample
+/// from it as well, which lets raylib merge the sprites and the shapes of a
+/// screen into one draw call. The raygui widgets of the settings draw their
+/// labels with the default font, so that screen still switches textures.
+class Atlas
+{
+public:
+    /// @brief Constructs the atlas
+    /// @param scale The ratio between the screen and the reference screen
+    explicit Atlas(float scale);
+
+    ~Atlas();
+
+    Atlas(const Atlas &) = delete;
+
+    Atlas &operator=(const Atlas &) = delete;
+
+    /// @brief Rasterizes all sprites again for a new scale
+    /// @param scale The ratio between the screen and the reference screen
+    void Build(float scale);
+
+    /// @brief Draws a sprite
+    /// @param sprite The sprite
+    /// @param position The top left corner of the sprite
+    /// @param tint The colour of the sprite
+    void Draw(gui::Sprite sprite, Vector2 position, Color tint) const;
+
+    /// @brief Draws a sprite stretched into a rectangle
+    /// @param sprite The sprite
+    /// @param dest The rectangle on the screen
+    /// @param tint The colour of the sprite
+    void DrawStretched(gui::Sprite sprite, const Rectangle &dest, Color tint) const;
+
+    /// @brief Draws a number with the pre-rasterized digits
+    /// @param value The number
+    /// @param minDigits The minimum number of digits (zero-padded)
+    /// @param size The size of the digits
+    /// @param position The top left corner of the number
+    /// @param tint The colour of the number
+    void DrawNumber(unsigned value, int minDigits, gui::DigitSize size, Vector2 position,
+                    Color tint) const;
+
+    /// @brief Gets the size of a sprite
+    /// @param sprite The sprite
+    /// @return The width and the height of the sprite
+    inline Vector2 GetSize(gui::Sprite sprite) const noexcept
+    {
+        const Rectangle &rec = recs_[static_cast<size_t>(sprite)];
+        return {rec.width, rec.height};
+    }
+
+    /// @brief Measures the width of a number drawn with DrawNumber
+    /// @param value The number
+    /// @param minDigits The minimum number of digits (zero-padded)
+    /// @param size The size of the digits
+    /// @return The width of the number
+    float MeasureNumber(unsigned value, int minDigits, gui::DigitSize size) const;
+
+private:
+    /// @brief The texture that holds all sprites
+    Texture2D texture_;
+
+    /// @brief The source rectangles of all sprites
+    std::array<Rectangle, std::to_underlying(gui::Sprite::SpriteN)> recs_;
+
+    /// @brief The source rectangles of the digits of each size
+    std::array<std::array<Rectangle, 10>, std::to_underlying(gui::DigitSize::DigitSizeN)>
+        digitRecs_;
+
+    /// @brief The spacing between the digits of each size
+    std::array<float, std::to_underlying(gui::DigitSize::DigitSizeN)> digitSpacing_;
+
+    /// @brief The source rectangle of the white pixel used for shapes
+    Rectangle whiteRec_;
+};
+
+#endif // INCLUDE_GUI_ATLASLIB_H_
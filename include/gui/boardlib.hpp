@@ -1,29 +1,56 @@
 #ifndef INCLUDE_GUI_BOARDLIB_H_
 #define INCLUDE_GUI_BOARDLIB_H_
 
-#include <memory> // std::shared_ptr
-#include <stack>  // std::stack
+#include <cstdint> // std::int64_t
+#include <memory>  // std::unique_ptr
+#include <vector>  // std::vector
 
 #include "raylib.h"
 #include "slidr/constants/constantslib.hpp" // constants::EMPTY
-#include "slidr/node/nodelib.hpp"           // Node, GetState()
 
+#include "creator/importerlib.hpp"       // creator::PuzzleImporter
+#include "creator/puzzlepacklib.hpp"     // creator::PuzzlePack
+#include "gui/atlaslib.hpp"
 #include "gui/buttonlib.hpp"
-
-namespace gui
-{
-constexpr int boardWidth = 500;
-constexpr int boardHeight = 500;
-constexpr int borderThickness = 10;
-} // namespace gui
+#include "gui/inputlib.hpp"              // gui::InputQueue
+#include "gui/layoutlib.hpp"
+#include "gui/timelinelib.hpp"           // Timeline
+#include "search/bidirectionallib.hpp"   // search::BidirectionalSearch, search::Algorithm
+#include "search/distancelib.hpp"        // search::DistanceTable
+#include "search/idastarlib.hpp"         // search::IdaStar
+#include "search/nodearenalib.hpp"       // search::NodeArena, search::NodeIndex
+#include "search/packedstatelib.hpp"     // search::PackedState
+#include "search/parallelidastarlib.hpp" // search::ParallelIdaStar
+#include "search/solutioncachelib.hpp"   // search::SolutionCache
+#include "stats/statslib.hpp"            // stats::GameRecord
+#include "utils/randomlib.hpp"           // Xoshiro256
+#include "utils/threadpoollib.hpp"       // ThreadPool
 
 class Board
 {
 public:
-    Board();
+    /// @brief Constructs the board and solves its first puzzle
+    /// NOTE: touches neither the GPU nor the audio device, so it can run on the pool
+    /// @param atlas The atlas that holds the pieces and the texts
+    /// @param layout The layout of the screens
+    /// @param distanceTable The table that answers the hints
+    /// @param solutionCache The cache of the solutions shared between the boards
+    /// @param puzzlePack The pack the puzzles come from, starting at today's one
+    /// @param puzzleImporter The imported puzzles, played before the ones of the pack
+    /// @param rng The generator of the puzzles when the pack is not loaded
+    /// @param algorithm The solver of the new puzzles that are not in the pack or the cache
+    /// @param pool The pool that runs the parallel solver
+    /// @param input The input of the frame
+    Board(const Atlas &atlas, const gui::Layout &layout, const search::DistanceTable &distanceTable,
+          search::SolutionCache &solutionCache, const creator::PuzzlePack &puzzlePack,
+          creator::PuzzleImporter &puzzleImporter, Xoshiro256 rng, search::Algorithm algorithm,
+          ThreadPool &pool, gui::InputQueue &input);
 
     ~Board();
 
+    /// @brief Loads the sound effects and starts the background music (main thread only)
+    void LoadAudio();
+
     /// @brief Updates the state
     void Update();
 
@@ -47,12 +74,20 @@ public:
     /// @return True if the game is finished
     inline bool RequestedHelp() noexcept { return requestedHelp_; }
 
+    /// @brief Checks if a piece is sliding
+    /// @return True if a piece is sliding
+    inline bool IsAnimating() const noexcept { return timeline_.IsAnimating(); }
+
     /// @brief Resets the board
     void Reset();
 
     /// @brief Restarts the board
     void Restart();
 
+    /// @brief Gets the record of the finished game
+    /// @return The record, the user moves are the ones made before asking for help
+    stats::GameRecord GetRecord() const;
+
     /// @brief Enable the background music
     void EnableBackgroundMusic() const;
 
@@ -65,82 +100,92 @@ private:
     /// @return The button that is pressed
     gui::Button CheckWhichButtonIsPressed(const Vector2 &mousePos);
 
-    /// @brief Draw the board
-    void DrawBoard() const;
-
-private:
-    /// @brief The width of the main screen
-    int screenWidth_;
-
-    /// @brief The height of the main screen
-    int screenHeight_;
+    /// @brief Gets an optimal solution from the cache or the solver
+    /// @param node The index of the node to solve, the start layout if its depth is 0
+    /// @return The directions of the empty piece
+    std::vector<short> FindSolution(search::NodeIndex node);
 
-    /// @brief the texture of the board pieces
-    Texture2D numbers_;
+    /// @brief Drops the old nodes, then takes the next imported puzzle, the next one of the pack
+    /// or generates and solves one
+    /// @return The index of the start node of the puzzle, the solution is ready as well
+    search::NodeIndex StartNextPuzzle();
 
-    /// @brief the width of the board
-    int boardWidth__;
+    /// @brief Moves the empty piece and shows the slide
+    /// @param dir The direction of the empty piece
+    /// @return TRUE if the empty piece could move that way
+    bool MakeMove(short dir);
 
-    /// @brief the height of the board
-    int boardHeight_;
+    /// @brief Updates the state of a button
+    /// @param button The button
+    /// @param hovered The button under the cursor
+    /// @param clicked The button that was clicked in this frame, see gui::ClickTracker
+    /// @param state The state of the button
+    /// @return TRUE if the button was clicked
+    bool UpdateButton(gui::Button button, gui::Button hovered, gui::Button clicked,
+                      gui::ButtonState &state) const;
 
-    /// @brief the thickness of the boarder of the board
-    int borderThickness_;
+    /// @brief Steps back to the layout before the last move
+    void Undo();
 
-    /// @brief the x position of the board
-    float boxX_;
+    /// @brief Steps forward to the layout that the last undo left
+    void Redo();
 
-    /// @brief the y position of the board
-    float boxY_;
+    /// @brief Jumps to a layout that was visited before without a slide
+    /// @param index The index of the node of the layout
+    void JumpTo(search::NodeIndex index);
 
-    /// @brief the width of the board“
-    float buttonWidth_;
+    /// @brief Highlights the piece that the optimal next move slides
+    void ShowHint();
 
-    /// @brief the height of the board
-    float buttonHeight_;
+    /// @brief Draw the board
+    void DrawBoard() const;
 
-    /// @brief the x position of the undo button
-    float undoBtnX_;
+    /// @brief Draw the number of moves above the board
+    void DrawMoves() const;
 
-    /// @brief the y position of the undo button
-    float undoBtnY_;
+    /// @brief Draw the memory footprint of the moves below the board
+    void DrawHistoryStats() const;
 
-    /// @brief the x position of the restart button
-    float restartBtnX_;
+private:
+    /// @brief The atlas that holds the pieces and the texts
+    const Atlas &atlas_;
 
-    /// @brief the y position of the restart button
-    float restartBtnY_;
+    /// @brief The layout of the screens
+    const gui::Layout &layout_;
 
-    /// @brief the x position of the help button
-    float helpBtnX_;
+    /// @brief The input of the frame, which also measures the latency of the moves
+    gui::InputQueue &input_;
 
-    /// @brief the y position of the help button
-    float helpBtnY_;
+    /// @brief The table that answers the hints
+    const search::DistanceTable &distanceTable_;
 
-    /// @brief the number of grids in the board
-    int N_;
+    /// @brief The cache of the solutions shared between the boards
+    search::SolutionCache &solutionCache_;
 
-    /// @brief the width of each grid in the board
-    float cellWidth_;
+    /// @brief The pack the puzzles come from
+    const creator::PuzzlePack &puzzlePack_;
 
-    /// @brief the height of each grid in the board
-    float cellHeight_;
+    /// @brief The imported puzzles, solved in the background
+    creator::PuzzleImporter &puzzleImporter_;
 
-    /// @brief the width
-    float w;
+    /// @brief The day the pack sequence was started on
+    std::int64_t packDay_;
 
-    /// @brief the height
-    float h;
+    /// @brief The number of puzzles of the pack played since the daily one of packDay_
+    size_t packOffset_;
 
-    /// @brief the width offset for the puzzle piece image
-    float offsetW_;
+    /// @brief The generator of the puzzles when the pack is not loaded
+    Xoshiro256 rng_;
 
-    /// @brief the height offset for the puzzle piece image
-    float offsetH_;
+    /// @brief the number of grids in the board
+    int N_;
 
-    std::vector<Rectangle> buttonPositions_;
+    /// @brief The nodes reached in the current puzzle, the start node is the first one
+    search::NodeArena nodes_;
 
-    std::stack<std::shared_ptr<Node>> history_;
+    /// @brief The node of the current layout, its parents lead back to the start and its first
+    /// children lead to where the user has undone from
+    search::NodeIndex current_;
 
     /// @brief The state of restart button
     gui::ButtonState restartBtnState_;
@@ -148,24 +193,58 @@ private:
     /// @brief The state of undo button
     gui::ButtonState undoBtnState_;
 
+    /// @brief The state of redo button
+    gui::ButtonState redoBtnState_;
+
     /// @brief The state of help button
     gui::ButtonState helpBtnState_;
 
+    /// @brief The state of hint button
+    gui::ButtonState hintBtnState_;
+
+    /// @brief Tells the clicks on the buttons from the drags
+    gui::ClickTracker clickTracker_;
+
     /// @brief The action of the restart button
     bool restartBtnAction_;
 
     /// @brief The action of the undo button
     bool undoBtnAction_;
 
+    /// @brief The action of the redo button
+    bool redoBtnAction_;
+
     /// @brief The action of the help button
     bool helpBtnAction_;
 
+    /// @brief The action of the hint button
+    bool hintBtnAction_;
+
+    /// @brief The position of the highlighted piece, noHint if there is none
+    int hintedPiece_;
+
+    /// @brief True if the memory footprint of the moves is shown
+    bool showHistoryStats_;
+
     /// @brief True if the puzzle is solved
     bool isSolved_;
 
     /// @brief True if the user requests for help
     bool requestedHelp_;
 
+    /// @brief The solver that keeps what it learned about the current puzzle
+    search::IdaStar solver_;
+
+    /// @brief The solver of the puzzles and of the help
+    search::Algorithm algorithm_;
+
+    /// @brief The solver when the algorithm is BIDIRECTIONAL_BFS, null otherwise
+    std::unique_ptr<search::BidirectionalSearch> bidirectionalPtr_;
+
+    /// @brief The solver when the algorithm is PARALLEL_IDA_STAR, null otherwise
+    /// NOTE: its table and heuristics are only built when they are used
+    std::unique_ptr<search::ParallelIdaStar> parallelPtr_;
+
     /// @brief The iterator that points to the solution
     std::vector<short>::const_iterator itr_;
 
@@ -178,6 +257,18 @@ private:
     /// @brief The optimal moves for the puzzle
     unsigned optimalMoves_;
 
+    /// @brief The packed start layout
+    search::PackedState startState_;
+
+    /// @brief The time the user has played the current attempt in seconds
+    float playTime_;
+
+    /// @brief The slides of the pieces
+    Timeline timeline_;
+
+    /// @brief The time since the last step of the solution playback in seconds
+    float solutionTimer_;
+
     /// @brief The sound effect for buttons
     Sound fxButton_;
 
@@ -26,7 +26,9 @@ enum class Button
     NewGame,
     Restart,
     Undo,
+    Redo,
     Help,
+    Hint,
 
     Invalid,
 
@@ -41,6 +43,43 @@ enum class ButtonState
     Selected
 };
 
+/// @brief Tells a click from a drag: a click is pressed and released over the same button
+class ClickTracker
+{
+public:
+    ClickTracker() : pressed_(Button::Invalid) {}
+
+    /// @brief Follows the left button through a frame
+    /// @param hovered The button under the cursor, Button::Invalid if there is none
+    /// @param wasPressed TRUE if the left button went down in the frame
+    /// @param wasReleased TRUE if the left button went up in the frame
+    /// @return The button that was clicked, Button::Invalid if there was no click
+    inline Button Update(Button hovered, bool wasPressed, bool wasReleased) noexcept
+    {
+        if (wasPressed)
+        {
+            pressed_ = hovered;
+        }
+
+        if (!wasReleased)
+        {
+            return Button::Invalid;
+        }
+
+        const Button clicked = (hovered == pressed_) ? hovered : Button::Invalid;
+        pressed_ = Button::Invalid;
+
+        return clicked;
+    }
+
+    /// @brief Forgets the press, e.g. when the screen is entered with the button held
+    inline void Reset() noexcept { pressed_ = Button::Invalid; }
+
+private:
+    /// @brief The button under the cursor when the left button went down
+    Button pressed_;
+};
+
 } // namespace gui
 
 #endif // INCLUDE_GUI_BUTTONLIB_H_
@@ -4,8 +4,9 @@
 #include <array>  // std::array
 #include <vector> // std::vector
 
-#include "gui/colourlib.hpp" // LIGHT_CORAL, APRICOT, LEMON, etc.
-#include "raylib.h"          // Vector2
+#include "gui/colourlib.hpp"   // LIGHT_CORAL, APRICOT, LEMON, etc.
+#include "raylib.h"            // Vector2
+#include "utils/randomlib.hpp" // Xoshiro256
 
 namespace
 {
@@ -15,7 +16,9 @@ constexpr std::size_t MAX_NUM_CONFETTI = 400;
 class Celebration
 {
 public:
-    Celebration();
+    /// @brief Constructs the celebration
+    /// @param rng The generator of the confetti
+    explicit Celebration(Xoshiro256 rng);
 
     ~Celebration();
 
@@ -67,6 +70,9 @@ private:
     /// @brief the confetti container
     std::array<Confetti, MAX_NUM_CONFETTI> confetti_;
 
+    /// @brief The generator of the confetti
+    Xoshiro256 rng_;
+
     /// @brief The applause sound effect
     Sound fxApplause_;
 };
@@ -24,5 +24,6 @@
 #define DARK_GREEN CLITERAL(Color){0, 77, 64, 255}
 #define BURNT_SIENNA CLITERAL(Color){139, 58, 38, 255}
 #define DARK_SEPIACLITERAL CLITERAL(Color){117, 89, 0, 255}
+#define DARK_LAVENDER CLITERAL(Color){86, 52, 168, 255}
 
 #endif // INCLUDE_GUI_COLORLIB_H_
@@ -0,0 +1,246 @@
+#ifndef INCLUDE_GUI_GAMESCREENSLIB_H_
+#define INCLUDE_GUI_GAMESCREENSLIB_H_
+
+#include <future>   // std::future
+#include <memory>   // std::unique_ptr
+#include <mutex>    // std::once_flag
+#include <optional> // std::optional
+
+#include "raylib.h" // Color, Rectangle
+
+#include "creator/importerlib.hpp"        // creator::PuzzleImporter
+#include "creator/puzzlepacklib.hpp"      // creator::PuzzlePack
+#include "gui/atlaslib.hpp"               // Atlas, gui::Sprite
+#include "gui/boardlib.hpp"               // Board
+#include "gui/inputlib.hpp"               // gui::InputQueue
+#include "gui/layoutlib.hpp"              // gui::Layout
+#include "gui/screenlib.hpp"              // Screen
+#include "gui/settingslib.hpp"            // Settings
+#include "search/distancelib.hpp"         // search::DistanceTable
+#include "search/solutioncachelib.hpp"    // search::SolutionCache
+#include "stats/leaderboardlib.hpp"       // stats::Leaderboard, stats::Standing
+#include "stats/leaderboardserverlib.hpp" // stats::LeaderboardClient
+#include "stats/statslib.hpp"             // stats::StatsLog
+#include "utils/randomlib.hpp"            // RandomService
+#include "utils/threadpoollib.hpp"        // ThreadPool
+
+/// @brief The objects that are shared by several screens
+///
+/// The expensive objects are only built the first time a screen asks for them,
+/// so a screen that is never visited costs nothing.
+class ScreenContext
+{
+public:
+    /// @brief Constructs the context
+    /// @param atlas The atlas that holds every static sprite and text
+    /// @param layout The layout of the screens
+    /// @param solutionCache The cache of the solutions of the boards
+    /// @param pool The pool that runs the parallel work of the screens
+    /// @param statsLog The log of the completed games
+    /// @param random The service that seeds the generators of the screens
+    /// @param puzzlePack The pack of the daily puzzles
+    /// @param puzzleImporter The puzzles imported from the command line
+    /// @param input The input of the frame
+    /// @param algorithm The solver of the new puzzles of the board
+    ScreenContext(const Atlas &atlas, const gui::Layout &layout,
+                  search::SolutionCache &solutionCache, ThreadPool &pool,
+                  stats::StatsLog &statsLog, const RandomService &random,
+                  const creator::PuzzlePack &puzzlePack, creator::PuzzleImporter &puzzleImporter,
+                  gui::InputQueue &input, search::Algorithm algorithm);
+
+    ~ScreenContext();
+
+    /// @brief Gets the atlas
+    /// @return The atlas
+    inline const Atlas &GetAtlas() const noexcept { return atlas_; }
+
+    /// @brief Gets the layout of the screens
+    /// @return The layout
+    inline const gui::Layout &GetLayout() const noexcept { return layout_; }
+
+    /// @brief Gets the input of the frame
+    /// @return The input
+    inline gui::InputQueue &GetInput() noexcept { return input_; }
+
+    /// @brief Gets the thread pool
+    /// @return The thread pool
+    inline ThreadPool &GetThreadPool() noexcept { return pool_; }
+
+    /// @brief Gets the service that seeds the generators
+    /// @return The service
+    inline const RandomService &GetRandomService() const noexcept { return random_; }
+
+    /// @brief Gets the log of the completed games
+    /// @return The log
+    inline stats::StatsLog &GetStatsLog() noexcept { return statsLog_; }
+
+    /// @brief Gets the distance table and builds it if needed
+    /// NOTE: safe to call from the board being built on the pool
+    /// @return The distance table
+    const search::DistanceTable &GetDistanceTable();
+
+    /// @brief Starts building the board on the background thread of the pool
+    /// @return TRUE once the board is built and GetBoard() no longer has to wait
+    bool PrepareBoard();
+
+    /// @brief Gets the board, waits for it or constructs it if needed and loads its audio
+    /// @return The board
+    Board &GetBoard();
+
+    /// @brief Gets the settings and constructs them if needed
+    /// @return The settings
+    Settings &GetSettings();
+
+    /// @brief Adds a game solved without help to the leaderboard on the pool
+    ///
+    /// The leaderboard shared by the kiosks on this host is used when its
+    /// server is running, a local one otherwise.
+    /// @param record The record of the game
+    void SubmitToLeaderboard(const stats::GameRecord &record);
+
+    /// @brief Gets where the last submitted game stands
+    /// @return The standing, nullopt until the leaderboard answers
+    std::optional<stats::Standing> GetLastStanding() const;
+
+    /// @brief Asks the game to close the window
+    inline void RequestClose() noexcept { close_ = true; }
+
+    /// @brief Checks if a screen has asked to close the window
+    /// @return TRUE if the window should be closed
+    inline bool IsCloseRequested() const noexcept { return close_; }
+
+    /// @brief Draws a text sprite centred horizontally
+    /// @param sprite The text sprite
+    /// @param y The y position of the text
+    /// @param colour The colour of the text
+    void DrawCentredText(gui::Sprite sprite, float y, Color colour) const;
+
+    /// @brief Draws a white text sprite in the centre of a box
+    /// @param sprite The text sprite
+    /// @param box The box
+    void DrawTextInBox(gui::Sprite sprite, const Rectangle &box) const;
+
+private:
+    /// @brief The atlas that holds every static sprite and text
+    const Atlas &atlas_;
+
+    /// @brief The positions of everything on every screen
+    const gui::Layout &layout_;
+
+    /// @brief The cache of the solutions of the boards
+    search::SolutionCache &solutionCache_;
+
+    /// @brief The pool that runs the parallel work of the screens
+    ThreadPool &pool_;
+
+    /// @brief The log of the completed games
+    stats::StatsLog &statsLog_;
+
+    /// @brief The service that seeds the generators of the screens
+    const RandomService &random_;
+
+    /// @brief The pack of the daily puzzles
+    const creator::PuzzlePack &puzzlePack_;
+
+    /// @brief The puzzles imported from the command line
+    creator::PuzzleImporter &puzzleImporter_;
+
+    /// @brief The input of the frame
+    gui::InputQueue &input_;
+
+    /// @brief The solver of the new puzzles of the board
+    search::Algorithm algorithm_;
+
+    /// @brief Builds the distance table exactly once, whichever thread asks first
+    std::once_flag distanceTableOnce_;
+
+    /// @brief The table that answers the hints of the board and drives the arena
+    std::unique_ptr<search::DistanceTable> distanceTablePtr_;
+
+    /// @brief The board shared by the GAMEPLAY, HELP, CELEBRATION and ENDING screens
+    /// NOTE: only touched by the pool while boardBuild_ is pending
+    std::unique_ptr<Board> boardPtr_;
+
+    /// @brief The build of the board on the pool, invalid when there is none pending
+    std::future<void> boardBuild_;
+
+    /// @brief The settings shared by the SETTINGS and GAMEPLAY screens
+    std::unique_ptr<Settings> settingsPtr_;
+
+    /// @brief The client of the leaderboard shared by the kiosks
+    stats::LeaderboardClient leaderboardClient_;
+
+    /// @brief The local leaderboard, only opened when the shared one cannot be reached
+    /// NOTE: only touched by the pool
+    std::unique_ptr<stats::Leaderboard> leaderboardPtr_;
+
+    /// @brief Where the last submitted game stands
+    /// NOTE: only touched by the pool while lastSubmit_ is pending
+    std::optional<stats::Standing> lastStanding_;
+
+    /// @brief The submission of the last game on the pool, invalid before the first one
+    std::future<void> lastSubmit_;
+
+    /// @brief TRUE if the user selects QUIT
+    bool close_;
+};
+
+namespace gui
+{
+/// @brief Creates the LOGO screen
+/// @param context The shared objects
+/// @return The screen
+std::unique_ptr<Screen> CreateLogoScreen(ScreenContext &context);
+
+/// @brief Creates the TITLE screen
+/// @param context The shared objects
+/// @return The screen
+std::unique_ptr<Screen> CreateTitleScreen(ScreenContext &context);
+
+/// @brief Creates the MENU screen
+/// @param context The shared objects
+/// @return The screen
+std::unique_ptr<Screen> CreateMenuScreen(ScreenContext &context);
+
+/// @brief Creates the SETTINGS screen
+/// @param context The shared objects
+/// @return The screen
+std::unique_ptr<Screen> CreateSettingsScreen(ScreenContext &context);
+
+/// @brief Creates the GAMEPLAY screen
+/// @param context The shared objects
+/// @return The screen
+std::unique_ptr<Screen> CreateGameplayScreen(ScreenContext &context);
+
+/// @brief Builds the heavy parts of the GAMEPLAY screen on the pool
+/// @param context The shared objects
+/// @return TRUE once CreateGameplayScreen() no longer has to wait for them
+bool PrepareGameplayScreen(ScreenContext &context);
+
+/// @brief Creates the HELP screen
+/// @param context The shared objects
+/// @return The screen
+std::unique_ptr<Screen> CreateHelpScreen(ScreenContext &context);
+
+/// @brief Creates the SAD screen
+/// @param context The shared objects
+/// @return The screen
+std::unique_ptr<Screen> CreateSadScreen(ScreenContext &context);
+
+/// @brief Creates the CELEBRATION screen
+/// @param context The shared objects
+/// @return The screen
+std::unique_ptr<Screen> CreateCelebrationScreen(ScreenContext &context);
+
+/// @brief Creates the ENDING screen
+/// @param context The shared objects
+/// @return The screen
+std::unique_ptr<Screen> CreateEndingScreen(ScreenContext &context);
+
+/// @brief Creates the ARENA screen
+/// @param context The shared objects
+/// @return The screen
+std::unique_ptr<Screen> CreateArenaScreen(ScreenContext &context);
+} // namespace gui
+
+#endif // INCLUDE_GUI_GAMESCREENSLIB_H_
@@ -0,0 +1,81 @@
+#ifndef INCLUDE_GUI_HITGRIDLIB_H_
+#define INCLUDE_GUI_HITGRIDLIB_H_
+
+#include <array>   // std::array
+#include <cstdint> // std::uint8_t
+
+#include "raylib.h" // Rectangle, Vector2
+
+namespace gui
+{
+/// @brief The value returned when nothing is under the cursor
+constexpr int noHit = -1;
+
+/// @brief Finds the cell of a uniform grid that contains a point
+/// @param box The rectangle covered by the grid
+/// @param cols The number of columns
+/// @param rows The number of rows
+/// @param pos The point
+/// @return The row-major index of the cell, noHit if the point is outside the grid
+int GetCellIndex(const Rectangle &box, int cols, int rows, Vector2 pos) noexcept;
+} // namespace gui
+
+/// @brief A coarse spatial grid that maps the cursor to the widget under it
+///
+/// Every widget is registered in the cells its rectangle overlaps, so a query
+/// only has to look at the few widgets of one cell instead of all of them.
+class HitGrid
+{
+public:
+    /// @brief The number of columns and rows of the grid
+    static constexpr int gridSize = 8;
+
+    /// @brief The maximum number of widgets
+    static constexpr int maxWidgets = 16;
+
+    /// @brief The maximum number of widgets that can overlap one cell
+    static constexpr int maxWidgetsPerCell = 4;
+
+    /// @brief Constructs an empty grid that covers nothing
+    HitGrid();
+
+    /// @brief Removes every widget and sets the area covered by the grid
+    /// @param bounds The area covered by the grid (usually the whole screen)
+    void Reset(const Rectangle &bounds);
+
+    /// @brief Registers a widget
+    /// @param id The id that is returned when the widget is hit (non-negative)
+    /// @param rec The rectangle of the widget
+    /// @return FALSE if the grid is full and the widget could not be registered
+    bool Register(int id, const Rectangle &rec);
+
+    /// @brief Finds the widget under a point
+    /// @param pos The point
+    /// @return The id of the widget, gui::noHit if there is none
+    int Query(Vector2 pos) const noexcept;
+
+private:
+    /// @brief The widgets registered in a cell
+    struct Cell
+    {
+        std::array<std::uint8_t, maxWidgetsPerCell> widgets;
+        std::uint8_t count;
+    };
+
+    /// @brief The area covered by the grid
+    Rectangle bounds_;
+
+    /// @brief The cells in row-major order
+    std::array<Cell, gridSize * gridSize> cells_;
+
+    /// @brief The rectangles of the widgets
+    std::array<Rectangle, maxWidgets> recs_;
+
+    /// @brief The ids of the widgets
+    std::array<int, maxWidgets> ids_;
+
+    /// @brief The number of registered widgets
+    int numOfWidgets_;
+};
+
+#endif // INCLUDE_GUI_HITGRIDLIB_H_
@@ -0,0 +1,174 @@
+#ifndef INCLUDE_GUI_INPUTLIB_H_
+#define INCLUDE_GUI_INPUTLIB_H_
+
+#include <array>   // std::array
+#include <cstdint> // std::uint32_t, std::uint64_t
+#include <span>    // std::span
+#include <vector>  // std::vector
+
+#include "raylib.h" // Vector2
+
+namespace gui
+{
+/// @brief The kinds of input the screens react to
+enum struct InputKind : int
+{
+    MOUSE_MOVED = 0, // the cursor is somewhere else than in the last frame
+    MOUSE_PRESSED,   // the left button went down
+    MOUSE_RELEASED,  // the left button went up
+    KEY_PRESSED      // a key went down
+};
+
+/// @brief The modifier keys held when the events of a frame were polled
+/// NOTE: raylib only keeps the state at the poll, so a modifier released within the frame is lost
+enum InputModifier : unsigned
+{
+    MODIFIER_CTRL = 1U << 0,
+    MODIFIER_SHIFT = 1U << 1
+};
+
+/// @brief Something the user did since the last frame
+struct InputEvent
+{
+    /// @brief The kind of the event
+    InputKind kind;
+
+    /// @brief The key of a KEY_PRESSED event, 0 otherwise
+    int key;
+
+    /// @brief The position of the cursor
+    Vector2 pos;
+
+    /// @brief The InputModifier bits
+    unsigned modifiers;
+
+    /// @brief The time the event was polled in seconds (on the GetTime() clock)
+    /// NOTE: the OS may have queued the event up to a frame before, which is not known
+    double timestamp;
+};
+
+/// @brief The distribution of the time from polling an input to presenting its response
+struct LatencySummary
+{
+    /// @brief The number of responses measured
+    std::uint64_t count;
+
+    /// @brief The average in milliseconds
+    double meanMs;
+
+    /// @brief The median in milliseconds (to the upper edge of its bucket)
+    double p50Ms;
+
+    /// @brief The 95th percentile in milliseconds (to the upper edge of its bucket)
+    double p95Ms;
+
+    /// @brief The longest in milliseconds
+    double maxMs;
+};
+
+/// @brief The input of a frame, polled once and read by every screen
+///
+/// raylib only keeps the state of the last poll, so screens that poll on their
+/// own each have to remember what they saw before and disagree about a click
+/// that spans two screens. The queue turns the state into events once per
+/// frame instead. An event is stamped when the queue polls it, so when a
+/// screen responds to it the time until the frame with the response is
+/// presented is the poll-to-present latency, kept here as a histogram. It
+/// covers the update and the draw of the game but not the time the event
+/// waited in the OS before the poll or the scan-out of the display, so it is
+/// a lower bound on the click-to-photon latency.
+class InputQueue
+{
+public:
+    InputQueue();
+
+    /// @brief Builds the events of this frame (called before any screen updates)
+    void Poll();
+
+    /// @brief Gets the events of this frame in the order they are polled
+    /// @return The events
+    inline std::span<const InputEvent> GetEvents() const noexcept { return events_; }
+
+    /// @brief Finds the first event of a kind in this frame
+    /// @param kind The kind of the event
+    /// @return The event, nullptr if there is none
+    const InputEvent *Find(InputKind kind) const noexcept;
+
+    /// @brief Finds the press of a key in this frame
+    /// @param key The key
+    /// @return The event, nullptr if the key was not pressed
+    const InputEvent *FindKey(int key) const noexcept;
+
+    /// @brief Checks if a key was pressed in this frame
+    /// @param key The key
+    /// @return TRUE if the key was pressed
+    inline bool WasKeyPressed(int key) const noexcept { return FindKey(key) != nullptr; }
+
+    /// @brief Checks if the left button went down in this frame
+    /// @return TRUE if the left button went down
+    inline bool WasMousePressed() const noexcept
+    {
+        return Find(InputKind::MOUSE_PRESSED) != nullptr;
+    }
+
+    /// @brief Checks if the left button went up in this frame
+    /// @return TRUE if the left button went up
+    inline bool WasMouseReleased() const noexcept
+    {
+        return Find(InputKind::MOUSE_RELEASED) != nullptr;
+    }
+
+    /// @brief Checks if the cursor moved in this frame
+    /// @return TRUE if the cursor moved
+    inline bool HasMouseMoved() const noexcept { return Find(InputKind::MOUSE_MOVED) != nullptr; }
+
+    /// @brief Gets the position of the cursor
+    /// @return The position of the cursor
+    inline Vector2 GetMousePos() const noexcept { return mousePos_; }
+
+    /// @brief Checks if the left button is held
+    /// @return TRUE if the left button is held
+    inline bool IsMouseDown() const noexcept { return isMouseDown_; }
+
+    /// @brief Starts measuring the latency of an event whose response is drawn in this frame
+    /// @param event The event
+    void TrackLatency(const InputEvent &event) noexcept;
+
+    /// @brief Ends the measurement once the frame is presented (called after EndDrawing)
+    void OnFramePresented() noexcept;
+
+    /// @brief Gets the distribution of the latencies measured so far
+    /// @return The summary
+    LatencySummary GetLatencySummary() const noexcept;
+
+private:
+    /// @brief The number of 1 ms buckets, the last one holds everything longer
+    static constexpr size_t numOfLatencyBuckets = 256;
+
+    /// @brief The events of this frame
+    std::vector<InputEvent> events_;
+
+    /// @brief The position of the cursor
+    Vector2 mousePos_;
+
+    /// @brief TRUE if the left button is held
+    bool isMouseDown_;
+
+    /// @brief The timestamp of the tracked event, negative if nothing is tracked
+    double trackedSince_;
+
+    /// @brief The number of latencies in each bucket
+    std::array<std::uint32_t, numOfLatencyBuckets> latencyBuckets_;
+
+    /// @brief The number of latencies measured
+    std::uint64_t latencyCount_;
+
+    /// @brief The sum of the latencies in seconds
+    double latencySum_;
+
+    /// @brief The longest latency in seconds
+    double latencyMax_;
+};
+} // namespace gui
+
+#endif // INCLUDE_GUI_INPUTLIB_H_
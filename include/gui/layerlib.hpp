@@ -0,0 +1,64 @@
+#ifndef INCLUDE_GUI_LAYERLIB_H_
+#define INCLUDE_GUI_LAYERLIB_H_
+
+#include <cstdint> // std::uint64_t
+
+#include "raylib.h" // RenderTexture2D, Color
+
+/// @brief A retained layer that caches the static content of a screen
+///
+/// The content is rendered once into a render texture and only re-rendered when
+/// the key that describes the visual state of the screen changes.
+class Layer
+{
+public:
+    /// @brief Constructs the layer
+    /// @param width The width of the layer
+    /// @param height The height of the layer
+    /// @param background The colour the layer is cleared with before rendering
+    Layer(int width, int height, Color background);
+
+    ~Layer();
+
+    Layer(const Layer &) = delete;
+
+    Layer &operator=(const Layer &) = delete;
+
+    /// @brief Checks if the cached content is stale
+    /// @param key The key that describes the current visual state
+    /// @return TRUE if the layer has to be rendered again
+    inline bool NeedsRedraw(std::uint64_t key) const noexcept { return !valid_ || (key != key_); }
+
+    /// @brief Starts rendering into the layer
+    /// @param key The key that describes the visual state being rendered
+    void Begin(std::uint64_t key);
+
+    /// @brief Stops rendering into the layer
+    void End();
+
+    /// @brief Resizes the layer, the content is rendered again next time
+    /// @param width The new width of the layer
+    /// @param height The new height of the layer
+    void Resize(int width, int height);
+
+    /// @brief Forces the layer to be rendered again next time
+    inline void Invalidate() noexcept { valid_ = false; }
+
+    /// @brief Draws the cached content on the screen
+    void Draw() const;
+
+private:
+    /// @brief The render texture that holds the content
+    RenderTexture2D target_;
+
+    /// @brief The colour the layer is cleared with
+    Color background_;
+
+    /// @brief The key of the cached content
+    std::uint64_t key_;
+
+    /// @brief TRUE if the cached content is up to date
+    bool valid_;
+};
+
+#endif // INCLUDE_GUI_LAYERLIB_H_
@@ -0,0 +1,178 @@
+#ifndef INCLUDE_GUI_LAYOUTLIB_H_
+#define INCLUDE_GUI_LAYOUTLIB_H_
+
+#include <array> // std::array
+
+#include "raylib.h"                         // Rectangle, Vector2
+#include "slidr/constants/constantslib.hpp" // constants::EIGHT_PUZZLE_NUM
+
+#include "gui/atlaslib.hpp"   // Atlas
+#include "gui/hitgridlib.hpp" // HitGrid
+
+namespace gui
+{
+/// @brief The size of the screen that all the proportions are designed for
+constexpr float referenceSize = 1200.0f;
+
+// The proportions of the screens (in pixels of the reference screen)
+constexpr int boardWidth = 500;
+constexpr int boardHeight = 500;
+constexpr int borderThickness = 10;
+constexpr int boardBtnWidth = 200;
+constexpr int boardBtnHeight = 80;
+constexpr int boardBtnTxtPadding = 15;
+constexpr int menuBtnWidth = 250;
+constexpr int menuBtnHeight = 60;
+constexpr int menuBtnPadding = 10;
+constexpr int numOfMenuBtns = 4;
+constexpr int instrTxtY = 220;
+constexpr int arenaSize = 8;
+constexpr int arenaNumOfBoards = arenaSize * arenaSize;
+
+/// @brief The rectangles of the GAMEPLAY, HELP and CELEBRATION screens
+struct BoardLayout
+{
+    /// @brief The board
+    Rectangle box;
+
+    /// @brief Each grid in the board
+    std::array<Rectangle, constants::EIGHT_PUZZLE_NUM> cells;
+
+    /// @brief The undo button
+    Rectangle undoBtn;
+
+    /// @brief The redo button
+    Rectangle redoBtn;
+
+    /// @brief The restart button
+    Rectangle restartBtn;
+
+    /// @brief The help button
+    Rectangle helpBtn;
+
+    /// @brief The hint button
+    Rectangle hintBtn;
+
+    /// @brief The top left corner of the move counter
+    Vector2 movesTxt;
+
+    /// @brief The thickness of the border and the grid lines
+    float borderThickness;
+
+    /// @brief The padding between a button and its text
+    float btnTxtPadding;
+
+    /// @brief The optimal moves counter of the result
+    Rectangle optimalMovesCounter;
+
+    /// @brief The user moves counter of the result
+    Rectangle userMovesCounter;
+
+    /// @brief The leaderboard rank of the result by efficiency
+    Rectangle rankCounter;
+
+    /// @brief The leaderboard rank of the result by time
+    Rectangle timeRankCounter;
+
+    /// @brief The buttons next to the board, registered with their gui::Button
+    HitGrid hitGrid;
+};
+
+/// @brief The rectangles of the MENU screen
+struct MenuLayout
+{
+    /// @brief The buttons from top to bottom
+    std::array<Rectangle, numOfMenuBtns> btns;
+
+    /// @brief The buttons, registered with their index
+    HitGrid hitGrid;
+};
+
+/// @brief The rectangles of the SETTINGS screen
+struct SettingsLayout
+{
+    /// @brief The volume label
+    Rectangle volumeLabel;
+
+    /// @brief The volume slider bar
+    Rectangle volumeSliderBar;
+
+    /// @brief The checkbox for the background music
+    Rectangle backgroundCheckbox;
+
+    /// @brief The exit button
+    Rectangle exitBtn;
+
+    /// @brief The padding between a button and its text
+    float btnTxtPadding;
+};
+
+/// @brief The rectangles of the ENDING screen
+struct EndingLayout
+{
+    /// @brief The restart button
+    Rectangle restartBtn;
+
+    /// @brief The new game button
+    Rectangle newGameBtn;
+};
+
+/// @brief The rectangles of the ARENA screen
+struct ArenaLayout
+{
+    /// @brief The boards in row-major order
+    std::array<Rectangle, arenaNumOfBoards> boards;
+
+    /// @brief The padding between a board and its pieces
+    float piecePadding;
+};
+
+/// @brief The positions of everything on every screen for a given render size
+struct Layout
+{
+    /// @brief The width of the screen
+    int width;
+
+    /// @brief The height of the screen
+    int height;
+
+    /// @brief The ratio between the screen and the reference screen
+    float scale;
+
+    /// @brief The centre of the screen
+    Vector2 centre;
+
+    /// @brief The y position of the instructions on top of most screens
+    float instrTxtY;
+
+    /// @brief The GAMEPLAY, HELP and CELEBRATION screens
+    BoardLayout board;
+
+    /// @brief The MENU screen
+    MenuLayout menu;
+
+    /// @brief The SETTINGS screen
+    SettingsLayout settings;
+
+    /// @brief The ENDING screen
+    EndingLayout ending;
+
+    /// @brief The ARENA screen
+    ArenaLayout arena;
+};
+
+/// @brief Gets the ratio between a screen and the reference screen
+/// @param width The width of the screen
+/// @param height The height of the screen
+/// @return The ratio
+float GetLayoutScale(int width, int height);
+
+/// @brief Computes the layout of every screen
+/// @param width The width of the screen
+/// @param height The height of the screen
+/// @param atlas The atlas (built for the same scale) that is used to measure the texts
+/// @return The layout
+Layout ComputeLayout(int width, int height, const Atlas &atlas);
+} // namespace gui
+
+#endif // INCLUDE_GUI_LAYOUTLIB_H_
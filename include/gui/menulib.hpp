@@ -1,12 +1,15 @@
 #ifndef INCLUDE_GUI_MENULIB_H_
 #define INCLUDE_GUI_MENULIB_H_
 
-#include <array>       // std::array
-#include <string_view> // std::string_view
-#include <utility>     // std::pair
+#include <array>   // std::array
+#include <utility> // std::pair
 
 #include "raylib.h"
 
+#include "gui/atlaslib.hpp"  // Atlas, gui::Sprite
+#include "gui/inputlib.hpp"  // gui::InputQueue
+#include "gui/layoutlib.hpp" // gui::Layout, gui::numOfMenuBtns
+
 class Menu
 {
     /// @brief the colours of the button {selected, unselected}
@@ -16,13 +19,15 @@ class Menu
     struct Btn
     {
         BtnColours colours;
-        std::string_view txt;
-        Rectangle rec;
-        float txtLen;
+        gui::Sprite txt;
     };
 
 public:
-    Menu();
+    /// @brief Constructs the menu
+    /// @param atlas The atlas that holds the texts
+    /// @param layout The layout of the screens
+    /// @param input The input of the frame
+    Menu(const Atlas &atlas, const gui::Layout &layout, const gui::InputQueue &input);
 
     ~Menu();
 
@@ -36,18 +41,29 @@ public:
     /// @return The selection from the user, INT_MAX if the user has not pressed ENTER
     int GetSelection();
 
+    /// @brief Gets the option that is currently highlighted
+    /// @return The index of the highlighted option
+    inline int GetHighlightedOption() const noexcept { return selectedOption_; }
+
 private:
-    /// @brief The width of the main screen
-    int screenWidth_;
+    /// @brief The atlas that holds the texts
+    const Atlas &atlas_;
 
-    /// @brief The height of the main screen
-    int screenHeight_;
+    /// @brief The layout of the screens
+    const gui::Layout &layout_;
 
-    std::array<Btn, 3> btns_;
+    /// @brief The input of the frame
+    const gui::InputQueue &input_;
+
+    /// @brief The colours and the texts of the buttons (from top to bottom)
+    std::array<Btn, gui::numOfMenuBtns> btns_;
 
     /// @brief The current selected option index
     int selectedOption_;
 
+    /// @brief TRUE if the left button went down over the selected option
+    bool leftClickPressed_;
+
     /// @brief The sound effect for moving between buttons
     Sound fxMenuMove_;
 
@@ -1,13 +1,24 @@
 #ifndef INCLUDE_GUI_SCREENLIB_H_
 #define INCLUDE_GUI_SCREENLIB_H_
 
-#include <memory> // std::unique_ptr
-
-#include "gui/animationlib.hpp"
-#include "gui/boardlib.hpp"
-#include "gui/celebrationlib.hpp" // Celebration
-#include "gui/menulib.hpp"        // Menu
-#include "gui/settingslib.hpp"    // Settings
+#include <array>      // std::array
+#include <cstdint>    // std::uint64_t
+#include <functional> // std::function
+#include <memory>     // std::unique_ptr
+#include <string>     // std::string
+#include <utility>    // std::to_underlying
+#include <vector>     // std::vector
+
+#include "creator/importerlib.hpp"     // creator::PuzzleImporter
+#include "creator/puzzlepacklib.hpp"   // creator::PuzzlePack
+#include "gui/atlaslib.hpp"            // Atlas
+#include "gui/inputlib.hpp"            // gui::InputQueue
+#include "gui/layoutlib.hpp"           // gui::Layout
+#include "search/bidirectionallib.hpp" // search::Algorithm
+#include "search/solutioncachelib.hpp" // search::SolutionCache
+#include "stats/statslib.hpp"          // stats::StatsLog
+#include "utils/randomlib.hpp"         // RandomService
+#include "utils/threadpoollib.hpp"     // ThreadPool
 
 /// @brief The states of the game
 enum struct GameScreenState : int
@@ -20,81 +31,180 @@ enum struct GameScreenState : int
     HELP,
     SAD,
     CELEBRATION,
-    ENDING
+    ENDING,
+    ARENA
+};
+
+/// @brief The number of states of the game
+constexpr int numOfGameScreenStates = std::to_underlying(GameScreenState::ARENA) + 1;
+
+/// @brief How often the main loop has to tick
+enum struct FramePacing : int
+{
+    FULL = 0,    // something is animating
+    REDUCED,     // nothing moves but the audio stream still needs to be fed
+    EVENT_DRIVEN // nothing changes until the user does something
 };
 
+/// @brief When a screen is constructed
+enum struct ConstructionPolicy : int
+{
+    EAGER = 0,  // with the screen manager
+    BACKGROUND, // one screen per frame once the game is running
+    LAZY        // the first time the screen is entered
+};
+
+/// @brief A screen of the game
+class Screen
+{
+public:
+    virtual ~Screen() = default;
+
+    /// @brief Called when the screen becomes the current one
+    virtual void Enter() {}
+
+    /// @brief Called when another screen takes over
+    virtual void Exit() {}
+
+    /// @brief Updates the state
+    /// @return The state to go to, the state of this screen to stay
+    virtual GameScreenState Update() = 0;
+
+    /// @brief Renders whatever is cached off screen (called outside of BeginDrawing)
+    virtual void RefreshCache() {}
+
+    /// @brief Draws the screen
+    virtual void Draw() const = 0;
+
+    /// @brief Gets the frame pacing that the screen needs
+    /// @return The frame pacing
+    virtual FramePacing GetFramePacing() const noexcept { return FramePacing::EVENT_DRIVEN; }
+
+    /// @brief Fits whatever is cached to the new window size
+    /// @param width The width of the window
+    /// @param height The height of the window
+    virtual void Resize(int /*width*/, int /*height*/) {}
+};
+
+class ScreenContext;
+
 class ScreenManager
 {
 public:
-    ScreenManager();
+    /// @brief Called on every transition with the old and the new state
+    using TransitionHook = std::function<void(GameScreenState from, GameScreenState to)>;
+
+    /// @brief Constructs the screens
+    /// @param seed The master seed of every random number in the game
+    /// @param algorithm The solver of the new puzzles
+    /// @param importPath The file of the puzzles to play first, none if it is empty
+    ScreenManager(std::uint64_t seed, search::Algorithm algorithm, const std::string &importPath);
 
     ~ScreenManager();
 
     /// @brief Update the state
     void Update();
 
+    /// @brief Ends the latency measurement of the input answered in this frame
+    /// NOTE: called right after EndDrawing(), which presents the frame
+    void OnFramePresented();
+
     /// @brief Draw the the state on the screen
     void Draw() const;
 
     /// @brief Checks if the window should be closed
     /// @return TRUE if the window should be closed
-    inline bool GetWindowShouldBeClosed() const { return close_; }
+    bool GetWindowShouldBeClosed() const;
 
-private:
-    /// @brief Sets the background music based on user's choice
-    void SetBackgroundMusic();
+    /// @brief Gets the frame pacing that the current screen needs
+    /// @return The frame pacing
+    FramePacing GetFramePacing() const noexcept;
+
+    /// @brief Registers a function that is called on every transition
+    /// @param hook The function
+    void AddTransitionHook(TransitionHook hook);
 
 private:
-    /// @brief The current state of the game
-    GameScreenState curState_;
+    /// @brief Creates a screen
+    using ScreenFactory = std::unique_ptr<Screen> (*)(ScreenContext &context);
 
-    /// @brief The width of the main screen
-    int screenWidth_;
+    /// @brief Starts building the heavy parts of a screen off the main thread
+    /// @return TRUE once they are ready
+    using ScreenPreparer = bool (*)(ScreenContext &context);
 
-    /// @brief The height of the main screen
-    int screenHeight_;
+    /// @brief An entry of the dispatch table
+    struct ScreenSlot
+    {
+        /// @brief The screen, nullptr until it is constructed
+        std::unique_ptr<Screen> screen;
 
-    /// @brief The pointer that points to the ray animation class
-    std::unique_ptr<RaylibAnimation> raylibAnimationPtr_;
+        /// @brief Creates the screen
+        ScreenFactory factory;
 
-    /// @brief The pointer that points to the Board class
-    std::unique_ptr<Board> boardPtr_;
+        /// @brief When the screen is constructed
+        ConstructionPolicy policy;
 
-    /// @brief The pointer that points to the Menu class
-    std::unique_ptr<Menu> menuPtr_;
+        /// @brief Prepares the screen before a BACKGROUND construction, nullptr if not needed
+        ScreenPreparer prepare;
+    };
 
-    /// @brief The pointer that points to the Settings class
-    std::unique_ptr<Settings> settingsPtr_;
+    /// @brief Gets a screen and constructs it if needed
+    /// @param state The state of the screen
+    /// @return The screen
+    Screen &GetScreen(GameScreenState state);
 
-    /// @brief The pointer that points to the Celebration class
-    std::unique_ptr<Celebration> celebrationPtr_;
+    /// @brief Moves to another state and runs the transition hooks
+    /// @param next The next state
+    void ChangeState(GameScreenState next);
 
-    /// @brief The state of the restart button
-    gui::ButtonState restartBtnState_;
+    /// @brief Constructs the next screen that is preloaded in the background
+    void PreloadNextScreen();
 
-    /// @brief The state of the new game button
-    gui::ButtonState newGameBtnState_;
+    /// @brief Fits the atlas, the layout and the cached layers to the new window size
+    void Relayout();
 
-    /// @brief The restart button box
-    Rectangle restartBox_;
+private:
+    /// @brief The atlas that holds every static sprite and text
+    /// NOTE: declared first since the screens below depend on it
+    std::unique_ptr<Atlas> atlasPtr_;
 
-    /// @brief The new game button box
-    Rectangle newGameBox_;
+    /// @brief The positions of everything on every screen
+    /// NOTE: declared before the screens since they hold a reference to it
+    gui::Layout layout_;
 
-    /// @brief The action of the restart button
-    bool restartBtnAction_;
+    /// @brief The cache of the solutions of the boards
+    std::unique_ptr<search::SolutionCache> solutionCachePtr_;
 
-    /// @brief The action of the new game button
-    bool newGameBtnAction_;
+    /// @brief The pool that runs the parallel work of the screens
+    std::unique_ptr<ThreadPool> threadPoolPtr_;
 
-    /// @brief The text width of the restart
-    float restartTxtWidth_;
+    /// @brief The service that seeds the generators of the screens
+    std::unique_ptr<RandomService> randomServicePtr_;
 
-    /// @brief The text width of the new game
-    float newGameTxtWidth_;
+    /// @brief The log of the completed games
+    std::unique_ptr<stats::StatsLog> statsLogPtr_;
 
-    /// @brief TRUE if the user selects QUIT
-    bool close_;
+    /// @brief The pack of the daily puzzles, mapped at start-up
+    std::unique_ptr<creator::PuzzlePack> puzzlePackPtr_;
+
+    /// @brief The puzzles imported from the command line, read and solved in the background
+    std::unique_ptr<creator::PuzzleImporter> puzzleImporterPtr_;
+
+    /// @brief The input of the frame, polled once before any screen updates
+    std::unique_ptr<gui::InputQueue> inputPtr_;
+
+    /// @brief The objects shared by the screens
+    std::unique_ptr<ScreenContext> contextPtr_;
+
+    /// @brief The screens indexed by their state
+    /// NOTE: declared after the context so the screens go away first
+    std::array<ScreenSlot, numOfGameScreenStates> slots_;
+
+    /// @brief The functions that are called on every transition
+    std::vector<TransitionHook> transitionHooks_;
+
+    /// @brief The current state of the game
+    GameScreenState curState_;
 };
 
 #endif // INCLUDE_GUI_SCREENLIB_H_
@@ -1,24 +1,41 @@
 #ifndef INCLUDE_GUI_SETTINGSLIB_H_
 #define INCLUDE_GUI_SETTINGSLIB_H_
 
-#include <array> // std::array
+#include <array>   // std::array
+#include <cstdint> // std::uint64_t
 
 #include "raylib.h" // Rectangle
 
+#include "gui/atlaslib.hpp"  // Atlas, gui::Sprite
 #include "gui/buttonlib.hpp" // ButtonState
+#include "gui/inputlib.hpp"  // gui::InputQueue
+#include "gui/layoutlib.hpp" // gui::Layout
 
 class Settings
 {
 public:
-    Settings();
+    /// @brief Constructs the settings page
+    /// @param atlas The atlas that holds the texts
+    /// @param layout The layout of the screens
+    /// @param input The input of the frame
+    /// NOTE: raygui still polls raylib for the slider and the checkbox
+    Settings(const Atlas &atlas, const gui::Layout &layout, const gui::InputQueue &input);
 
     ~Settings();
 
     /// @brief Updates the state
     void Update();
 
-    /// @brief Draws the animation on the screen according to the current state
-    void Draw();
+    /// @brief Draws the labels and the exit button, which only change with the state key
+    void DrawStatic() const;
+
+    /// @brief Draws the interactive widgets (slider and checkbox)
+    /// NOTE: raygui handles the input while drawing, so these must be drawn every frame
+    void DrawWidgets();
+
+    /// @brief Gets the key that describes the look of the static content
+    /// @return The key of the static content
+    std::uint64_t GetStaticStateKey() const noexcept;
 
     /// @brief Checks if user wants to exit settings page
     /// @return TRUE if the user wants to exit settings page
@@ -29,11 +46,14 @@ public:
     bool GetBackgroundMusic() const;
 
 private:
-    /// @brief The width of the main screen
-    int screenWidth_;
+    /// @brief The atlas that holds the texts
+    const Atlas &atlas_;
+
+    /// @brief The layout of the screens
+    const gui::Layout &layout_;
 
-    /// @brief The height of the main screen
-    int screenHeight_;
+    /// @brief The input of the frame
+    const gui::InputQueue &input_;
 
     /// @brief The volume
     float volume_;
@@ -44,24 +64,12 @@ private:
     /// @brief The state of the exit button
     gui::ButtonState exitBtnState_;
 
-    /// @brief The width of the exit button
-    float exitBtnWidth_;
+    /// @brief The state of the exit button in the last frame, to play a sound when it changes
+    gui::ButtonState prevExitBtnState_;
 
     /// @brief The colours of the exit button
     std::array<Color, 3> btnColours_;
 
-    /// @brief The rectangle of the exit button
-    Rectangle exitBtnRec_;
-
-    /// @brief The rectangle of the volume label
-    Rectangle volumeLabelRec_;
-
-    /// @brief The rectangle of the volume slider bar
-    Rectangle volumeSliderBarRec_;
-
-    /// @brief The rectangle of the checkbox for the background music
-    Rectangle backgroundCheckboxRec_;
-
     /// @brief The sound effect for moving
     Sound fxMove_;
 
@@ -70,12 +78,6 @@ private:
 
     /// @brief The background sound effect enabled
     bool fxBackgroundEnabled_;
-
-    /// @brief The text length of the background music description
-    float backgroundMusicTxtLen_;
-
-    /// @brief The text length of the main volume description
-    float mainVolumeTxtLen_;
 };
 
 #endif // INCLUDE_GUI_SETTINGSLIB_H_
@@ -0,0 +1,95 @@
+#ifndef INCLUDE_GUI_TIMELINELIB_H_
+#define INCLUDE_GUI_TIMELINELIB_H_
+
+#include <array> // std::array
+#include <span>  // std::span
+
+#include "slidr/constants/constantslib.hpp" // constants::EIGHT_PUZZLE_NUM
+
+/// @brief A timeline that tweens the pieces of the board from one grid to another
+///
+/// The timeline keeps its own copy of the layout, which lags behind the real one
+/// while the slides are playing. Slides that come in while another one is playing
+/// are queued in a fixed ring buffer and played faster to catch up, so nothing
+/// is allocated after construction.
+class Timeline
+{
+public:
+    /// @brief The maximum number of queued slides
+    static constexpr size_t capacity = 16;
+
+    /// @brief The value returned when no piece is moving
+    static constexpr int noSlide = -1;
+
+    /// @brief Constructs the timeline
+    /// @param duration The duration of one slide in seconds
+    explicit Timeline(float duration);
+
+    /// @brief Jumps to a layout and drops all the slides
+    /// @param layout The layout of the puzzle
+    void Reset(std::span<const int> layout);
+
+    /// @brief Queues a slide
+    /// @param from The grid the piece slides from
+    /// @param to The grid the piece slides to (the empty grid)
+    void Push(int from, int to);
+
+    /// @brief Advances the slides
+    /// @param dt The time since the last frame in seconds
+    void Update(float dt);
+
+    /// @brief Checks if a piece is moving
+    /// @return TRUE if a slide is playing or queued
+    inline bool IsAnimating() const noexcept { return count_ > 0; }
+
+    /// @brief Gets the layout being shown (the moving piece is already at its target)
+    /// @return The layout
+    inline std::span<const int> GetLayout() const noexcept { return layout_; }
+
+    /// @brief Gets the grid the moving piece slides from
+    /// @return The grid, noSlide if no piece is moving
+    inline int GetMovingFrom() const noexcept
+    {
+        return (count_ > 0) ? slides_[head_].from : noSlide;
+    }
+
+    /// @brief Gets the grid the moving piece slides to
+    /// @return The grid, noSlide if no piece is moving
+    inline int GetMovingTo() const noexcept { return (count_ > 0) ? slides_[head_].to : noSlide; }
+
+    /// @brief Gets how far the moving piece is, with the easing applied
+    /// @return The progress in [0, 1]
+    float GetProgress() const noexcept;
+
+private:
+    /// @brief Starts the slide at the head of the queue
+    void StartSlide();
+
+private:
+    /// @brief A piece that slides from one grid to another
+    struct Slide
+    {
+        int from;
+        int to;
+    };
+
+    /// @brief The duration of one slide in seconds
+    float duration_;
+
+    /// @brief The time spent on the current slide in seconds
+    float elapsed_;
+
+    /// @brief The layout being shown
+    std::array<int, constants::EIGHT_PUZZLE_NUM> layout_;
+
+    /// @brief The queued slides (ring buffer)
+    std::array<Slide, capacity> slides_;
+
+    /// @brief The index of the slide that is playing
+    size_t head_;
+
+    /// @brief The number of queued slides, including the one that is playing
+    size_t count_;
+};
+
+#endif // INCLUDE_GUI_TIMELINELIB_H_
@@ -0,0 +1,121 @@
+#ifndef INCLUDE_SEARCH_BIDIRECTIONALLIB_H_
+#define INCLUDE_SEARCH_BIDIRECTIONALLIB_H_
+
+#include <cstdint> // std::uint64_t
+#include <span>    // std::span
+#include <vector>  // std::vector
+
+#include "search/packedstatelib.hpp" // search::PackedState
+
+namespace search
+{
+/// @brief The solvers that compute the optimal solution of a new puzzle
+enum struct Algorithm : int
+{
+    IDA_STAR = 0,      // depth first, the memory stays tiny
+    BIDIRECTIONAL_BFS, // breadth first from both ends, far fewer expansions on deep puzzles
+    PARALLEL_IDA_STAR  // depth first on every thread of the pool
+};
+
+/// @brief A breadth-first search that grows from the start and the goal until they meet
+///
+/// Each side only has to reach about half the depth, so a puzzle of d moves
+/// expands roughly 2 * b^(d/2) nodes instead of b^d. The visited states of
+/// each side live in an open-addressing set of single words (the packed state
+/// and the move that reached it), so a visited state costs one word instead of
+/// a node and a hash map entry.
+class BidirectionalSearch
+{
+public:
+    BidirectionalSearch();
+
+    /// @brief Solves a puzzle
+    /// @param layout The layout of the puzzle
+    /// @param posX The position of the empty piece
+    /// @return The directions of the empty piece of an optimal solution
+    std::vector<short> Solve(std::span<const int> layout, int posX);
+
+    /// @brief Gets the number of nodes expanded by the last search
+    /// @return The number of nodes
+    inline std::uint64_t GetExpandedNodes() const noexcept { return expandedNodes_; }
+
+    /// @brief Gets the most memory the visited sets and the frontiers of the last search used
+    /// @return The number of bytes
+    inline size_t GetPeakMemory() const noexcept { return peakMemory_; }
+
+private:
+    /// @brief The states one side of the search has visited
+    class VisitedSet
+    {
+    public:
+        VisitedSet();
+
+        /// @brief Forgets every state but keeps the memory
+        void Clear() noexcept;
+
+        /// @brief Adds a state if it is new
+        /// @param state The packed state
+        /// @param moveIdx The index into search::moves of the move that reached it
+        /// @return FALSE if the state was already visited
+        bool Insert(PackedState state, int moveIdx);
+
+        /// @brief Finds a state
+        /// @param state The packed state
+        /// @return The entry of the state, 0 if it was not visited
+        std::uint64_t Find(PackedState state) const noexcept;
+
+        /// @brief Gets the memory the set takes
+        /// @return The number of bytes
+        inline size_t GetMemory() const noexcept { return slots_.size() * sizeof(std::uint64_t); }
+
+    private:
+        /// @brief Doubles the capacity and reinserts every state
+        void Grow();
+
+        /// @brief The slots, 0 is empty (no packed state of a layout is 0)
+        std::vector<std::uint64_t> slots_;
+
+        /// @brief The number of used slots
+        size_t size_;
+    };
+
+    /// @brief Expands a whole layer of one side
+    /// @param frontier The states of the layer, replaced by the next layer
+    /// @param own The visited set of the side
+    /// @param other The visited set of the other side
+    /// @return The state where the sides met, 0 if they did not
+    PackedState ExpandLayer(std::vector<std::uint64_t> &frontier, VisitedSet &own,
+                            const VisitedSet &other);
+
+    /// @brief Follows the moves stored in a visited set back to its root
+    /// @param visited The visited set
+    /// @param state The state to start from
+    /// @return The indices into search::moves of the moves that reached each state on the way,
+    /// from the given state to the root
+    std::vector<int> TraceBack(const VisitedSet &visited, PackedState state) const;
+
+private:
+    /// @brief The states visited from the start
+    VisitedSet fromStart_;
+
+    /// @brief The states visited from the goal
+    VisitedSet fromGoal_;
+
+    /// @brief The layers being expanded from the start (state and position of the empty piece)
+    std::vector<std::uint64_t> startFrontier_;
+
+    /// @brief The layers being expanded from the goal
+    std::vector<std::uint64_t> goalFrontier_;
+
+    /// @brief Scratch space for the next layer
+    std::vector<std::uint64_t> next_;
+
+    /// @brief The number of nodes expanded by the last search
+    std::uint64_t expandedNodes_;
+
+    /// @brief The most memory the last search used in bytes
+    size_t peakMemory_;
+};
+} // namespace search
+
+#endif // INCLUDE_SEARCH_BIDIRECTIONALLIB_H_
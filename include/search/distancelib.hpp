@@ -0,0 +1,65 @@
+#ifndef INCLUDE_SEARCH_DISTANCELIB_H_
+#define INCLUDE_SEARCH_DISTANCELIB_H_
+
+#include <array>   // std::array
+#include <cstdint> // std::uint8_t
+#include <span>    // std::span
+#include <vector>  // std::vector
+
+#include "slidr/constants/constantslib.hpp" // constants::EIGHT_PUZZLE_NUM
+
+#include "search/packedstatelib.hpp" // search::PackedState
+#include "search/rankinglib.hpp"     // search::Digits
+
+namespace search
+{
+/// @brief The value returned when there is no move to make
+constexpr short noMove = -1;
+
+/// @brief The exact number of moves from every 8 puzzle state to the goal
+///
+/// The table is filled once by a breadth-first search from the goal over all
+/// 9!/2 reachable states, so any distance or optimal move afterwards is a few
+/// lookups instead of a solve. It is indexed by the half rank of a state, so
+/// only the reachable states take up space.
+class DistanceTable
+{
+public:
+    /// @brief The value stored for the states that cannot reach the goal
+    static constexpr std::uint8_t unreachable = 0xFF;
+
+    /// @brief Builds the table
+    DistanceTable();
+
+    /// @brief Gets the number of optimal moves to the goal
+    /// @param layout The layout of the puzzle
+    /// @return The number of moves, unreachable if the layout is not solvable
+    std::uint8_t GetDistance(std::span<const int> layout) const;
+
+    /// @brief Gets the optimal next move
+    /// @param layout The layout of the puzzle
+    /// @param posX The position of the empty piece
+    /// @return The direction the empty piece moves to, noMove if the layout is solved or
+    /// not solvable
+    short GetNextMove(std::span<const int> layout, int posX) const;
+
+    /// @brief Gets the optimal next move of a packed state
+    /// @param state The packed state of the puzzle
+    /// @param posX The position of the empty piece
+    /// @return The direction the empty piece moves to, noMove if the state is solved or
+    /// not solvable
+    short GetNextMove(PackedState state, int posX) const;
+
+private:
+    /// @brief Finds the optimal next move
+    /// @param digits The pieces of the puzzle
+    /// @param posX The position of the empty piece
+    /// @return The direction the empty piece moves to, noMove if there is none
+    short FindNextMove(Digits digits, int posX) const;
+
+    /// @brief The distances indexed by the half rank of the state
+    std::vector<std::uint8_t> distances_;
+};
+} // namespace search
+
+#endif // INCLUDE_SEARCH_DISTANCELIB_H_
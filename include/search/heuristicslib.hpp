@@ -0,0 +1,142 @@
+#ifndef INCLUDE_SEARCH_HEURISTICSLIB_H_
+#define INCLUDE_SEARCH_HEURISTICSLIB_H_
+
+#include <array>         // std::array
+#include <cstdint>       // std::uint8_t, std::uint16_t, std::uint64_t
+#include <unordered_map> // std::unordered_map
+#include <vector>        // std::vector
+
+#include "slidr/constants/constantslib.hpp" // constants::EIGHT_PUZZLE_SIZE
+
+#include "search/packedstatelib.hpp" // search::PackedState
+
+namespace search
+{
+/// @brief The lower bounds of the distance to the goal the solvers can use
+enum struct HeuristicKind : int
+{
+    MANHATTAN = 0,   // the sum of the distances of the pieces to their goals
+    LINEAR_CONFLICT, // plus two moves for each piece that has to leave its line to let another by
+    WALKING_DISTANCE // the larger of the walking distance and the linear conflict
+};
+
+/// @brief The parts of the estimate of a state, kept so a child is updated instead of evaluated
+struct Estimate
+{
+    /// @brief The lower bound of the kind of the heuristic
+    int value;
+
+    /// @brief The Manhattan distance
+    int manhattan;
+
+    /// @brief The extra moves of the linear conflicts of all rows and columns
+    int conflicts;
+
+    /// @brief The walking distance configuration of the rows
+    std::uint16_t rowsConfig;
+
+    /// @brief The walking distance configuration of the columns
+    std::uint16_t colsConfig;
+};
+
+/// @brief Admissible heuristics that are updated in O(1) per move
+///
+/// The linear conflict of a row or a column only depends on the pieces in it,
+/// so it is a table lookup on the nibbles of that line, and a move changes at
+/// most two rows and two columns. The walking distance counts, for every row,
+/// how many pieces belong in each goal row; all such configurations are
+/// numbered by a breadth-first search from the goal, and a move of a piece
+/// between two rows is a step in a transition table. The columns use the same
+/// table, since their configurations have the same shape.
+class Heuristics
+{
+public:
+    /// @brief Builds the tables
+    /// @param kind The heuristic the estimates take their value from
+    explicit Heuristics(HeuristicKind kind);
+
+    /// @brief Evaluates a state from scratch
+    /// @param state The packed state
+    /// @return The estimate
+    Estimate Evaluate(PackedState state) const;
+
+    /// @brief Updates the estimate of a state for a move of its empty piece
+    /// @param parent The estimate of the state
+    /// @param state The packed state before the move
+    /// @param posX The position of the empty piece before the move
+    /// @param target The position of the empty piece after the move
+    /// @return The estimate of the state after the move
+    Estimate Update(const Estimate &parent, PackedState state, int posX, int target) const;
+
+    /// @brief Gets the heuristic the estimates take their value from
+    /// @return The kind of the heuristic
+    inline HeuristicKind GetKind() const noexcept { return kind_; }
+
+private:
+    /// @brief Fills the linear conflicts of every possible row and column
+    void BuildConflicts();
+
+    /// @brief Numbers the walking distance configurations and their transitions
+    void BuildWalkingDistance();
+
+    /// @brief Gets the linear conflicts of the rows and the columns of two positions
+    /// @param state The packed state
+    /// @param posA The first position
+    /// @param posB The second position
+    /// @return The extra moves, each line counted once
+    int GetLineConflicts(PackedState state, int posA, int posB) const;
+
+    /// @brief Finds the walking distance configuration of a state
+    /// @param state The packed state
+    /// @param byRow TRUE for the rows, FALSE for the columns
+    /// @return The index of the configuration
+    std::uint16_t FindConfig(PackedState state, bool byRow) const;
+
+    /// @brief Sets the value of an estimate from its parts
+    /// @param estimate The estimate
+    void SetValue(Estimate &estimate) const;
+
+    /// @brief Gets the Manhattan distance of a piece at a position
+    /// @param piece The piece
+    /// @param pos The position
+    /// @return The distance
+    inline int GetManhattan(int piece, int pos) const noexcept
+    {
+        return manhattan_[static_cast<size_t>(piece)][static_cast<size_t>(pos)];
+    }
+
+private:
+    /// @brief The number of pieces in each row and column
+    static constexpr int N = constants::EIGHT_PUZZLE_SIZE;
+
+    /// @brief The number of pieces
+    static constexpr int numOfPieces = constants::EIGHT_PUZZLE_NUM;
+
+    /// @brief The number of ways to fill a line with pieces, one nibble each
+    static constexpr size_t numOfLineKeys = size_t{1} << (4 * N);
+
+    /// @brief The heuristic the estimates take their value from
+    HeuristicKind kind_;
+
+    /// @brief The Manhattan distance of each piece at each position
+    std::array<std::array<std::uint8_t, numOfPieces>, numOfPieces> manhattan_;
+
+    /// @brief The extra moves of each row, indexed by row * numOfLineKeys + the pieces in it
+    std::vector<std::uint8_t> rowConflicts_;
+
+    /// @brief The extra moves of each column, indexed like the rows
+    std::vector<std::uint8_t> colConflicts_;
+
+    /// @brief The index of each walking distance configuration
+    std::unordered_map<std::uint64_t, std::uint16_t> configIndex_;
+
+    /// @brief The walking distance of each configuration
+    std::vector<std::uint8_t> walkingDistance_;
+
+    /// @brief The configuration after a piece with goal line g moves, indexed by 2 * g plus 1
+    /// if the empty piece moves down (or right), 0 if it moves up (or left)
+    std::vector<std::array<std::uint16_t, 2 * N>> transitions_;
+};
+} // namespace search
+
+#endif // INCLUDE_SEARCH_HEURISTICSLIB_H_
@@ -0,0 +1,152 @@
+#ifndef INCLUDE_SEARCH_IDASTARLIB_H_
+#define INCLUDE_SEARCH_IDASTARLIB_H_
+
+#include <cstdint>       // std::uint8_t, std::uint64_t
+#include <span>          // std::span
+#include <unordered_map> // std::unordered_map
+#include <vector>        // std::vector
+
+#include "slidr/constants/constantslib.hpp" // constants::EIGHT_PUZZLE_SIZE
+
+#include "search/heuristicslib.hpp"    // search::Heuristics, search::Estimate
+#include "search/packedstatelib.hpp"   // search::PackedState
+#include "search/transpositionlib.hpp" // search::TranspositionTable, search::TableCounters
+
+namespace search
+{
+/// @brief An IDA* solver that keeps what it learns between searches
+///
+/// After a puzzle is solved the solver remembers
+/// (i) the exact distance of every state on the optimal path,
+/// (ii) the lower bounds it proved for the states it gave up on, and
+/// (iii) the length of the optimal solution.
+/// Solving again from a state that was reached from the same start (e.g. after
+/// the player made some moves) starts from a tighter bound and stops as soon as
+/// it reaches the known optimal path, so it is a fraction of a cold solve.
+/// The lower bounds live in a transposition table of a fixed size, and since
+/// they do not depend on the start they also speed up the later puzzles.
+class IdaStar
+{
+public:
+    IdaStar();
+
+    /// @brief Constructs the solver
+    /// @param heuristic The lower bound of the distance to the goal to search with
+    /// @param tableMemory The most memory the table of the lower bounds may take in bytes
+    IdaStar(HeuristicKind heuristic, size_t tableMemory);
+
+    /// @brief Solves a puzzle from scratch, keeping only the lower bounds of previous searches
+    /// @param layout The layout of the puzzle
+    /// @param posX The position of the empty piece
+    /// @return The directions of the empty piece of an optimal solution
+    std::vector<short> Solve(std::span<const int> layout, int posX);
+
+    /// @brief Solves a puzzle that was reached from the start of the last Solve()
+    /// @param layout The layout of the puzzle
+    /// @param posX The position of the empty piece
+    /// @param movesFromStart The number of moves made since the start of the last Solve()
+    /// @return The directions of the empty piece of an optimal solution
+    std::vector<short> SolveFrom(std::span<const int> layout, int posX, int movesFromStart);
+
+    /// @brief Takes a known solution as if Solve() found it
+    /// @param layout The layout of the puzzle
+    /// @param posX The position of the empty piece
+    /// @param dirs The directions of the empty piece of an optimal solution
+    void Adopt(std::span<const int> layout, int posX, std::span<const short> dirs);
+
+    /// @brief Forgets the lower bounds of all previous searches, so the next one starts cold
+    void ForgetBounds() noexcept;
+
+    /// @brief Gets the number of nodes expanded by the last search
+    /// @return The number of nodes
+    inline std::uint64_t GetExpandedNodes() const noexcept { return expandedNodes_; }
+
+    /// @brief Gets the table of the lower bounds, e.g. for its capacity
+    /// @return The table
+    inline const TranspositionTable &GetTable() const noexcept { return lowerBounds_; }
+
+    /// @brief Gets what the searches counted in the table since the bounds were last forgotten
+    /// @return The counters
+    inline TableCounters GetTableCounters() const noexcept { return tableCounters_; }
+
+private:
+    /// @brief Runs the iterations of IDA*
+    /// @param start The packed state of the puzzle
+    /// @param posX The position of the empty piece
+    /// @param lowerBound A known lower bound of the solution length
+    /// @return The directions of the empty piece of an optimal solution
+    std::vector<short> Search(PackedState start, int posX, int lowerBound);
+
+    /// @brief Searches depth first under a bound
+    /// @param state The current state
+    /// @param posX The position of the empty piece
+    /// @param g The number of moves from the start
+    /// @param estimate The estimate of the current state
+    /// @param parentLowerBound A lower bound of the distance of the previous state
+    /// @param prevDir The direction that led to the current state
+    /// @return The smallest f value over the bound, found_ is set if a solution is found
+    int DepthFirst(PackedState state, int posX, int g, const Estimate &estimate,
+                   int parentLowerBound, short prevDir);
+
+    /// @brief Appends the known optimal path from a state to the goal
+    /// @param state The state on the known optimal path
+    /// @param posX The position of the empty piece
+    /// @param dirs The directions to append to
+    void FollowKnownPath(PackedState state, int posX, std::vector<short> &dirs) const;
+
+    /// @brief Remembers an optimal solution so later searches can join it
+    /// @param start The packed state of the puzzle
+    /// @param posX The position of the empty piece
+    /// @param dirs The directions of the empty piece of the solution
+    void RememberPath(PackedState start, int posX, std::span<const short> dirs);
+
+private:
+    /// @brief A state on a known optimal path
+    struct PathEntry
+    {
+        /// @brief The exact number of moves to the goal
+        std::uint8_t distance;
+
+        /// @brief The next direction of the empty piece
+        short nextDir;
+    };
+
+    /// @brief The number of pieces in each row and column
+    static constexpr int N = constants::EIGHT_PUZZLE_SIZE;
+
+    /// @brief The estimates of the distance to the goal
+    Heuristics heuristics_;
+
+    /// @brief The lower bounds proven by the previous iterations and searches
+    TranspositionTable lowerBounds_;
+
+    /// @brief The states of the known optimal paths
+    std::unordered_map<PackedState, PathEntry> optimalPath_;
+
+    /// @brief The length of the optimal solution of the last Solve()
+    int solvedLength_;
+
+    /// @brief The bound of the current iteration
+    int bound_;
+
+    /// @brief The directions from the start to the current state
+    std::vector<short> path_;
+
+    /// @brief The state where the search joined a known optimal path
+    PackedState joinedState_;
+
+    /// @brief The position of the empty piece in the joined state
+    int joinedPosX_;
+
+    /// @brief TRUE if the current search found a solution
+    bool found_;
+
+    /// @brief The number of nodes expanded by the last search
+    std::uint64_t expandedNodes_;
+
+    /// @brief What the searches counted in the table
+    TableCounters tableCounters_;
+};
+} // namespace search
+
+#endif // INCLUDE_SEARCH_IDASTARLIB_H_
@@ -0,0 +1,119 @@
+#ifndef INCLUDE_SEARCH_NODEARENALIB_H_
+#define INCLUDE_SEARCH_NODEARENALIB_H_
+
+#include <array>   // std::array
+#include <cstdint> // std::int8_t, std::uint16_t, std::uint32_t
+#include <span>    // std::span
+#include <vector>  // std::vector
+
+#include "slidr/constants/constantslib.hpp" // constants::EIGHT_PUZZLE_NUM
+
+#include "search/packedstatelib.hpp" // search::PackedState
+
+namespace search
+{
+/// @brief The index of a node in a NodeArena
+using NodeIndex = std::uint32_t;
+
+/// @brief The parent of a root node
+inline constexpr NodeIndex noNode = UINT32_MAX;
+
+/// @brief The layout of a node, one element per piece
+using Layout = std::array<int, constants::EIGHT_PUZZLE_NUM>;
+
+/// @brief A state that was reached from a root
+struct ArenaNode
+{
+    /// @brief The packed state
+    PackedState state;
+
+    /// @brief The node the move was made from, noNode for a root
+    NodeIndex parent;
+
+    /// @brief The child that was visited last, noNode for a leaf
+    NodeIndex firstChild;
+
+    /// @brief The next child of the same parent, visited less recently
+    NodeIndex nextSibling;
+
+    /// @brief The number of moves from the root
+    std::uint16_t depth;
+
+    /// @brief The position of the empty piece
+    std::int8_t posX;
+
+    /// @brief The direction of the empty piece that led here, -1 for a root
+    std::int8_t dir;
+};
+
+/// @brief A monotonic arena of nodes that form a tree of moves by index
+///
+/// A node is 24 bytes in one contiguous vector instead of its own heap block
+/// with an atomic reference count, and the links survive the vector growing
+/// because they are indices. Nodes are never freed one by one; Reset() drops
+/// all of them at once and keeps the memory for the next puzzle, and since the
+/// nodes are trivially destructible the teardown costs nothing.
+///
+/// Every node shares the path to it with its siblings, and a move that was
+/// made before from the same node leads back to the same child instead of a
+/// new one, so going back and forth between alternatives allocates nothing.
+/// The children of a node are kept with the one visited last in front, which
+/// makes it the node that a redo goes to.
+class NodeArena
+{
+public:
+    /// @brief Constructs the arena
+    /// @param capacity The number of nodes to reserve room for
+    explicit NodeArena(size_t capacity);
+
+    /// @brief Adds a node with no parent
+    /// @param layout The layout of the puzzle
+    /// @return The index of the node
+    NodeIndex AddRoot(std::span<const int> layout);
+
+    /// @brief Gets the node a move of the empty piece leads to, adding it if it is new
+    /// @param parent The index of the node the move is made from
+    /// @param dir The direction of the empty piece
+    /// @return The index of the node, which becomes the first child of the parent, noNode if the
+    /// move leaves the board or the parent is already at the deepest depth a node can hold
+    NodeIndex AddChild(NodeIndex parent, short dir);
+
+    /// @brief Gets the child of a node that was visited last
+    /// @param index The index of the node
+    /// @return The index of the child, noNode if the node has no children
+    inline NodeIndex GetRedo(NodeIndex index) const noexcept { return nodes_[index].firstChild; }
+
+    /// @brief Gets a node
+    /// @param index The index of the node
+    /// @return The node
+    inline const ArenaNode &operator[](NodeIndex index) const noexcept { return nodes_[index]; }
+
+    /// @brief Gets the layout of a node
+    /// @param index The index of the node
+    /// @return The layout
+    Layout GetLayout(NodeIndex index) const noexcept;
+
+    /// @brief Drops every node but keeps the memory
+    inline void Reset() noexcept { nodes_.clear(); }
+
+    /// @brief Gets the number of nodes
+    /// @return The number of nodes
+    inline size_t GetSize() const noexcept { return nodes_.size(); }
+
+    /// @brief Gets the memory that the arena holds
+    /// @return The number of bytes reserved for the nodes
+    inline size_t GetMemoryFootprint() const noexcept
+    {
+        return nodes_.capacity() * sizeof(ArenaNode);
+    }
+
+private:
+    /// @brief The number of pieces in each row and column
+    static constexpr int N = constants::EIGHT_PUZZLE_SIZE;
+
+    /// @brief The nodes in the order they were added
+    std::vector<ArenaNode> nodes_;
+};
+} // namespace search
+
+#endif // INCLUDE_SEARCH_NODEARENALIB_H_
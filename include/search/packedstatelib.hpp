@@ -0,0 +1,96 @@
+#ifndef INCLUDE_SEARCH_PACKEDSTATELIB_H_
+#define INCLUDE_SEARCH_PACKEDSTATELIB_H_
+
+#include <array>   // std::array
+#include <cstdint> // std::uint64_t
+#include <span>    // std::span
+
+#include "slidr/constants/constantslib.hpp" // constants::EMPTY
+
+namespace search
+{
+/// @brief A layout packed into 4 bits per piece (the empty piece is 0)
+///
+/// Up to 16 pieces fit into one word, which covers the 8 and the 15 puzzle.
+using PackedState = std::uint64_t;
+
+/// @brief A move of the empty piece
+struct Move
+{
+    short dir;
+    short opposite;
+    int dRow;
+    int dCol;
+};
+
+/// @brief All the moves of the empty piece
+inline constexpr std::array<Move, 4> moves{{
+    {constants::UP, constants::DOWN, -1, 0},
+    {constants::DOWN, constants::UP, 1, 0},
+    {constants::LEFT, constants::RIGHT, 0, -1},
+    {constants::RIGHT, constants::LEFT, 0, 1},
+}};
+
+/// @brief Gets the position of the empty piece after a move
+/// @param posX The position of the empty piece
+/// @param move The move
+/// @param n The number of pieces in each row and column
+/// @return The new position, -1 if the move leaves the board
+inline int GetTarget(int posX, const Move &move, int n) noexcept
+{
+    const int row = posX / n + move.dRow;
+    const int col = posX % n + move.dCol;
+
+    return ((row < 0) || (row >= n) || (col < 0) || (col >= n)) ? -1 : row * n + col;
+}
+
+/// @brief Packs a layout
+/// @param layout The layout of the puzzle
+/// @return The packed state
+inline PackedState Pack(std::span<const int> layout) noexcept
+{
+    PackedState state = 0;
+    for (size_t i = 0; i < layout.size(); i++)
+    {
+        const int piece = (layout[i] == constants::EMPTY) ? 0 : layout[i];
+        state |= static_cast<PackedState>(piece) << (4 * i);
+    }
+
+    return state;
+}
+
+/// @brief Unpacks a state
+/// @param state The packed state
+/// @param layout The layout to fill, one element per piece
+inline void Unpack(PackedState state, std::span<int> layout) noexcept
+{
+    for (size_t i = 0; i < layout.size(); i++)
+    {
+        const int piece = static_cast<int>((state >> (4 * i)) & 0xF);
+        layout[i] = (piece == 0) ? constants::EMPTY : piece;
+    }
+}
+
+/// @brief Gets a piece of a packed state
+/// @param state The packed state
+/// @param pos The position of the piece
+/// @return The piece, 0 for the empty piece
+inline int GetPiece(PackedState state, int pos) noexcept
+{
+    return static_cast<int>((state >> (4 * pos)) & 0xF);
+}
+
+/// @brief Slides a piece into the empty position
+/// @param state The packed state
+/// @param posX The position of the empty piece
+/// @param pos The position of the piece that slides
+/// @return The packed state after the move (the empty piece is at pos)
+inline PackedState Slide(PackedState state, int posX, int pos) noexcept
+{
+    const PackedState piece = static_cast<PackedState>(GetPiece(state, pos));
+
+    return (state & ~(PackedState{0xF} << (4 * pos))) | (piece << (4 * posX));
+}
+} // namespace search
+
+#endif // INCLUDE_SEARCH_PACKEDSTATELIB_H_
@@ -0,0 +1,186 @@
+#ifndef INCLUDE_SEARCH_PARALLELIDASTARLIB_H_
+#define INCLUDE_SEARCH_PARALLELIDASTARLIB_H_
+
+#include <atomic>  // std::atomic
+#include <cstdint> // std::uint64_t
+#include <deque>   // std::deque
+#include <memory>  // std::unique_ptr
+#include <mutex>   // std::mutex
+#include <span>    // std::span
+#include <vector>  // std::vector
+
+#include "slidr/constants/constantslib.hpp" // constants::EIGHT_PUZZLE_SIZE
+
+#include "search/heuristicslib.hpp"    // search::Heuristics, search::Estimate
+#include "search/packedstatelib.hpp"   // search::PackedState
+#include "search/transpositionlib.hpp" // search::TranspositionTable, search::TableCounters
+#include "utils/threadpoollib.hpp"     // ThreadPool
+
+namespace search
+{
+/// @brief An IDA* solver that runs every iteration on all the threads of a pool
+///
+/// Each iteration expands the first few levels below the root into tasks and
+/// deals them out to one deque per worker. A worker takes tasks from the back
+/// of its own deque and, once that is empty, steals from the front of the
+/// others, so a worker that drew an easy subtree keeps helping until the whole
+/// iteration is done. The workers share the bound of the next iteration and
+/// the found flag through atomics. Any solution found under the current bound
+/// is optimal, so the first one stops everybody. The lower bounds the workers
+/// prove go into one transposition table, so a subtree that one worker gave up
+/// on is cut short when another worker reaches it by a different path.
+class ParallelIdaStar
+{
+public:
+    /// @brief Constructs the solver
+    /// @param pool The pool that runs the workers
+    explicit ParallelIdaStar(ThreadPool &pool);
+
+    ~ParallelIdaStar();
+
+    ParallelIdaStar(const ParallelIdaStar &) = delete;
+
+    ParallelIdaStar &operator=(const ParallelIdaStar &) = delete;
+
+    /// @brief Solves a puzzle
+    /// @param layout The layout of the puzzle
+    /// @param posX The position of the empty piece
+    /// @return The directions of the empty piece of an optimal solution
+    std::vector<short> Solve(std::span<const int> layout, int posX);
+
+    /// @brief Gets the number of nodes each worker expanded in the last search
+    /// @return The number of nodes indexed by worker
+    inline std::span<const std::uint64_t> GetExpandedNodesPerWorker() const noexcept
+    {
+        return expandedNodes_;
+    }
+
+    /// @brief Gets the number of nodes all the workers expanded in the last search
+    /// @return The number of nodes
+    std::uint64_t GetExpandedNodes() const noexcept;
+
+    /// @brief Gets the table of the lower bounds, e.g. for its capacity
+    /// @return The table
+    inline const TranspositionTable &GetTable() const noexcept { return lowerBounds_; }
+
+    /// @brief Gets what all the workers of all the searches counted in the table
+    /// @return The counters
+    TableCounters GetTableCounters() const noexcept;
+
+private:
+    /// @brief A subtree to search
+    struct Task
+    {
+        /// @brief The state at the root of the subtree
+        PackedState state;
+
+        /// @brief The position of the empty piece
+        int posX;
+
+        /// @brief The estimate of the state
+        Estimate estimate;
+
+        /// @brief A lower bound of the distance of the previous state
+        int parentLowerBound;
+
+        /// @brief The direction that led to the state
+        short prevDir;
+
+        /// @brief The directions from the start to the state
+        std::vector<short> path;
+    };
+
+    /// @brief What a worker counts while it searches, kept local so the workers share nothing
+    struct WorkerState
+    {
+        /// @brief The number of nodes expanded
+        std::uint64_t expanded;
+
+        /// @brief The smallest f value over the bound seen
+        int nextBound;
+
+        /// @brief What the worker counted in the table
+        TableCounters table;
+    };
+
+    /// @brief The tasks of a worker
+    /// NOTE: the owner takes from the back and the thieves from the front, so
+    /// they rarely want the same end and the lock is almost never contended
+    struct TaskDeque
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    /// @brief Expands the levels below the root into tasks and deals them out
+    /// @param start The packed state of the puzzle
+    /// @param posX The position of the empty piece
+    /// @param estimate The estimate of the puzzle
+    void SplitRoot(PackedState start, int posX, const Estimate &estimate);
+
+    /// @brief Runs tasks until there are none left or a solution is found
+    /// @param worker The index of the worker
+    void RunWorker(size_t worker);
+
+    /// @brief Takes a task from the own deque or steals one from the others
+    /// @param worker The index of the worker
+    /// @param task The task
+    /// @return FALSE if every deque is empty
+    bool TakeTask(size_t worker, Task &task);
+
+    /// @brief Searches depth first under the bound
+    /// @param state The current state
+    /// @param posX The position of the empty piece
+    /// @param estimate The estimate of the current state
+    /// @param parentLowerBound A lower bound of the distance of the previous state
+    /// @param prevDir The direction that led to the current state
+    /// @param path The directions from the start to the current state
+    /// @param worker The counters of the worker
+    /// @return A lower bound of the moves from the start to the goal through the current state
+    int DepthFirst(PackedState state, int posX, const Estimate &estimate, int parentLowerBound,
+                   short prevDir, std::vector<short> &path, WorkerState &worker);
+
+    /// @brief Lowers the bound of the next iteration
+    /// @param f An f value over the current bound
+    void LowerNextBound(int f) noexcept;
+
+private:
+    /// @brief The number of pieces in each row and column
+    static constexpr int N = constants::EIGHT_PUZZLE_SIZE;
+
+    /// @brief The pool that runs the workers
+    ThreadPool &pool_;
+
+    /// @brief The estimates of the distance to the goal
+    Heuristics heuristics_;
+
+    /// @brief The lower bounds proven by all the workers
+    TranspositionTable lowerBounds_;
+
+    /// @brief The tasks of each worker
+    std::vector<std::unique_ptr<TaskDeque>> deques_;
+
+    /// @brief The bound of the current iteration
+    int bound_;
+
+    /// @brief The smallest f value over the bound seen in the current iteration
+    std::atomic<int> nextBound_;
+
+    /// @brief TRUE once a worker found a solution
+    std::atomic<bool> found_;
+
+    /// @brief Guards the solution
+    std::mutex solutionMutex_;
+
+    /// @brief The directions of the solution that was found
+    std::vector<short> solution_;
+
+    /// @brief The number of nodes each worker expanded in the last search
+    std::vector<std::uint64_t> expandedNodes_;
+
+    /// @brief What each worker counted in the table over all the searches
+    std::vector<TableCounters> tableCounters_;
+};
+} // namespace search
+
+#endif // INCLUDE_SEARCH_PARALLELIDASTARLIB_H_
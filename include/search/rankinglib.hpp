@@ -0,0 +1,247 @@
+#ifndef INCLUDE_SEARCH_RANKINGLIB_H_
+#define INCLUDE_SEARCH_RANKINGLIB_H_
+
+#include <array>   // std::array
+#include <bit>     // std::popcount
+#include <cstdint> // std::uint8_t, std::uint32_t
+#include <span>    // std::span
+#include <utility> // std::swap
+
+#include "slidr/constants/constantslib.hpp" // constants::EIGHT_PUZZLE_NUM
+
+#include "search/packedstatelib.hpp" // search::PackedState, search::GetPiece
+
+namespace search
+{
+/// @brief The factorials from 0! to 12! (the largest one that fits into 32 bits)
+inline constexpr std::array<std::uint32_t, 13> factorials = []
+{
+    std::array<std::uint32_t, 13> table{1};
+    for (std::uint32_t i = 1; i < table.size(); i++)
+    {
+        table[i] = table[i - 1] * i;
+    }
+
+    return table;
+}();
+
+/// @brief The pieces of an 8 puzzle layout where the empty piece is 0
+using Digits = std::array<std::uint8_t, constants::EIGHT_PUZZLE_NUM>;
+
+/// @brief The number of solvable 8 puzzle layouts (9! / 2)
+inline constexpr std::uint32_t numOfHalfRanks = factorials[constants::EIGHT_PUZZLE_NUM] / 2;
+
+/// @brief Ranks a permutation in lexicographic order (Lehmer code)
+///
+/// The number of smaller values after each position is the value minus the
+/// number of smaller values already seen, which is one popcount of a mask, so
+/// the rank is O(n) instead of the O(n^2) pairwise count.
+/// @param perm A permutation of 0 to N - 1
+/// @return The rank in [0, N!)
+template <size_t N> constexpr std::uint32_t Rank(const std::array<std::uint8_t, N> &perm) noexcept
+{
+    static_assert(N < factorials.size(), "the rank must fit into 32 bits");
+
+    std::uint32_t rank = 0;
+    std::uint32_t seen = 0;
+    for (size_t i = 0; i < N; i++)
+    {
+        const std::uint32_t below = (1U << perm[i]) - 1;
+        const std::uint32_t smaller =
+            perm[i] - static_cast<std::uint32_t>(std::popcount(seen & below));
+        rank += smaller * factorials[N - 1 - i];
+        seen |= 1U << perm[i];
+    }
+
+    return rank;
+}
+
+/// @brief Finds the position of the k-th set bit of a mask
+///
+/// Halves the window five times, keeping the low half if it holds more than k
+/// set bits and moving to the high half otherwise, so the cost does not grow
+/// with k.
+/// @param mask The mask, with more than k set bits
+/// @param k The number of set bits to skip, counted from the lowest
+/// @return The position of the bit
+constexpr int SelectBit(std::uint32_t mask, std::uint32_t k) noexcept
+{
+    int pos = 0;
+    for (int width = 16; width > 0; width /= 2)
+    {
+        const std::uint32_t low = mask & ((1U << width) - 1);
+        const std::uint32_t count = static_cast<std::uint32_t>(std::popcount(low));
+        if (k < count)
+        {
+            mask = low;
+        }
+        else
+        {
+            k -= count;
+            mask >>= width;
+            pos += width;
+        }
+    }
+
+    return pos;
+}
+
+/// @brief Gets the permutation of a rank
+///
+/// Each Lehmer digit picks the k-th unused value with one select over a mask
+/// of the unused values, so the unrank is O(n) like the rank.
+/// @param rank The rank in [0, N!)
+/// @return The permutation of 0 to N - 1
+template <size_t N> constexpr std::array<std::uint8_t, N> Unrank(std::uint32_t rank) noexcept
+{
+    static_assert(N < factorials.size(), "the rank must fit into 32 bits");
+
+    std::array<std::uint8_t, N> perm{};
+    std::uint32_t unused = (1U << N) - 1;
+    for (size_t i = 0; i < N; i++)
+    {
+        const std::uint32_t f = factorials[N - 1 - i];
+        const std::uint32_t k = rank / f;
+        rank %= f;
+
+        const int value = SelectBit(unused, k);
+        perm[i] = static_cast<std::uint8_t>(value);
+        unused &= ~(1U << value);
+    }
+
+    return perm;
+}
+
+/// @brief Checks if a permutation has an even number of inversions
+/// @param perm A permutation of 0 to N - 1
+/// @return TRUE if the permutation is even
+template <size_t N> constexpr bool IsEven(const std::array<std::uint8_t, N> &perm) noexcept
+{
+    // The digits of the Lehmer code add up to the number of inversions
+    std::uint32_t inversions = 0;
+    std::uint32_t seen = 0;
+    for (size_t i = 0; i < N; i++)
+    {
+        inversions +=
+            perm[i] - static_cast<std::uint32_t>(std::popcount(seen & ((1U << perm[i]) - 1)));
+        seen |= 1U << perm[i];
+    }
+
+    return (inversions % 2) == 0;
+}
+
+/// @brief Converts a packed state into digits
+/// @param state The packed state
+/// @return The digits
+constexpr Digits ToDigits(PackedState state) noexcept
+{
+    Digits digits{};
+    for (size_t i = 0; i < digits.size(); i++)
+    {
+        digits[i] = static_cast<std::uint8_t>(GetPiece(state, static_cast<int>(i)));
+    }
+
+    return digits;
+}
+
+/// @brief The number of pieces without the empty one
+inline constexpr size_t numOfTiles = constants::EIGHT_PUZZLE_NUM - 1;
+
+/// @brief The number of even orderings of the pieces (8! / 2)
+inline constexpr std::uint32_t numOfEvenTiles = factorials[numOfTiles] / 2;
+
+/// @brief The pieces of a layout without the empty piece, as a permutation of 0 to 7
+using Tiles = std::array<std::uint8_t, numOfTiles>;
+
+/// @brief Checks if a layout can reach the goal
+/// @param digits The digits of the layout
+/// @return TRUE if the pieces (without the empty one) are an even permutation
+constexpr bool IsSolvable(const Digits &digits) noexcept
+{
+    Tiles tiles{};
+    size_t j = 0;
+    for (const std::uint8_t digit : digits)
+    {
+        if (digit != 0)
+        {
+            tiles[j++] = digit - 1;
+        }
+    }
+
+    return IsEven(tiles);
+}
+
+/// @brief Ranks a solvable layout densely among the solvable layouts only
+///
+/// The orderings at ranks 2k and 2k + 1 only swap the last two pieces, so
+/// exactly one of them is even and rank / 2 numbers the even ones without
+/// gaps. The position of the empty piece picks one of nine such blocks.
+/// @param digits The digits of a solvable layout
+/// @return The rank in [0, numOfHalfRanks)
+constexpr std::uint32_t HalfRank(const Digits &digits) noexcept
+{
+    Tiles tiles{};
+    std::uint32_t posX = 0;
+    size_t j = 0;
+    for (size_t i = 0; i < digits.size(); i++)
+    {
+        if (digits[i] == 0)
+        {
+            posX = static_cast<std::uint32_t>(i);
+        }
+        else
+        {
+            tiles[j++] = digits[i] - 1;
+        }
+    }
+
+    return posX * numOfEvenTiles + Rank(tiles) / 2;
+}
+
+/// @brief Gets the solvable layout of a half rank
+/// @param rank The rank in [0, numOfHalfRanks)
+/// @return The digits of the layout
+constexpr Digits HalfUnrank(std::uint32_t rank) noexcept
+{
+    const std::uint32_t posX = rank / numOfEvenTiles;
+    Tiles tiles = Unrank<numOfTiles>(2 * (rank % numOfEvenTiles));
+    if (!IsEven(tiles))
+    {
+        std::swap(tiles[numOfTiles - 2], tiles[numOfTiles - 1]);
+    }
+
+    Digits digits{};
+    size_t j = 0;
+    for (size_t i = 0; i < digits.size(); i++)
+    {
+        digits[i] = (i == posX) ? 0 : static_cast<std::uint8_t>(tiles[j++] + 1);
+    }
+
+    return digits;
+}
+
+/// @brief Ranks many packed states at once
+/// @param states The packed states
+/// @param ranks The ranks in [0, 9!), as many as there are states
+inline void RankBatch(std::span<const PackedState> states, std::span<std::uint32_t> ranks) noexcept
+{
+    for (size_t i = 0; i < states.size(); i++)
+    {
+        ranks[i] = Rank(ToDigits(states[i]));
+    }
+}
+
+/// @brief Half ranks many packed solvable states at once
+/// @param states The packed states, all solvable
+/// @param ranks The ranks in [0, numOfHalfRanks), as many as there are states
+inline void HalfRankBatch(std::span<const PackedState> states,
+                          std::span<std::uint32_t> ranks) noexcept
+{
+    for (size_t i = 0; i < states.size(); i++)
+    {
+        ranks[i] = HalfRank(ToDigits(states[i]));
+    }
+}
+} // namespace search
+
+#endif // INCLUDE_SEARCH_RANKINGLIB_H_
@@ -0,0 +1,93 @@
+#ifndef INCLUDE_SEARCH_SOLUTIONCACHELIB_H_
+#define INCLUDE_SEARCH_SOLUTIONCACHELIB_H_
+
+#include <atomic>        // std::atomic
+#include <cstdint>       // std::uint64_t
+#include <list>          // std::list
+#include <mutex>         // std::mutex
+#include <optional>      // std::optional
+#include <unordered_map> // std::unordered_map
+#include <vector>        // std::vector
+
+#include "search/packedstatelib.hpp" // search::PackedState
+
+namespace search
+{
+/// @brief An optimal solution of a puzzle
+struct Solution
+{
+    /// @brief The number of optimal moves
+    unsigned length;
+
+    /// @brief The directions of the empty piece
+    std::vector<short> dirs;
+};
+
+/// @brief A bounded least-recently-used cache of optimal solutions
+///
+/// All member functions are thread-safe.
+class SolutionCache
+{
+public:
+    /// @brief Constructs the cache
+    /// @param capacity The maximum number of solutions kept
+    explicit SolutionCache(size_t capacity);
+
+    SolutionCache(const SolutionCache &) = delete;
+
+    SolutionCache &operator=(const SolutionCache &) = delete;
+
+    /// @brief Looks up the solution of a puzzle and marks it as recently used
+    /// @param key The packed state of the puzzle
+    /// @return The solution, std::nullopt if it is not cached
+    std::optional<Solution> Find(PackedState key);
+
+    /// @brief Stores the solution of a puzzle, evicting the least recently used one if full
+    /// @param key The packed state of the puzzle
+    /// @param dirs The directions of the empty piece of an optimal solution
+    void Insert(PackedState key, std::vector<short> dirs);
+
+    /// @brief Gets the number of lookups that found a solution
+    /// @return The number of hits
+    inline std::uint64_t GetHits() const noexcept { return hits_.load(std::memory_order_relaxed); }
+
+    /// @brief Gets the number of lookups that did not find a solution
+    /// @return The number of misses
+    inline std::uint64_t GetMisses() const noexcept
+    {
+        return misses_.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Gets the number of cached solutions
+    /// @return The number of solutions
+    size_t GetSize() const;
+
+private:
+    /// @brief A cached solution and its key
+    struct Entry
+    {
+        PackedState key;
+        Solution solution;
+    };
+
+    /// @brief The maximum number of solutions kept
+    const size_t capacity_;
+
+    /// @brief Guards the list and the index
+    mutable std::mutex mutex_;
+
+    /// @brief The entries from the most to the least recently used
+    std::list<Entry> entries_;
+
+    /// @brief The entries indexed by their key
+    std::unordered_map<PackedState, std::list<Entry>::iterator> index_;
+
+    /// @brief The number of lookups that found a solution
+    std::atomic<std::uint64_t> hits_;
+
+    /// @brief The number of lookups that did not find a solution
+    std::atomic<std::uint64_t> misses_;
+};
+} // namespace search
+
+#endif // INCLUDE_SEARCH_SOLUTIONCACHELIB_H_
@@ -0,0 +1,100 @@
+#ifndef INCLUDE_SEARCH_TRANSPOSITIONLIB_H_
+#define INCLUDE_SEARCH_TRANSPOSITIONLIB_H_
+
+#include <atomic>  // std::atomic
+#include <cstdint> // std::uint8_t, std::uint64_t
+#include <vector>  // std::vector
+
+#include "search/packedstatelib.hpp" // search::PackedState
+
+namespace search
+{
+/// @brief What a searcher counts while it uses a table
+/// NOTE: every thread keeps its own, so the probes do not all write one cache line
+struct TableCounters
+{
+    /// @brief The number of probes that found the state
+    std::uint64_t hits;
+
+    /// @brief The number of probes that did not find the state
+    std::uint64_t misses;
+
+    /// @brief The number of stores that evicted another state of the current search
+    std::uint64_t collisions;
+
+    /// @brief Adds the counts of another searcher
+    /// @param other The counts of the other searcher
+    /// @return The sum
+    inline TableCounters &operator+=(const TableCounters &other) noexcept
+    {
+        hits += other.hits;
+        misses += other.misses;
+        collisions += other.collisions;
+        return *this;
+    }
+};
+
+/// @brief A fixed-size table of the lower bounds the searches proved, shared without locks
+///
+/// Every entry is a single atomic word that holds the key, the bound, the
+/// depth that was searched to prove it and the generation of the search, so a
+/// reader always sees a whole entry and never needs a lock. The slots are
+/// grouped in buckets of four; a store takes the slot of the same state or
+/// evicts the entry of an older search first and the shallowest one next. A
+/// lost race only drops the store, which a cache can afford.
+///
+/// A lower bound of the distance to the goal is a property of the state and
+/// not of the search that proved it, so the entries stay valid across
+/// puzzles. All member functions but Clear() are thread-safe. The table
+/// counts nothing itself, the callers pass in the counters of their thread.
+class TranspositionTable
+{
+public:
+    /// @brief Constructs the table
+    /// @param memoryBudget The most memory the slots may take in bytes
+    explicit TranspositionTable(size_t memoryBudget);
+
+    TranspositionTable(const TranspositionTable &) = delete;
+
+    TranspositionTable &operator=(const TranspositionTable &) = delete;
+
+    /// @brief Looks up the lower bound of a state
+    /// @param state The packed state
+    /// @param counters The counters of the calling thread
+    /// @return The lower bound of the distance to the goal, 0 if it is not known
+    int Probe(PackedState state, TableCounters &counters) const noexcept;
+
+    /// @brief Stores a lower bound of a state
+    /// @param state The packed state
+    /// @param bound The lower bound of the distance to the goal
+    /// @param depth The number of moves that were searched below the state to prove it
+    /// @param counters The counters of the calling thread
+    void Store(PackedState state, int bound, int depth, TableCounters &counters) noexcept;
+
+    /// @brief Starts a new search, the entries of the older ones are evicted first
+    void NewSearch() noexcept;
+
+    /// @brief Forgets every entry
+    /// NOTE: not thread-safe, no search may use the table meanwhile
+    void Clear() noexcept;
+
+    /// @brief Gets the number of slots
+    /// @return The number of slots
+    inline size_t GetCapacity() const noexcept { return slots_.size(); }
+
+private:
+    /// @brief Gets the first slot of the bucket of a state
+    /// @param state The packed state
+    /// @return The index of the slot
+    size_t GetBucket(PackedState state) const noexcept;
+
+private:
+    /// @brief The slots, 0 is empty (no packed state of a layout is 0)
+    std::vector<std::atomic<std::uint64_t>> slots_;
+
+    /// @brief The generation of the current search
+    std::atomic<std::uint8_t> generation_;
+};
+} // namespace search
+
+#endif // INCLUDE_SEARCH_TRANSPOSITIONLIB_H_
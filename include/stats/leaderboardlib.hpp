@@ -0,0 +1,131 @@
+#ifndef INCLUDE_STATS_LEADERBOARDLIB_H_
+#define INCLUDE_STATS_LEADERBOARDLIB_H_
+
+#include <array>   // std::array
+#include <cstdint> // std::uint16_t, std::uint32_t, std::uint64_t
+#include <mutex>   // std::mutex
+#include <string>  // std::string
+#include <utility> // std::to_underlying
+
+#include "stats/skiplistlib.hpp" // stats::RankedSkipList
+#include "stats/statslib.hpp"    // stats::GameRecord
+
+namespace stats
+{
+/// @brief The difficulty bands, by the number of optimal moves
+enum struct Band : int
+{
+    EASY = 0, // up to 10 moves
+    MEDIUM,   // up to 20 moves
+    HARD      // more than 20 moves
+};
+
+/// @brief The number of difficulty bands
+constexpr int numOfBands = std::to_underlying(Band::HARD) + 1;
+
+/// @brief Gets the difficulty band of a puzzle
+/// @param optimalMoves The number of optimal moves
+/// @return The band
+Band GetBand(unsigned optimalMoves) noexcept;
+
+/// @brief A game on the leaderboard as it is stored on disk and sent over the socket
+struct Entry
+{
+    /// @brief The number of optimal moves
+    std::uint16_t optimalMoves;
+
+    /// @brief The number of moves the user made
+    std::uint16_t userMoves;
+
+    /// @brief The time the user played in milliseconds
+    std::uint32_t durationMs;
+};
+
+static_assert(sizeof(Entry) == 8, "the on-disk entry must stay 8 bytes");
+
+/// @brief Gets the leaderboard entry of a game
+/// @param record The record of the game
+/// @return The entry
+inline Entry ToEntry(const GameRecord &record) noexcept
+{
+    return {record.optimalMoves, record.userMoves, record.durationMs};
+}
+
+/// @brief Where a game stands in its band
+struct Standing
+{
+    /// @brief The band of the game
+    std::uint32_t band;
+
+    /// @brief The 1-based rank by moves over optimal moves (ties share a rank)
+    std::uint32_t efficiencyRank;
+
+    /// @brief The 1-based rank by time (ties share a rank)
+    std::uint32_t timeRank;
+
+    /// @brief The number of games in the band
+    std::uint32_t numOfEntries;
+};
+
+/// @brief The best games per difficulty band, ranked by efficiency and by time
+///
+/// Each band keeps its games in two ranked skiplists, so the rank of a new game
+/// out of all the games in its band is found in O(log N). The entries are
+/// appended to a file and read back on startup. All member functions are
+/// thread-safe.
+class Leaderboard
+{
+public:
+    /// @brief Opens the leaderboard and reads the existing entries
+    /// @param path The path to the file
+    explicit Leaderboard(std::string path);
+
+    ~Leaderboard();
+
+    Leaderboard(const Leaderboard &) = delete;
+
+    Leaderboard &operator=(const Leaderboard &) = delete;
+
+    /// @brief Adds a game and saves it
+    /// @param entry The game
+    /// @return Where the game stands in its band
+    Standing Submit(const Entry &entry);
+
+    /// @brief Finds where a game would stand without adding it
+    /// @param entry The game
+    /// @return Where the game would stand in its band
+    Standing GetStanding(const Entry &entry) const;
+
+private:
+    /// @brief The rankings of a band
+    struct Rankings
+    {
+        RankedSkipList efficiency;
+        RankedSkipList time;
+    };
+
+    /// @brief Adds a game to the rankings of its band
+    /// @param entry The game
+    void Insert(const Entry &entry);
+
+    /// @brief Finds where a game stands in its band
+    /// @param entry The game
+    /// @return Where the game stands
+    Standing FindStanding(const Entry &entry) const noexcept;
+
+private:
+    /// @brief The path to the file
+    std::string path_;
+
+    /// @brief The file descriptor of the file, -1 if it could not be opened
+    int fd_;
+
+    /// @brief Guards the rankings and the file
+    mutable std::mutex mutex_;
+
+    /// @brief The rankings indexed by band
+    std::array<Rankings, numOfBands> bands_;
+};
+} // namespace stats
+
+#endif // INCLUDE_STATS_LEADERBOARDLIB_H_
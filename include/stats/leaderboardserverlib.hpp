@@ -0,0 +1,102 @@
+#ifndef INCLUDE_STATS_LEADERBOARDSERVERLIB_H_
+#define INCLUDE_STATS_LEADERBOARDSERVERLIB_H_
+
+#include <atomic>   // std::atomic
+#include <cstdint>  // std::uint32_t
+#include <optional> // std::optional
+#include <string>   // std::string
+#include <thread>   // std::thread
+
+#include "stats/leaderboardlib.hpp" // stats::Leaderboard, stats::Entry, stats::Standing
+
+namespace stats
+{
+/// @brief The socket that the kiosks on one host share by default
+constexpr const char *defaultLeaderboardSocket = "/tmp/8puzzle-leaderboard.sock";
+
+/// @brief The file the server keeps the shared leaderboard in by default
+/// NOTE: a kiosk without the server falls back to a file of its own, never this one
+constexpr const char *defaultLeaderboardPath = "leaderboard.bin";
+
+/// @brief Serves a leaderboard over a unix domain socket
+///
+/// Every connection carries one request (an operation and an Entry) and one
+/// reply (a Standing). The structs are sent as they are since both ends run on
+/// the same host and are built from the same headers.
+class LeaderboardServer
+{
+public:
+    /// @brief Starts listening on the socket
+    /// @param leaderboard The leaderboard to serve
+    /// @param socketPath The path to the socket (replaced if it exists)
+    LeaderboardServer(Leaderboard &leaderboard, std::string socketPath);
+
+    /// @brief Stops listening and removes the socket
+    ~LeaderboardServer();
+
+    LeaderboardServer(const LeaderboardServer &) = delete;
+
+    LeaderboardServer &operator=(const LeaderboardServer &) = delete;
+
+    /// @brief Checks if the server is listening
+    /// @return TRUE if the socket could be bound
+    inline bool IsListening() const noexcept { return listenFd_ >= 0; }
+
+private:
+    /// @brief Accepts and answers connections until the server is destroyed
+    void AcceptLoop();
+
+    /// @brief Answers the request of a connection
+    /// @param fd The file descriptor of the connection
+    void HandleConnection(int fd);
+
+private:
+    /// @brief The leaderboard to serve
+    Leaderboard &leaderboard_;
+
+    /// @brief The path to the socket
+    std::string socketPath_;
+
+    /// @brief The file descriptor of the listening socket, -1 if it could not be bound
+    int listenFd_;
+
+    /// @brief TRUE once the server is being destroyed
+    std::atomic<bool> stop_;
+
+    /// @brief The thread that accepts the connections
+    /// NOTE: declared last so everything above exists before it starts
+    std::thread acceptor_;
+};
+
+/// @brief Talks to a LeaderboardServer
+class LeaderboardClient
+{
+public:
+    /// @brief Constructs the client
+    /// @param socketPath The path to the socket of the server
+    explicit LeaderboardClient(std::string socketPath);
+
+    /// @brief Adds a game to the shared leaderboard
+    /// @param entry The game
+    /// @return Where the game stands in its band, nullopt if the server cannot be reached
+    std::optional<Standing> Submit(const Entry &entry) const;
+
+    /// @brief Finds where a game would stand on the shared leaderboard
+    /// @param entry The game
+    /// @return Where the game would stand, nullopt if the server cannot be reached
+    std::optional<Standing> GetStanding(const Entry &entry) const;
+
+private:
+    /// @brief Sends a request and waits for the reply
+    /// @param op The operation
+    /// @param entry The game
+    /// @return The reply, nullopt if the server cannot be reached
+    std::optional<Standing> Request(std::uint32_t op, const Entry &entry) const;
+
+private:
+    /// @brief The path to the socket of the server
+    std::string socketPath_;
+};
+} // namespace stats
+
+#endif // INCLUDE_STATS_LEADERBOARDSERVERLIB_H_
@@ -0,0 +1,108 @@
+#ifndef INCLUDE_STATS_SKIPLISTLIB_H_
+#define INCLUDE_STATS_SKIPLISTLIB_H_
+
+#include <cstddef> // size_t
+#include <cstdint> // std::uint32_t, std::uint64_t, UINT32_MAX
+#include <vector>  // std::vector
+
+namespace stats
+{
+/// @brief A sorted multiset of keys that knows the position of every key
+///
+/// Every link of the skiplist also stores how many positions it skips, so the
+/// rank of a key and the key at a rank are found on the way down in O(log N)
+/// expected time. The nodes live in one vector and refer to each other by
+/// index, and keys are never removed, which is all a leaderboard needs.
+class RankedSkipList
+{
+public:
+    /// @brief The maximum number of levels, enough for 4^16 keys
+    static constexpr size_t maxLevel = 16;
+
+    /// @brief Constructs an empty list with the default seed
+    RankedSkipList();
+
+    /// @brief Constructs an empty list
+    /// @param seed The seed of the level generator
+    explicit RankedSkipList(std::uint64_t seed);
+
+    /// @brief Inserts a key after the keys that are equal to it
+    /// @param key The key
+    /// @return The 0-based position of the new key
+    size_t Insert(std::uint64_t key);
+
+    /// @brief Counts the keys that are less than a key
+    /// @param key The key
+    /// @return The number of keys
+    size_t CountLess(std::uint64_t key) const noexcept;
+
+    /// @brief Gets the key at a position
+    /// @param rank The 0-based position (must be less than GetSize())
+    /// @return The key
+    std::uint64_t GetKeyAt(size_t rank) const noexcept;
+
+    /// @brief Gets the number of keys
+    /// @return The number of keys
+    inline size_t GetSize() const noexcept { return size_; }
+
+private:
+    /// @brief The index of the node that ends every level
+    static constexpr std::uint32_t nil = UINT32_MAX;
+
+    /// @brief The index of the head node
+    static constexpr std::uint32_t head = 0;
+
+    /// @brief A link to the next node of a level
+    struct Link
+    {
+        /// @brief The index of the next node, nil if there is none
+        std::uint32_t next;
+
+        /// @brief The number of positions the link skips
+        std::uint32_t span;
+    };
+
+    /// @brief Picks the number of levels of a new node (1 in 4 nodes go up a level)
+    /// @return The number of levels
+    size_t GetRandomLevel() noexcept;
+
+    /// @brief Gets a link of a node
+    /// @param node The index of the node
+    /// @param level The level
+    /// @return The link
+    inline Link &GetLink(std::uint32_t node, size_t level) noexcept
+    {
+        return links_[firstLinks_[node] + level];
+    }
+
+    /// @brief Gets a link of a node
+    /// @param node The index of the node
+    /// @param level The level
+    /// @return The link
+    inline const Link &GetLink(std::uint32_t node, size_t level) const noexcept
+    {
+        return links_[firstLinks_[node] + level];
+    }
+
+private:
+    /// @brief The keys indexed by node (the key of the head is unused)
+    std::vector<std::uint64_t> keys_;
+
+    /// @brief The index of the first link of every node
+    std::vector<std::uint32_t> firstLinks_;
+
+    /// @brief The links of all the nodes, from the bottom level up
+    std::vector<Link> links_;
+
+    /// @brief The number of levels in use
+    size_t level_;
+
+    /// @brief The number of keys
+    size_t size_;
+
+    /// @brief The state of the level generator
+    std::uint64_t rngState_;
+};
+} // namespace stats
+
+#endif // INCLUDE_STATS_SKIPLISTLIB_H_
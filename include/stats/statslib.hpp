@@ -0,0 +1,160 @@
+#ifndef INCLUDE_STATS_STATSLIB_H_
+#define INCLUDE_STATS_STATSLIB_H_
+
+#include <array>              // std::array
+#include <atomic>             // std::atomic
+#include <condition_variable> // std::condition_variable
+#include <cstdint>            // std::int64_t, std::uint8_t, std::uint16_t, std::uint64_t
+#include <mutex>              // std::mutex
+#include <string>             // std::string
+#include <thread>             // std::thread
+#include <type_traits>        // std::is_trivially_copyable_v
+#include <vector>             // std::vector
+
+namespace stats
+{
+/// @brief The longest optimal solution of an 8 puzzle
+constexpr int maxOptimalMoves = 31;
+
+/// @brief A completed game as it is stored on disk
+///
+/// The record has a fixed size so the log can be appended to and read back
+/// without any framing, and a torn write at the end is easy to detect.
+struct GameRecord
+{
+    /// @brief The packed start layout (see search::PackedState)
+    std::uint64_t startState;
+
+    /// @brief The time the game ended in seconds since the epoch
+    std::int64_t finishedAt;
+
+    /// @brief The time the user played in milliseconds
+    std::uint32_t durationMs;
+
+    /// @brief The number of optimal moves from the start layout
+    std::uint16_t optimalMoves;
+
+    /// @brief The number of moves the user made (before asking for help)
+    std::uint16_t userMoves;
+
+    /// @brief 1 if the user asked for help, 0 otherwise
+    std::uint8_t usedHelp;
+
+    /// @brief Reserved for later versions (always 0)
+    std::array<std::uint8_t, 7> reserved;
+};
+
+static_assert(sizeof(GameRecord) == 32, "the on-disk record must stay 32 bytes");
+static_assert(std::is_trivially_copyable_v<GameRecord>, "records are written byte by byte");
+
+/// @brief The totals of all the games in the log
+struct Summary
+{
+    /// @brief The number of games
+    std::uint64_t numOfGames;
+
+    /// @brief The number of games where the user asked for help
+    std::uint64_t numOfHelped;
+
+    /// @brief The number of games solved in the optimal number of moves
+    std::uint64_t numOfPerfect;
+
+    /// @brief The moves of the user in the games solved without help
+    std::uint64_t totalUserMoves;
+
+    /// @brief The optimal moves of the games solved without help
+    std::uint64_t totalOptimalMoves;
+
+    /// @brief The time played in milliseconds
+    std::uint64_t totalDurationMs;
+
+    /// @brief The fastest solve without help indexed by the optimal moves, 0 if there is none
+    std::array<std::uint32_t, maxOptimalMoves + 1> bestDurationMs;
+};
+
+/// @brief An append-only log of completed games
+///
+/// Append() only copies the record into a queue and updates the summary, so it
+/// is cheap enough for the frame path. A writer thread writes the queued
+/// records and syncs the file once a batch is full or a few seconds have
+/// passed. If the file cannot be opened the summary still works, just without
+/// persistence.
+class StatsLog
+{
+public:
+    /// @brief The number of records that are synced together
+    static constexpr size_t syncBatchSize = 64;
+
+    /// @brief Opens the log, reads the existing records into the summary and starts the writer
+    /// @param path The path to the log
+    explicit StatsLog(std::string path);
+
+    /// @brief Writes and syncs the queued records and stops the writer
+    ~StatsLog();
+
+    StatsLog(const StatsLog &) = delete;
+
+    StatsLog &operator=(const StatsLog &) = delete;
+
+    /// @brief Queues a record and adds it to the summary
+    /// @param record The record
+    void Append(const GameRecord &record);
+
+    /// @brief Gets the totals of all the games so far (including the queued ones)
+    /// @return The summary
+    inline const Summary &GetSummary() const noexcept { return summary_; }
+
+    /// @brief Gets the number of records that are synced to the disk
+    /// @return The number of records
+    inline std::uint64_t GetNumOfPersisted() const noexcept
+    {
+        return numOfPersisted_.load(std::memory_order_relaxed);
+    }
+
+private:
+    /// @brief Reads the records in the file into the summary
+    void Load();
+
+    /// @brief Adds a record to the summary
+    /// @param record The record
+    void AddToSummary(const GameRecord &record) noexcept;
+
+    /// @brief Writes the queued records until the log is destroyed
+    void WriterLoop();
+
+    /// @brief Writes a batch of records and syncs the file
+    /// @param batch The records
+    void WriteBatch(const std::vector<GameRecord> &batch);
+
+private:
+    /// @brief The path to the log
+    std::string path_;
+
+    /// @brief The file descriptor of the log, -1 if it could not be opened
+    int fd_;
+
+    /// @brief The totals of all the games (only touched by the owning thread)
+    Summary summary_;
+
+    /// @brief Guards the queue and the stop flag
+    std::mutex mutex_;
+
+    /// @brief Wakes the writer when a batch is full or the log is destroyed
+    std::condition_variable cv_;
+
+    /// @brief The records that are not written yet
+    std::vector<GameRecord> pending_;
+
+    /// @brief TRUE once the log is being destroyed
+    bool stop_;
+
+    /// @brief The number of records that are synced to the disk
+    std::atomic<std::uint64_t> numOfPersisted_;
+
+    /// @brief The thread that writes and syncs the records
+    /// NOTE: declared last so everything above exists before it starts
+    std::thread writer_;
+};
+} // namespace stats
+
+#endif // INCLUDE_STATS_STATSLIB_H_
@@ -0,0 +1,243 @@
+#ifndef INCLUDE_UTILS_RANDOMLIB_H_
+#define INCLUDE_UTILS_RANDOMLIB_H_
+
+#include <array>        // std::array
+#include <bit>          // std::rotl
+#include <charconv>     // std::from_chars
+#include <cmath>        // std::sqrt, std::log, std::cos, std::sin
+#include <cstddef>      // size_t
+#include <cstdint>      // std::uint64_t
+#include <limits>       // std::numeric_limits
+#include <optional>     // std::optional, std::nullopt
+#include <span>         // std::span
+#include <string_view>  // std::string_view
+#include <system_error> // std::errc
+#include <utility>      // std::swap, std::to_underlying
+
+/// @brief The subsystems that draw random numbers, each gets its own stream
+enum struct RandomStream : int
+{
+    CREATOR = 0,
+    ARENA,
+    CELEBRATION,
+    BENCHMARK
+};
+
+/// @brief Mixes a 64-bit value into a well distributed one (SplitMix64)
+/// @param state The state, advanced by the call
+/// @return The mixed value
+inline constexpr std::uint64_t SplitMix64(std::uint64_t &state) noexcept
+{
+    std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/// @brief A small and fast generator (xoshiro256**)
+///
+/// The whole state is four words, so a generator is cheap to create and to
+/// keep per board or per thread. It satisfies UniformRandomBitGenerator, so it
+/// also works with std::shuffle and the standard distributions.
+class Xoshiro256
+{
+public:
+    using result_type = std::uint64_t;
+
+    /// @brief Seeds the generator
+    /// @param seed The seed, expanded into the state with SplitMix64
+    explicit constexpr Xoshiro256(std::uint64_t seed) noexcept
+        : state_{},
+          spareNormal_(0.0f),
+          hasSpareNormal_(false)
+    {
+        for (std::uint64_t &word : state_)
+        {
+            word = SplitMix64(seed);
+        }
+    }
+
+    static constexpr result_type min() noexcept { return 0; }
+
+    static constexpr result_type max() noexcept
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    /// @brief Gets the next 64 random bits
+    /// @return The random bits
+    inline constexpr result_type operator()() noexcept
+    {
+        const std::uint64_t result = std::rotl(state_[1] * 5, 7) * 9;
+        const std::uint64_t t = state_[1] << 17;
+
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = std::rotl(state_[3], 45);
+
+        return result;
+    }
+
+    /// @brief Gets a uniform float
+    /// @param lo The lower bound (inclusive)
+    /// @param hi The upper bound (exclusive)
+    /// @return The random float
+    inline float NextFloat(float lo, float hi) noexcept
+    {
+        // The top 24 bits fill the mantissa exactly
+        constexpr float scale = 1.0f / (1 << 24);
+        return lo + (hi - lo) * (static_cast<float>((*this)() >> 40) * scale);
+    }
+
+    /// @brief Gets a uniform integer
+    /// @param lo The lower bound (inclusive)
+    /// @param hi The upper bound (inclusive)
+    /// @return The random integer
+    inline int NextInt(int lo, int hi) noexcept
+    {
+        // Multiply and keep the high half instead of a division (Lemire)
+        const std::uint64_t range = static_cast<std::uint64_t>(hi - lo) + 1;
+        const std::uint64_t bits = (*this)() >> 32;
+        return lo + static_cast<int>((bits * range) >> 32);
+    }
+
+    /// @brief Gets a normally distributed float
+    /// @param mean The mean
+    /// @param stddev The standard deviation
+    /// @return The random float
+    inline float NextNormal(float mean, float stddev) noexcept
+    {
+        // Box-Muller gives two values at a time, so every other call is free
+        if (hasSpareNormal_)
+        {
+            hasSpareNormal_ = false;
+            return mean + stddev * spareNormal_;
+        }
+
+        constexpr float twoPi = 6.28318530717958647692f;
+        const float u = NextFloat(std::numeric_limits<float>::min(), 1.0f);
+        const float v = NextFloat(0.0f, 1.0f);
+        const float r = std::sqrt(-2.0f * std::log(u));
+
+        spareNormal_ = r * std::sin(twoPi * v);
+        hasSpareNormal_ = true;
+
+        return mean + stddev * r * std::cos(twoPi * v);
+    }
+
+    /// @brief Fills a buffer with uniform floats
+    /// @param out The buffer
+    /// @param lo The lower bound (inclusive)
+    /// @param hi The upper bound (exclusive)
+    inline void FillUniform(std::span<float> out, float lo, float hi) noexcept
+    {
+        for (float &value : out)
+        {
+            value = NextFloat(lo, hi);
+        }
+    }
+
+    /// @brief Fills a buffer with uniform integers
+    /// @param out The buffer
+    /// @param lo The lower bound (inclusive)
+    /// @param hi The upper bound (inclusive)
+    inline void FillInt(std::span<int> out, int lo, int hi) noexcept
+    {
+        for (int &value : out)
+        {
+            value = NextInt(lo, hi);
+        }
+    }
+
+    /// @brief Fills a buffer with normally distributed floats
+    /// @param out The buffer
+    /// @param mean The mean
+    /// @param stddev The standard deviation
+    inline void FillNormal(std::span<float> out, float mean, float stddev) noexcept
+    {
+        for (float &value : out)
+        {
+            value = NextNormal(mean, stddev);
+        }
+    }
+
+    /// @brief Shuffles a range in place (Fisher-Yates)
+    /// @param values The range
+    template <typename T> inline void Shuffle(std::span<T> values) noexcept
+    {
+        for (size_t i = values.size(); i > 1; i--)
+        {
+            const size_t j = static_cast<size_t>(NextInt(0, static_cast<int>(i) - 1));
+            std::swap(values[i - 1], values[j]);
+        }
+    }
+
+private:
+    /// @brief The state of the generator
+    std::array<std::uint64_t, 4> state_;
+
+    /// @brief The second value of the last Box-Muller pair
+    float spareNormal_;
+
+    /// @brief TRUE if spareNormal_ has not been used yet
+    bool hasSpareNormal_;
+};
+
+/// @brief Hands out independent generators derived from one master seed
+///
+/// The same master seed gives the same numbers in every subsystem, which makes
+/// a run reproducible. Deriving a generator is a handful of multiplications,
+/// so a subsystem can derive one per board or per thread instead of sharing
+/// one behind a lock.
+class RandomService
+{
+public:
+    /// @brief Constructs the service
+    /// @param masterSeed The seed that every stream is derived from
+    explicit constexpr RandomService(std::uint64_t masterSeed) noexcept : masterSeed_(masterSeed)
+    {
+    }
+
+    /// @brief Gets the master seed
+    /// @return The master seed
+    inline constexpr std::uint64_t GetMasterSeed() const noexcept { return masterSeed_; }
+
+    /// @brief Derives the generator of a subsystem
+    /// @param stream The subsystem
+    /// @param index The index of the generator within the subsystem (e.g. a board)
+    /// @return The generator
+    inline constexpr Xoshiro256 MakeStream(RandomStream stream,
+                                           std::uint64_t index = 0) const noexcept
+    {
+        // The subsystem picks the seed of the stream, the index a generator in it
+        const std::uint64_t streamId = static_cast<std::uint64_t>(std::to_underlying(stream));
+        std::uint64_t state = masterSeed_ ^ (streamId << 56);
+        state = SplitMix64(state) ^ index;
+
+        return Xoshiro256(SplitMix64(state));
+    }
+
+private:
+    /// @brief The seed that every stream is derived from
+    std::uint64_t masterSeed_;
+};
+
+/// @brief Parses a master seed given on the command line
+/// @param text The decimal seed, nothing else
+/// @return The seed, std::nullopt if the text is not a number that fits into 64 bits
+inline std::optional<std::uint64_t> ParseSeed(std::string_view text) noexcept
+{
+    std::uint64_t seed = 0;
+    const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), seed);
+    if ((error != std::errc{}) || (end != text.data() + text.size()))
+    {
+        return std::nullopt;
+    }
+
+    return seed;
+}
+
+#endif // INCLUDE_UTILS_RANDOMLIB_H_
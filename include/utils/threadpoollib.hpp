@@ -0,0 +1,118 @@
+#ifndef INCLUDE_UTILS_THREADPOOLLIB_H_
+#define INCLUDE_UTILS_THREADPOOLLIB_H_
+
+#include <atomic>             // std::atomic
+#include <condition_variable> // std::condition_variable
+#include <cstdint>            // std::uint64_t
+#include <deque>              // std::deque
+#include <functional>         // std::function
+#include <future>             // std::future, std::packaged_task
+#include <mutex>              // std::mutex
+#include <thread>             // std::thread
+#include <vector>             // std::vector
+
+/// @brief A fixed set of worker threads that split loops between them
+///
+/// The calling thread joins the workers, so a pool with no workers simply runs
+/// everything on the caller. Longer one-off tasks go to a background thread of
+/// their own, so they never hold up the workers of a loop.
+class ThreadPool
+{
+public:
+    /// @brief The signature of a job, which handles the indices in [begin, end)
+    using Job = std::function<void(size_t begin, size_t end)>;
+
+    /// @brief Constructs the pool
+    /// @param numOfWorkers The number of worker threads (not counting the caller)
+    explicit ThreadPool(unsigned numOfWorkers);
+
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /// @brief Runs a job over [0, count) in chunks and waits for all of them
+    /// NOTE: while another thread has a loop running, the job runs on the caller alone
+    /// @param count The number of indices
+    /// @param grain The number of indices in a chunk
+    /// @param job The job
+    void ParallelFor(size_t count, size_t grain, const Job &job);
+
+    /// @brief Runs a task on the background thread, after the tasks submitted before it
+    /// @param task The task
+    /// @return The future that is ready once the task has run
+    std::future<void> Submit(std::function<void()> task);
+
+    /// @brief Gets the number of threads that run a job (including the caller)
+    /// @return The number of threads
+    inline unsigned GetNumOfThreads() const noexcept
+    {
+        return static_cast<unsigned>(workers_.size()) + 1;
+    }
+
+private:
+    /// @brief Waits for jobs until the pool is destroyed
+    void WorkerLoop();
+
+    /// @brief Takes chunks of the current job until there are none left
+    void RunChunks();
+
+    /// @brief Runs the submitted tasks until the pool is destroyed
+    void BackgroundLoop();
+
+private:
+    /// @brief The worker threads
+    std::vector<std::thread> workers_;
+
+    /// @brief Guards the job and the counters below
+    std::mutex mutex_;
+
+    /// @brief Wakes the workers when there is a new job or the pool stops
+    std::condition_variable wakeCv_;
+
+    /// @brief Wakes the caller when all workers are done
+    std::condition_variable doneCv_;
+
+    /// @brief The current job
+    const Job *job_;
+
+    /// @brief The number of indices of the current job
+    size_t count_;
+
+    /// @brief The number of indices in a chunk of the current job
+    size_t grain_;
+
+    /// @brief The first index that has not been taken yet
+    std::atomic<size_t> next_;
+
+    /// @brief The number of workers still on the current job
+    unsigned busy_;
+
+    /// @brief Increases with every job so the workers can tell a new one apart
+    std::uint64_t generation_;
+
+    /// @brief TRUE once the pool is being destroyed
+    bool stop_;
+
+    /// @brief Held by the thread whose loop the workers are on
+    std::mutex callerMutex_;
+
+    /// @brief Guards the submitted tasks and the stop flag of the background thread
+    std::mutex taskMutex_;
+
+    /// @brief Wakes the background thread when there is a task or the pool stops
+    std::condition_variable taskCv_;
+
+    /// @brief The submitted tasks that have not run yet
+    std::deque<std::packaged_task<void()>> tasks_;
+
+    /// @brief TRUE once the background thread should finish
+    bool stopTasks_;
+
+    /// @brief The thread that runs the submitted tasks
+    /// NOTE: declared last so everything above exists before it starts
+    std::thread background_;
+};
+
+#endif // INCLUDE_UTILS_THREADPOOLLIB_H_
@@ -1,23 +1,23 @@
-#include "raylib.h" // GetScreenHeight, MeasureText, DrawRectangle, etc.
+#include "raylib.h" // MeasureText, DrawRectangle, etc.
 
 #include "gui/animationlib.hpp"
 
 namespace
 {
 constexpr int padding = 10;
-constexpr int logoWidth = 112;
 constexpr int authorTxtFont = 50;
 constexpr int subtxtFont = 30;
 constexpr int recHeight = 16;
 constexpr int recWidth = 256;
+constexpr int innerRecWidth = recWidth - 2 * recHeight;
+constexpr int farSideOffset = recWidth - recHeight;
+constexpr int authorTxtOffsetY = 48;
+constexpr int subtxtOffsetY = 150;
 } // namespace
 
-RaylibAnimation::RaylibAnimation()
-    : curState_(LoadingState::SMALL_BOX_BLINKING),
-      screenWidth_(GetScreenHeight()),
-      screenHeight_(GetScreenHeight()),
-      logoPositionX_(screenWidth_ / 2 - recWidth / 2),
-      logoPositionY_(screenHeight_ / 2 - recWidth / 2),
+RaylibAnimation::RaylibAnimation(const gui::Layout &layout)
+    : layout_(layout),
+      curState_(LoadingState::SMALL_BOX_BLINKING),
       leftSideRecHeight_(recHeight),
       topSideRecWidth_(recHeight),
       topSideRecHeight_(recHeight),
@@ -106,13 +106,19 @@ void RaylibAnimation::Update()
 
 void RaylibAnimation::Draw() const
 {
+    // The logo stays in the centre of the screen
+    const int centreX = static_cast<int>(layout_.centre.x);
+    const int centreY = static_cast<int>(layout_.centre.y);
+    const int logoPositionX = centreX - recWidth / 2;
+    const int logoPositionY = centreY - recWidth / 2;
+
     switch (curState_)
     {
     case LoadingState::SMALL_BOX_BLINKING:
     {
         if ((framesCounter_ / 15) % 2)
         {
-            DrawRectangle(logoPositionX_, logoPositionY_, topSideRecHeight_, topSideRecHeight_,
+            DrawRectangle(logoPositionX, logoPositionY, topSideRecHeight_, topSideRecHeight_,
                           BLACK);
         }
 
@@ -120,44 +126,45 @@ void RaylibAnimation::Draw() const
     }
     case LoadingState::LEFT_BOX_GROWING:
     {
-        DrawRectangle(logoPositionX_, logoPositionY_, topSideRecWidth_, topSideRecHeight_, BLACK);
-        DrawRectangle(logoPositionX_, logoPositionY_, topSideRecHeight_, leftSideRecHeight_, BLACK);
+        DrawRectangle(logoPositionX, logoPositionY, topSideRecWidth_, topSideRecHeight_, BLACK);
+        DrawRectangle(logoPositionX, logoPositionY, topSideRecHeight_, leftSideRecHeight_, BLACK);
         break;
     }
     case LoadingState::RIGHT_BOX_GROWING:
     {
-        DrawRectangle(logoPositionX_, logoPositionY_, topSideRecWidth_, 16, BLACK);
-        DrawRectangle(logoPositionX_, logoPositionY_, topSideRecHeight_, leftSideRecHeight_, BLACK);
+        DrawRectangle(logoPositionX, logoPositionY, topSideRecWidth_, recHeight, BLACK);
+        DrawRectangle(logoPositionX, logoPositionY, topSideRecHeight_, leftSideRecHeight_, BLACK);
 
-        DrawRectangle(logoPositionX_ + 240, logoPositionY_, topSideRecHeight_, rightSideRecHeight_,
+        DrawRectangle(logoPositionX + farSideOffset, logoPositionY, topSideRecHeight_,
+                      rightSideRecHeight_, BLACK);
+        DrawRectangle(logoPositionX, logoPositionY + farSideOffset, bottomSideRecWidth_, recHeight,
                       BLACK);
-        DrawRectangle(logoPositionX_, logoPositionY_ + 240, bottomSideRecWidth_, 16, BLACK);
         break;
     }
     case LoadingState::LETTER_APPEARING:
     {
-        DrawRectangle(logoPositionX_, logoPositionY_, topSideRecWidth_, topSideRecHeight_,
+        DrawRectangle(logoPositionX, logoPositionY, topSideRecWidth_, topSideRecHeight_,
                       Fade(BLACK, alpha_));
-        DrawRectangle(logoPositionX_, logoPositionY_ + 16, topSideRecHeight_,
-                      leftSideRecHeight_ - 32, Fade(BLACK, alpha_));
+        DrawRectangle(logoPositionX, logoPositionY + recHeight, topSideRecHeight_,
+                      leftSideRecHeight_ - 2 * recHeight, Fade(BLACK, alpha_));
 
-        DrawRectangle(logoPositionX_ + 240, logoPositionY_ + 16, topSideRecHeight_,
+        DrawRectangle(logoPositionX + farSideOffset, logoPositionY + recHeight, topSideRecHeight_,
                       rightSideRecHeight_ - topSideRecHeight_ * 2, Fade(BLACK, alpha_));
-        DrawRectangle(logoPositionX_, logoPositionY_ + 240, bottomSideRecWidth_, 16,
+        DrawRectangle(logoPositionX, logoPositionY + farSideOffset, bottomSideRecWidth_, recHeight,
                       Fade(BLACK, alpha_));
 
-        DrawRectangle(GetScreenWidth() / 2 - logoWidth, GetScreenHeight() / 2 - logoWidth, 224, 224,
-                      Fade(RAYWHITE, alpha_));
+        DrawRectangle(centreX - innerRecWidth / 2, centreY - innerRecWidth / 2, innerRecWidth,
+                      innerRecWidth, Fade(RAYWHITE, alpha_));
 
         DrawText(TextSubtext("raylib", 0, lettersCount_),
-                 GetScreenWidth() / 2 + logoWidth - raylibTxtWidth_ - padding,
-                 GetScreenHeight() / 2 + 48, authorTxtFont, Fade(BLACK, alpha_));
+                 centreX + innerRecWidth / 2 - raylibTxtWidth_ - padding,
+                 centreY + authorTxtOffsetY, authorTxtFont, Fade(BLACK, alpha_));
 
         // Only show the subtext when the first letter of raylib comes out
         if (lettersCount_)
         {
-            DrawText(subTitle_.data(), (GetScreenWidth() - subTxtWidth_) / 2,
-                     GetScreenHeight() / 2 + 150, subtxtFont, Fade(GRAY, alpha_));
+            DrawText(subTitle_.data(), centreX - subTxtWidth_ / 2, centreY + subtxtOffsetY,
+                     subtxtFont, Fade(GRAY, alpha_));
         }
 
         break;
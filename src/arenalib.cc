@@ -0,0 +1,139 @@
+#include <algorithm> // std::find
+#include <vector>    // std::vector
+
+#include "raylib.h" // GetFrameTime, DrawRectangleRec
+
+#include "creator/creatorlib.hpp" // creator::GetRandomLayout
+#include "gui/arenalib.hpp"
+#include "gui/colourlib.hpp"
+#include "search/packedstatelib.hpp" // search::Pack, search::Slide, search::moves
+
+namespace
+{
+constexpr int N = constants::EIGHT_PUZZLE_SIZE;
+constexpr int numOfPieces = constants::EIGHT_PUZZLE_NUM;
+constexpr float stepInterval = 0.2f;
+constexpr std::uint8_t solvedRestSteps = 10;
+
+// Each worker takes this many boards at a time
+constexpr size_t stepGrain = 8;
+} // namespace
+
+Arena::Arena(const Atlas &atlas, const gui::Layout &layout,
+             const search::DistanceTable &distanceTable, ThreadPool &pool,
+             const RandomService &random)
+    : atlas_(atlas),
+      layout_(layout),
+      distanceTable_(distanceTable),
+      pool_(pool),
+      states_(gui::arenaNumOfBoards),
+      posX_(gui::arenaNumOfBoards),
+      restSteps_(gui::arenaNumOfBoards),
+      stepTimer_(0.0f),
+      numOfSolved_(0)
+{
+    rngs_.reserve(gui::arenaNumOfBoards);
+    for (std::uint64_t i = 0; i < gui::arenaNumOfBoards; i++)
+    {
+        rngs_.push_back(random.MakeStream(RandomStream::ARENA, i));
+    }
+
+    Reset();
+}
+
+void Arena::Update()
+{
+    stepTimer_ += GetFrameTime();
+    if (stepTimer_ < stepInterval)
+    {
+        return;
+    }
+    stepTimer_ = 0.0f;
+
+    pool_.ParallelFor(states_.size(), stepGrain,
+                      [this](size_t begin, size_t end) { Step(begin, end); });
+}
+
+void Arena::Draw() const
+{
+    // NOTE: the shapes and the pieces all come from the atlas, so raylib
+    // batches the whole arena into one draw call
+    const float padding = layout_.arena.piecePadding;
+    for (size_t i = 0; i < states_.size(); i++)
+    {
+        const Rectangle &box = layout_.arena.boards[i];
+        DrawRectangleRec(box, (restSteps_[i] > 0) ? JADE_GREEN : DARKBLUE);
+
+        const float cellLen = box.width / N;
+        for (int pos = 0; pos < numOfPieces; pos++)
+        {
+            if (const int piece = search::GetPiece(states_[i], pos); piece != 0)
+            {
+                const Rectangle dest = {box.x + static_cast<float>(pos % N) * cellLen + padding,
+                                        box.y + static_cast<float>(pos / N) * cellLen + padding,
+                                        cellLen - 2 * padding, cellLen - 2 * padding};
+                atlas_.DrawStretched(gui::GetPieceSprite(piece), dest, WHITE);
+            }
+        }
+    }
+}
+
+void Arena::Reset()
+{
+    stepTimer_ = 0.0f;
+    numOfSolved_.store(0, std::memory_order_relaxed);
+
+    pool_.ParallelFor(states_.size(), stepGrain,
+                      [this](size_t begin, size_t end)
+                      {
+                          for (size_t i = begin; i < end; i++)
+                          {
+                              Shuffle(i);
+                          }
+                      });
+}
+
+void Arena::Step(size_t begin, size_t end)
+{
+    for (size_t i = begin; i < end; i++)
+    {
+        // Let a solved board show off for a while before it gets a new puzzle
+        if (restSteps_[i] > 0)
+        {
+            if (--restSteps_[i] == 0)
+            {
+                Shuffle(i);
+            }
+            continue;
+        }
+
+        const short dir = distanceTable_.GetNextMove(states_[i], posX_[i]);
+        if (dir == search::noMove)
+        {
+            restSteps_[i] = solvedRestSteps;
+            numOfSolved_.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        for (const search::Move &move : search::moves)
+        {
+            if (move.dir == dir)
+            {
+                const int target = search::GetTarget(posX_[i], move, N);
+                states_[i] = search::Slide(states_[i], posX_[i], target);
+                posX_[i] = static_cast<std::uint8_t>(target);
+                break;
+            }
+        }
+    }
+}
+
+void Arena::Shuffle(size_t idx)
+{
+    const std::vector<int> layout = creator::GetRandomLayout(rngs_[idx]);
+
+    states_[idx] = search::Pack(layout);
+    posX_[idx] = static_cast<std::uint8_t>(
+        std::find(layout.cbegin(), layout.cend(), constants::EMPTY) - layout.cbegin());
+    restSteps_[idx] = 0;
+}
@@ -0,0 +1,270 @@
+#include <algorithm>   // std::max, std::sort
+#include <cmath>       // std::lround, std::round
+#include <string_view> // std::string_view
+#include <utility>     // std::to_underlying
+#include <vector>      // std::vector
+
+#include "raylib.h" // ImageText, LoadImage, ImageDraw, LoadTextureFromImage, SetShapesTexture
+
+#include "gui/atlaslib.hpp"
+
+namespace
+{
+constexpr int minAtlasWidth = 1024;
+constexpr int atlasPadding = 2;
+constexpr int numOfPiecesPerRow = 5;
+constexpr std::array<int, std::to_underlying(gui::DigitSize::DigitSizeN)> digitFontSizes{25, 40};
+
+/// @brief The text and the font size of a text sprite
+struct TextEntry
+{
+    gui::Sprite sprite;
+    std::string_view txt;
+    int fontSize;
+};
+
+constexpr std::array<TextEntry, 33> textEntries{{
+    {gui::Sprite::UndoTxt, "Undo", 40},
+    {gui::Sprite::RedoTxt, "Redo", 40},
+    {gui::Sprite::RestartTxt, "Restart", 40},
+    {gui::Sprite::HelpTxt, "Help", 40},
+    {gui::Sprite::HintTxt, "Hint", 40},
+    {gui::Sprite::MovesTxt, "Moves: ", 40},
+    {gui::Sprite::OptimalMovesTxt, "Optimal Moves: ", 25},
+    {gui::Sprite::UserMovesTxt, "User Moves: ", 25},
+    {gui::Sprite::RankTxt, "Moves Rank: ", 25},
+    {gui::Sprite::TimeRankTxt, "Time Rank: ", 25},
+    {gui::Sprite::RankOfTxt, " of ", 25},
+    {gui::Sprite::HistoryTxt, "History: ", 25},
+    {gui::Sprite::HistoryNodesTxt, " nodes, ", 25},
+    {gui::Sprite::HistoryKibTxt, " KiB", 25},
+    {gui::Sprite::GreetingTitleTxt, "Welcome to 8 Puzzle", 60},
+    {gui::Sprite::TitleInstrTxt, "Press ENTER to start", 20},
+    {gui::Sprite::MenuInstrTxt, "Press ARROW UP or ARROW DOWN to select", 20},
+    {gui::Sprite::SettingsInstrTxt, "Click and change the settings", 20},
+    {gui::Sprite::CelebrationInstrTxt, "Press ENTER or CLICK to skip", 20},
+    {gui::Sprite::SadInstrTxt, "Press ENTER to skip", 20},
+    {gui::Sprite::PepTalkTxt, "U can do it next time!", 50},
+    {gui::Sprite::EndingInstrTxt, "Select RESTART or NEW GAME", 20},
+    {gui::Sprite::ArenaInstrTxt, "Press ENTER to go back to MENU", 20},
+    {gui::Sprite::RestartBtnTxt, "RESTART", 40},
+    {gui::Sprite::NewGameBtnTxt, "NEW GAME", 40},
+    {gui::Sprite::MenuNewGameTxt, "New Game", 35},
+    {gui::Sprite::MenuArenaTxt, "Arena", 35},
+    {gui::Sprite::MenuSettingsTxt, "Settings", 35},
+    {gui::Sprite::MenuQuitTxt, "Quit", 35},
+    {gui::Sprite::BackToMenuTxt, "Back to MENU", 40},
+    {gui::Sprite::MainVolumeTxt, "Main volume: ", 40},
+    {gui::Sprite::BackgroundMusicOnTxt, "Background music: ON", 40},
+    {gui::Sprite::BackgroundMusicOffTxt, "Background music: OFF", 40},
+}};
+
+/// @brief An image (or a part of it) that waits to be packed into the atlas
+struct PendingSprite
+{
+    Image img;
+    Rectangle srcRec;
+    Vector2 dstSize;
+    Rectangle *dstRec;
+};
+
+/// @brief Scales a font size of the reference screen
+/// @param fontSize The font size
+/// @param scale The ratio between the screen and the reference screen
+/// @return The scaled font size
+int ScaleFontSize(int fontSize, float scale)
+{
+    // NOTE: the default font is 10 pixels high so anything below it is unreadable
+    return std::max(10, static_cast<int>(std::lround(static_cast<float>(fontSize) * scale)));
+}
+} // namespace
+
+Atlas::Atlas(float scale)
+    : texture_{}
+{
+    Build(scale);
+}
+
+void Atlas::Build(float scale)
+{
+    // Release the previous build
+    if (texture_.id != 0)
+    {
+        UnloadTexture(texture_);
+    }
+
+    std::vector<PendingSprite> pending;
+    pending.reserve(textEntries.size() + 10 * digitFontSizes.size() + numOfPiecesPerRow * 2);
+
+    // Rasterize the fixed strings in white so any colour can be applied as a tint
+    std::vector<Image> ownedImgs;
+    for (const TextEntry &entry : textEntries)
+    {
+        Image img = ImageText(entry.txt.data(), ScaleFontSize(entry.fontSize, scale), WHITE);
+        ownedImgs.push_back(img);
+        pending.push_back({img,
+                           {0, 0, (float)img.width, (float)img.height},
+                           {(float)img.width, (float)img.height},
+                           &recs_[static_cast<size_t>(entry.sprite)]});
+    }
+
+    // Rasterize the digits of each size
+    for (size_t i = 0; i < digitFontSizes.size(); i++)
+    {
+        const int fontSize = ScaleFontSize(digitFontSizes[i], scale);
+        digitSpacing_[i] = static_cast<float>(fontSize / 10);
+
+        for (size_t d = 0; d < 10; d++)
+        {
+            const char digit[2] = {static_cast<char>('0' + d), '\0'};
+            Image img = ImageText(digit, fontSize, WHITE);
+            ownedImgs.push_back(img);
+            pending.push_back({img,
+                               {0, 0, (float)img.width, (float)img.height},
+                               {(float)img.width, (float)img.height},
+                               &digitRecs_[i][d]});
+        }
+    }
+
+    // Slice the puzzle pieces from the sprite sheet, ImageDraw() resizes them
+    Image numbers = LoadImage("resources/numbers.png");
+    ownedImgs.push_back(numbers);
+    const float w = static_cast<float>(numbers.width) / numOfPiecesPerRow;
+    const float h = static_cast<float>(numbers.height) / 2.0f;
+    const Vector2 pieceSize = {std::round(w * scale), std::round(h * scale)};
+    for (int num = 1; num <= std::to_underlying(gui::Sprite::PieceEight) + 1; num++)
+    {
+        const int recX = (num - 1) % numOfPiecesPerRow;
+        const int recY = (num - 1) / numOfPiecesPerRow;
+        pending.push_back({numbers,
+                           {static_cast<float>(recX) * w, static_cast<float>(recY) * h, w, h},
+                           pieceSize,
+                           &recs_[static_cast<size_t>(gui::GetPieceSprite(num))]});
+    }
+
+    // Pack the sprites row by row (tallest first) to keep the atlas small
+    std::sort(pending.begin(), pending.end(), [](const PendingSprite &a, const PendingSprite &b)
+              { return a.dstSize.y > b.dstSize.y; });
+
+    // Widen the atlas if a sprite would not fit in a row (e.g. long titles on large screens)
+    int atlasWidth = minAtlasWidth;
+    for (const PendingSprite &s : pending)
+    {
+        atlasWidth = std::max(atlasWidth, static_cast<int>(s.dstSize.x) + 2 * atlasPadding);
+    }
+
+    float x = atlasPadding;
+    float y = atlasPadding;
+    float rowHeight = 0;
+    for (PendingSprite &s : pending)
+    {
+        if (x + s.dstSize.x + atlasPadding > static_cast<float>(atlasWidth))
+        {
+            x = atlasPadding;
+            y += rowHeight + atlasPadding;
+            rowHeight = 0;
+        }
+
+        *s.dstRec = Rectangle{x, y, s.dstSize.x, s.dstSize.y};
+        x += s.dstSize.x + atlasPadding;
+        rowHeight = std::max(rowHeight, s.dstSize.y);
+    }
+
+    // Reserve a white block at the end for the shapes, and sample its centre
+    // pixel so filtering never picks up the neighbours
+    if (x + 3 + atlasPadding > static_cast<float>(atlasWidth))
+    {
+        x = atlasPadding;
+        y += rowHeight + atlasPadding;
+        rowHeight = 0;
+    }
+    whiteRec_ = Rectangle{x + 1, y + 1, 1, 1};
+    const int atlasHeight = static_cast<int>(y + std::max(rowHeight, 3.0f) + atlasPadding);
+
+    // Compose the atlas
+    Image atlas = GenImageColor(atlasWidth, atlasHeight, BLANK);
+    for (const PendingSprite &s : pending)
+    {
+        ImageDraw(&atlas, s.img, s.srcRec, *s.dstRec, WHITE);
+    }
+    ImageDrawRectangle(&atlas, static_cast<int>(x), static_cast<int>(y), 3, 3, WHITE);
+
+    texture_ = LoadTextureFromImage(atlas);
+
+    UnloadImage(atlas);
+    for (Image &img : ownedImgs)
+    {
+        UnloadImage(img);
+    }
+
+    // Route every shape through the atlas so they share the same batch
+    SetShapesTexture(texture_, whiteRec_);
+}
+
+Atlas::~Atlas()
+{
+    // Restore the default shapes texture before the atlas goes away
+    SetShapesTexture(Texture2D{}, Rectangle{});
+    UnloadTexture(texture_);
+}
+
+void Atlas::Draw(gui::Sprite sprite, Vector2 position, Color tint) const
+{
+    DrawTextureRec(texture_, recs_[static_cast<size_t>(sprite)], position, tint);
+}
+
+void Atlas::DrawStretched(gui::Sprite sprite, const Rectangle &dest, Color tint) const
+{
+    DrawTexturePro(texture_, recs_[static_cast<size_t>(sprite)], dest, {0, 0}, 0.0f, tint);
+}
+
+void Atlas::DrawNumber(unsigned value, int minDigits, gui::DigitSize size, Vector2 position,
+                       Color tint) const
+{
+    const auto &recs = digitRecs_[static_cast<size_t>(size)];
+    const float spacing = digitSpacing_[static_cast<size_t>(size)];
+
+    // Collect the digits from the least significant one
+    std::array<unsigned, 10> digits{};
+    size_t n = 0;
+    do
+    {
+        digits[n++] = value % 10;
+        value /= 10;
+    } while (value > 0);
+
+    while ((static_cast<int>(n) < minDigits) && (n < digits.size()))
+    {
+        digits[n++] = 0;
+    }
+
+    // Draw them from the most significant one
+    while (n > 0)
+    {
+        const Rectangle &rec = recs[digits[--n]];
+        DrawTextureRec(texture_, rec, position, tint);
+        position.x += rec.width + spacing;
+    }
+}
+
+float Atlas::MeasureNumber(unsigned value, int minDigits, gui::DigitSize size) const
+{
+    const auto &recs = digitRecs_[static_cast<size_t>(size)];
+    const float spacing = digitSpacing_[static_cast<size_t>(size)];
+
+    float width = 0;
+    int n = 0;
+    do
+    {
+        width += recs[value % 10].width + spacing;
+        value /= 10;
+        ++n;
+    } while (value > 0);
+
+    for (; n < minDigits; n++)
+    {
+        width += recs[0].width + spacing;
+    }
+
+    return width - spacing;
+}
@@ -0,0 +1,263 @@
+#include <algorithm> // std::fill, std::max, std::reverse
+#include <cstdint>   // std::uint64_t
+#include <span>      // std::span
+#include <vector>    // std::vector
+
+#include "slidr/constants/constantslib.hpp" // constants::EMPTY
+
+#include "search/bidirectionallib.hpp"
+#include "search/packedstatelib.hpp" // search::Pack, search::Slide, search::moves
+
+namespace
+{
+constexpr int N = constants::EIGHT_PUZZLE_SIZE;
+constexpr int numOfPieces = constants::EIGHT_PUZZLE_NUM;
+
+// The layout of an entry: the state in the low 36 bits, then the move
+constexpr int moveShift = 4 * numOfPieces;
+constexpr std::uint64_t stateMask = (std::uint64_t{1} << moveShift) - 1;
+
+// The move stored for the root of a side
+constexpr int rootMove = 0xF;
+
+// The number of slots a visited set starts with (a power of two)
+constexpr size_t initialSlots = 1 << 12;
+
+/// @brief Gets the position of the empty piece
+/// @param state The packed state
+/// @return The position of the empty piece
+int GetPosX(search::PackedState state) noexcept
+{
+    int posX = 0;
+    while (search::GetPiece(state, posX) != 0)
+    {
+        posX++;
+    }
+
+    return posX;
+}
+
+/// @brief Gets the slot a state starts probing from
+/// @param state The packed state
+/// @param mask The number of slots minus one
+/// @return The index of the slot
+size_t GetHome(search::PackedState state, size_t mask) noexcept
+{
+    std::uint64_t h = state * 0x9E3779B97F4A7C15ULL;
+    h ^= h >> 29;
+
+    return static_cast<size_t>(h) & mask;
+}
+} // namespace
+
+namespace search
+{
+BidirectionalSearch::VisitedSet::VisitedSet() : slots_(initialSlots, 0), size_(0)
+{
+}
+
+void BidirectionalSearch::VisitedSet::Clear() noexcept
+{
+    std::fill(slots_.begin(), slots_.end(), 0);
+    size_ = 0;
+}
+
+bool BidirectionalSearch::VisitedSet::Insert(PackedState state, int moveIdx)
+{
+    // Keep the load at most one half so the probes stay short
+    if (2 * (size_ + 1) > slots_.size())
+    {
+        Grow();
+    }
+
+    const size_t mask = slots_.size() - 1;
+    for (size_t i = GetHome(state, mask);; i = (i + 1) & mask)
+    {
+        if (slots_[i] == 0)
+        {
+            slots_[i] = state | (static_cast<std::uint64_t>(moveIdx) << moveShift);
+            size_++;
+            return true;
+        }
+
+        if ((slots_[i] & stateMask) == state)
+        {
+            return false;
+        }
+    }
+}
+
+std::uint64_t BidirectionalSearch::VisitedSet::Find(PackedState state) const noexcept
+{
+    const size_t mask = slots_.size() - 1;
+    for (size_t i = GetHome(state, mask);; i = (i + 1) & mask)
+    {
+        if ((slots_[i] == 0) || ((slots_[i] & stateMask) == state))
+        {
+            return slots_[i];
+        }
+    }
+}
+
+void BidirectionalSearch::VisitedSet::Grow()
+{
+    std::vector<std::uint64_t> old(2 * slots_.size(), 0);
+    old.swap(slots_);
+
+    const size_t mask = slots_.size() - 1;
+    for (const std::uint64_t entry : old)
+    {
+        if (entry == 0)
+        {
+            continue;
+        }
+
+        size_t i = GetHome(entry & stateMask, mask);
+        while (slots_[i] != 0)
+        {
+            i = (i + 1) & mask;
+        }
+        slots_[i] = entry;
+    }
+}
+
+BidirectionalSearch::BidirectionalSearch() : expandedNodes_(0), peakMemory_(0)
+{
+}
+
+std::vector<short> BidirectionalSearch::Solve(std::span<const int> layout, int posX)
+{
+    const std::vector<int> goalLayout{1, 2, 3, 4, 5, 6, 7, 8, constants::EMPTY};
+    const PackedState start = Pack(layout);
+    const PackedState goal = Pack(goalLayout);
+
+    expandedNodes_ = 0;
+    peakMemory_ = 0;
+    if (start == goal)
+    {
+        return {};
+    }
+
+    fromStart_.Clear();
+    fromGoal_.Clear();
+    fromStart_.Insert(start, rootMove);
+    fromGoal_.Insert(goal, rootMove);
+
+    startFrontier_.assign(1, start | (static_cast<std::uint64_t>(posX) << moveShift));
+    goalFrontier_.assign(1, goal | (static_cast<std::uint64_t>(numOfPieces - 1) << moveShift));
+
+    // Always grow the smaller side, so both stay about the same size
+    PackedState met = 0;
+    while ((met == 0) && !startFrontier_.empty() && !goalFrontier_.empty())
+    {
+        if (startFrontier_.size() <= goalFrontier_.size())
+        {
+            met = ExpandLayer(startFrontier_, fromStart_, fromGoal_);
+        }
+        else
+        {
+            met = ExpandLayer(goalFrontier_, fromGoal_, fromStart_);
+        }
+    }
+
+    // One side ran out of states, so the layout cannot reach the goal
+    if (met == 0)
+    {
+        return {};
+    }
+
+    // The moves from the start are stored forwards, so read them backwards
+    std::vector<short> dirs;
+    std::vector<int> toStart = TraceBack(fromStart_, met);
+    std::reverse(toStart.begin(), toStart.end());
+    for (const int moveIdx : toStart)
+    {
+        dirs.push_back(moves[static_cast<size_t>(moveIdx)].dir);
+    }
+
+    // The moves from the goal lead away from it, so undo each of them
+    for (const int moveIdx : TraceBack(fromGoal_, met))
+    {
+        dirs.push_back(moves[static_cast<size_t>(moveIdx)].opposite);
+    }
+
+    return dirs;
+}
+
+PackedState BidirectionalSearch::ExpandLayer(std::vector<std::uint64_t> &frontier,
+                                             VisitedSet &own, const VisitedSet &other)
+{
+    // Every shorter path was ruled out by the earlier layers, so the first
+    // state that the other side has seen is on an optimal path
+    PackedState met = 0;
+
+    next_.clear();
+    for (const std::uint64_t item : frontier)
+    {
+        const PackedState state = item & stateMask;
+        const int posX = static_cast<int>(item >> moveShift);
+        expandedNodes_++;
+
+        for (size_t idx = 0; (idx < moves.size()) && (met == 0); idx++)
+        {
+            const int target = GetTarget(posX, moves[idx], N);
+            if (target < 0)
+            {
+                continue;
+            }
+
+            const PackedState child = Slide(state, posX, target);
+            if (!own.Insert(child, static_cast<int>(idx)))
+            {
+                continue;
+            }
+
+            if (other.Find(child) != 0)
+            {
+                met = child;
+            }
+
+            next_.push_back(child | (static_cast<std::uint64_t>(target) << moveShift));
+        }
+
+        if (met != 0)
+        {
+            break;
+        }
+    }
+
+    frontier.swap(next_);
+
+    const size_t frontierMemory =
+        (startFrontier_.capacity() + goalFrontier_.capacity() + next_.capacity()) *
+        sizeof(std::uint64_t);
+    peakMemory_ = std::max(peakMemory_,
+                           fromStart_.GetMemory() + fromGoal_.GetMemory() + frontierMemory);
+
+    return met;
+}
+
+std::vector<int> BidirectionalSearch::TraceBack(const VisitedSet &visited,
+                                                PackedState state) const
+{
+    std::vector<int> moveIdxs;
+
+    for (std::uint64_t entry = visited.Find(state);; entry = visited.Find(state))
+    {
+        const int moveIdx = static_cast<int>((entry >> moveShift) & 0xF);
+        if (moveIdx == rootMove)
+        {
+            break;
+        }
+        moveIdxs.push_back(moveIdx);
+
+        // Slide the empty piece back to where it was before the move
+        const Move &move = moves[static_cast<size_t>(moveIdx)];
+        const int posX = GetPosX(state);
+        const int prevPosX = posX - move.dRow * N - move.dCol;
+        state = Slide(state, posX, prevPosX);
+    }
+
+    return moveIdxs;
+}
+} // namespace search
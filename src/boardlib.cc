@@ -1,172 +1,138 @@
-#include <memory>  // std::make_unique
-#include <span>    // std::span
-#include <utility> // std::to_underlying
-#include <vector>  // std::vector
+#include <algorithm> // std::max
+#include <chrono>    // std::chrono::system_clock
+#include <cstdint>   // std::uint16_t, std::uint32_t
+#include <memory>    // std::make_unique
+#include <optional>  // std::optional
+#include <span>      // std::span
+#include <utility>   // std::move, std::to_underlying
+#include <vector>    // std::vector
 
-#include "fmt/core.h"                 // fmt::format
-#include "raylib.h"                   // LoadTexture, Vector2, Rectangle
-#include "slidr/solver/solverlib.hpp" // slidr::Solver
+#include "raylib.h" // Vector2, Rectangle
 
 #include "creator/creatorlib.hpp"
 #include "gui/boardlib.hpp"
 #include "gui/buttonlib.hpp"
 #include "gui/colourlib.hpp"
+#include "gui/hitgridlib.hpp"        // gui::GetCellIndex, gui::noHit
+#include "gui/layoutlib.hpp"
+#include "search/packedstatelib.hpp" // search::GetTarget, search::moves
 
-Board::Board()
-    : screenWidth_(GetScreenWidth()),
-      screenHeight_(GetScreenHeight()),
-      numbers_(LoadTexture("resources/numbers.png")),
-      boardWidth__(gui::boardWidth),
-      boardHeight_(gui::boardHeight),
-      borderThickness_(gui::borderThickness),
-      boxX_((screenWidth_ - boardWidth__) / 2),
-      boxY_((screenHeight_ - boardHeight_) / 2),
-      buttonWidth_(200),
-      buttonHeight_(80),
-      undoBtnX_((screenHeight_ + boardHeight_) / 2 + borderThickness_),
-      undoBtnY_((screenHeight_ - boardHeight_) / 2),
-      restartBtnX_((screenHeight_ + boardHeight_) / 2 + borderThickness_),
-      restartBtnY_(undoBtnY_ + buttonHeight_ + borderThickness_),
-      helpBtnX_((screenHeight_ + boardHeight_) / 2 + borderThickness_),
-      helpBtnY_(restartBtnY_ + buttonHeight_ + borderThickness_),
+namespace
+{
+// The offset of a piece inside its grid
+constexpr float pieceOffsetRatioX = 1.0f / 5;
+constexpr float pieceOffsetRatioY = 1.0f / 8;
+
+// The value of the hinted piece when there is no hint
+constexpr int noHint = -1;
+
+// The goal is 1, 2, ..., 8 followed by the empty piece (0), one nibble per position
+constexpr search::PackedState goalState = 0x087654321;
+
+// Room for the moves of a puzzle before the arena has to grow
+constexpr size_t nodeCapacity = 1024;
+
+// The timing of the slides and the solution playback (in seconds)
+constexpr float slideDuration = 0.15f;
+constexpr float solutionStepInterval = 0.8f;
+constexpr float solutionEndDelay = 1.0f;
+} // namespace
+
+Board::Board(const Atlas &atlas, const gui::Layout &layout,
+             const search::DistanceTable &distanceTable, search::SolutionCache &solutionCache,
+             const creator::PuzzlePack &puzzlePack, creator::PuzzleImporter &puzzleImporter,
+             Xoshiro256 rng, search::Algorithm algorithm, ThreadPool &pool, gui::InputQueue &input)
+    : atlas_(atlas),
+      layout_(layout),
+      input_(input),
+      distanceTable_(distanceTable),
+      solutionCache_(solutionCache),
+      puzzlePack_(puzzlePack),
+      puzzleImporter_(puzzleImporter),
+      packDay_(creator::GetToday()),
+      packOffset_(0),
+      rng_(rng),
       N_(constants::EIGHT_PUZZLE_SIZE),
-      cellWidth_(boardWidth__ / N_),
-      cellHeight_(boardHeight_ / N_),
-      w(numbers_.width / 5.0f),
-      h(numbers_.height / 2.0f),
-      offsetW_(cellWidth_ / 5),
-      offsetH_(cellHeight_ / 8),
+      nodes_(nodeCapacity),
+      current_(search::noNode),
       restartBtnState_(gui::ButtonState::Unselected),
       undoBtnState_(gui::ButtonState::Unselected),
+      redoBtnState_(gui::ButtonState::Unselected),
       helpBtnState_(gui::ButtonState::Unselected),
+      hintBtnState_(gui::ButtonState::Unselected),
+      clickTracker_(),
+      restartBtnAction_(false),
+      undoBtnAction_(false),
+      redoBtnAction_(false),
+      helpBtnAction_(false),
+      hintBtnAction_(false),
+      hintedPiece_(noHint),
+      showHistoryStats_(false),
       isSolved_(false),
       requestedHelp_(false),
-      moves_(INT_MAX)
+      algorithm_(algorithm),
+      moves_(INT_MAX),
+      timeline_(slideDuration),
+      solutionTimer_(0.0f),
+      fxButton_{},
+      backgroundMusic_{}
 {
-    buttonPositions_.resize(std::to_underlying(gui::Button::ButtonN));
+    playTime_ = 0.0f;
 
-    // Calculate the position of each piece of the puzzle
-    for (size_t i = 0; i < constants::EIGHT_PUZZLE_NUM; i++)
+    // Only the selected solver is built, the parallel one alone takes megabytes
+    if (algorithm_ == search::Algorithm::BIDIRECTIONAL_BFS)
     {
-        float posX = boxX_ + ((i % 3) * cellWidth_);
-        float posY = boxY_ + ((i / 3) * cellHeight_);
-        buttonPositions_[i] = Rectangle{posX, posY, cellWidth_, cellHeight_};
+        bidirectionalPtr_ = std::make_unique<search::BidirectionalSearch>();
+    }
+    else if (algorithm_ == search::Algorithm::PARALLEL_IDA_STAR)
+    {
+        parallelPtr_ = std::make_unique<search::ParallelIdaStar>(pool);
     }
 
-    buttonPositions_[std::to_underlying(gui::Button::Undo)] =
-        Rectangle{undoBtnX_, undoBtnY_, buttonWidth_, buttonHeight_};
-    buttonPositions_[std::to_underlying(gui::Button::Restart)] =
-        Rectangle{restartBtnX_, restartBtnY_, buttonWidth_, buttonHeight_};
-    buttonPositions_[std::to_underlying(gui::Button::Help)] =
-        Rectangle{helpBtnX_, helpBtnY_, buttonWidth_, buttonHeight_};
-
-    std::vector<int> initalLayout = creator::GetRandomLayout();
-    std::shared_ptr<Node> startNode = std::make_shared<Node>(initalLayout);
-
-    history_.push(startNode);
-
-    slidr::Solver s{*history_.top()};
-
-    s.SolvePuzzle();
-
-    solutionDir_ = s.GetSolutionDirection();
-
-    itr_ = solutionDir_.cbegin();
-
-    optimalMoves_ = (solutionDir_.size() - 1);
-
-    fxButton_ = LoadSound("resources/buttonfx.wav");
-
-    // Initialize the background music
-    backgroundMusic_ = LoadMusicStream("resources/piano-background.mp3");
-    SetMusicVolume(backgroundMusic_, 0.5f);
-    PlayMusicStream(backgroundMusic_);
+    // The first puzzle is the one of the day, so every kiosk starts with the same one
+    current_ = StartNextPuzzle();
+    timeline_.Reset(nodes_.GetLayout(current_));
 }
 
 Board::~Board()
 {
     // Unload resources to prevent memory leaks
-    UnloadTexture(numbers_);
+    // NOTE: both do nothing if the audio was never loaded
     UnloadSound(fxButton_);
     UnloadMusicStream(backgroundMusic_);
 }
 
-void Board::Update()
+void Board::LoadAudio()
 {
-    const Vector2 mousePos = GetMousePosition();
-    gui::Button btn = CheckWhichButtonIsPressed(mousePos);
+    fxButton_ = LoadSound("resources/buttonfx.wav");
 
-    restartBtnAction_ = false;
-    undoBtnAction_ = false;
-    helpBtnAction_ = false;
+    // Initialize the background music
+    backgroundMusic_ = LoadMusicStream("resources/piano-background.mp3");
+    SetMusicVolume(backgroundMusic_, 0.5f);
+    PlayMusicStream(backgroundMusic_);
+}
 
-    // Check if the restart button is hovered or pressed
-    if (CheckCollisionPointRec(mousePos,
-                               buttonPositions_[std::to_underlying(gui::Button::Restart)]))
-    {
-        if (IsMouseButtonDown(MOUSE_BUTTON_LEFT))
-        {
-            restartBtnState_ = gui::ButtonState::Selected;
-        }
-        else
-        {
-            restartBtnState_ = gui::ButtonState::Hovered;
-        }
+void Board::Update()
+{
+    const float dt = GetFrameTime();
+    timeline_.Update(dt);
+    playTime_ += dt;
 
-        if (IsMouseButtonReleased(MOUSE_BUTTON_LEFT))
-        {
-            restartBtnAction_ = true;
-        }
-    }
-    else
-    {
-        restartBtnState_ = gui::ButtonState::Unselected;
-    }
+    const gui::Button btn = CheckWhichButtonIsPressed(input_.GetMousePos());
 
-    // Check if the undo button is hovered or pressed
-    if (CheckCollisionPointRec(mousePos, buttonPositions_[std::to_underlying(gui::Button::Undo)]))
-    {
-        if (IsMouseButtonDown(MOUSE_BUTTON_LEFT))
-        {
-            undoBtnState_ = gui::ButtonState::Selected;
-        }
-        else if (IsMouseButtonReleased(MOUSE_BUTTON_LEFT))
-        {
-            undoBtnAction_ = true;
-        }
-        else
-        {
-            undoBtnState_ = gui::ButtonState::Hovered;
-        }
-    }
-    else
-    {
-        undoBtnState_ = gui::ButtonState::Unselected;
-    }
+    // A click only counts if it is released over the button it was pressed on
+    const gui::InputEvent *press = input_.Find(gui::InputKind::MOUSE_PRESSED);
+    const gui::Button clicked =
+        clickTracker_.Update(btn, press != nullptr, input_.WasMouseReleased());
 
-    // Check if the help butoon is hovered or pressed
-    if (CheckCollisionPointRec(mousePos, buttonPositions_[std::to_underlying(gui::Button::Help)]))
-    {
-        if (IsMouseButtonDown(MOUSE_BUTTON_LEFT))
-        {
-            helpBtnState_ = gui::ButtonState::Selected;
-        }
-        else if (IsMouseButtonReleased(MOUSE_BUTTON_LEFT))
-        {
-            helpBtnAction_ = true;
-        }
-        else
-        {
-            helpBtnState_ = gui::ButtonState::Hovered;
-        }
-    }
-    else
-    {
-        helpBtnState_ = gui::ButtonState::Unselected;
-    }
+    restartBtnAction_ = UpdateButton(gui::Button::Restart, btn, clicked, restartBtnState_);
+    undoBtnAction_ = UpdateButton(gui::Button::Undo, btn, clicked, undoBtnState_);
+    redoBtnAction_ = UpdateButton(gui::Button::Redo, btn, clicked, redoBtnState_);
+    helpBtnAction_ = UpdateButton(gui::Button::Help, btn, clicked, helpBtnState_);
+    hintBtnAction_ = UpdateButton(gui::Button::Hint, btn, clicked, hintBtnState_);
 
-    // Check if the button is clicked
-    if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT))
+    // The pieces slide as soon as they are pressed
+    if (press)
     {
         switch (btn)
         {
@@ -180,41 +146,38 @@ void Board::Update()
         case gui::Button::EighthPiece:
         case gui::Button::NinthPiece:
         {
-            const std::shared_ptr<Node> top = history_.top();
-
             // Get the position of the empty piece
-            int posX = top->GetPosX();
-            int xRow = posX / constants::EIGHT_PUZZLE_SIZE;
-            int xCol = posX % constants::EIGHT_PUZZLE_SIZE;
+            int posX = nodes_[current_].posX;
+            int xRow = posX / N_;
+            int xCol = posX % N_;
 
             // Get the position of the piece that is clicked
-            int btnRow = std::to_underlying(btn) / constants::EIGHT_PUZZLE_SIZE;
-            int btnCol = std::to_underlying(btn) % constants::EIGHT_PUZZLE_SIZE;
+            int btnRow = std::to_underlying(btn) / N_;
+            int btnCol = std::to_underlying(btn) % N_;
 
             // Check if the condition for moving to the direction is satisfied
+            bool moved = false;
             if (((xCol + 1) == btnCol) && (xRow == btnRow))
             {
-                auto [childLayout, childPosX] = top->GetNextLayout(constants::RIGHT);
-                history_.push(std::make_shared<Node>(childLayout, childPosX, top->GetDepth() + 1,
-                                                     top, constants::RIGHT));
+                moved = MakeMove(constants::RIGHT);
             }
             else if (((xCol - 1) == btnCol) && (xRow == btnRow))
             {
-                auto [childLayout, childPosX] = top->GetNextLayout(constants::LEFT);
-                history_.push(std::make_shared<Node>(childLayout, childPosX, top->GetDepth() + 1,
-                                                     top, constants::LEFT));
+                moved = MakeMove(constants::LEFT);
             }
             else if (((xRow + 1) == btnRow) && (xCol == btnCol))
             {
-                auto [childLayout, childPosX] = top->GetNextLayout(constants::DOWN);
-                history_.push(std::make_shared<Node>(childLayout, childPosX, top->GetDepth() + 1,
-                                                     top, constants::DOWN));
+                moved = MakeMove(constants::DOWN);
             }
             else if (((xRow - 1) == btnRow) && (xCol == btnCol))
             {
-                auto [childLayout, childPosX] = top->GetNextLayout(constants::UP);
-                history_.push(std::make_shared<Node>(childLayout, childPosX, top->GetDepth() + 1,
-                                                     top, constants::UP));
+                moved = MakeMove(constants::UP);
+            }
+
+            // The slide starts in this frame, so its latency ends when the frame is presented
+            if (moved)
+            {
+                input_.TrackLatency(*press);
             }
             break;
         }
@@ -225,14 +188,44 @@ void Board::Update()
         }
     }
 
-    // Check if the restart button needs to take action
-    if (restartBtnAction_)
+    // Ctrl+Z and Ctrl+Y (or Ctrl+Shift+Z) step through the moves, Home and End jump to the
+    // start and to the end of the moves that the redo button would replay
+    const gui::InputEvent *keyZ = input_.FindKey(KEY_Z);
+    const gui::InputEvent *keyY = input_.FindKey(KEY_Y);
+    if ((keyY && (keyY->modifiers & gui::MODIFIER_CTRL)) ||
+        (keyZ && (keyZ->modifiers & gui::MODIFIER_CTRL) && (keyZ->modifiers & gui::MODIFIER_SHIFT)))
     {
-        // Pop the stack until there is only one element in the stack
-        while (history_.size() > 1)
+        Redo();
+    }
+    else if (keyZ && (keyZ->modifiers & gui::MODIFIER_CTRL))
+    {
+        Undo();
+    }
+    else if (input_.WasKeyPressed(KEY_HOME))
+    {
+        JumpTo(0);
+    }
+    else if (input_.WasKeyPressed(KEY_END))
+    {
+        search::NodeIndex last = current_;
+        while (nodes_.GetRedo(last) != search::noNode)
         {
-            history_.pop();
+            last = nodes_.GetRedo(last);
         }
+        JumpTo(last);
+    }
+
+    // F3 shows how much memory the moves take
+    if (input_.WasKeyPressed(KEY_F3))
+    {
+        showHistoryStats_ = !showHistoryStats_;
+    }
+
+    // Check if the restart button needs to take action
+    if (restartBtnAction_)
+    {
+        // Go back to the start, the start node is always the first one
+        JumpTo(0);
 
         PlaySound(fxButton_);
     }
@@ -240,12 +233,15 @@ void Board::Update()
     // Check if the undo button needs to take action
     if (undoBtnAction_)
     {
-        // Pop the stack (history) iff there are more than one element in the
-        // stack
-        if (history_.size() > 1)
-        {
-            history_.pop();
-        }
+        Undo();
+
+        PlaySound(fxButton_);
+    }
+
+    // Check if the redo button needs to take action
+    if (redoBtnAction_)
+    {
+        Redo();
 
         PlaySound(fxButton_);
     }
@@ -254,23 +250,34 @@ void Board::Update()
     if (helpBtnAction_)
     {
         requestedHelp_ = true;
+        hintedPiece_ = noHint;
 
-        // Clear the history since the solution will take over
-        while (history_.size() > 1)
-        {
-            history_.pop();
-        }
+        // The stats only count the moves that the user makes
+        moves_ = nodes_[current_].depth;
+
+        // Carry on from where the player is
+        solutionDir_ = FindSolution(current_);
+        itr_ = solutionDir_.cbegin();
+        solutionTimer_ = 0.0f;
+
+        PlaySound(fxButton_);
+    }
+
+    // Check if the hint button needs to take action
+    if (hintBtnAction_)
+    {
+        ShowHint();
 
         PlaySound(fxButton_);
     }
 
-    // Check if the puzzle is completed
-    if (history_.top()->IsSolved())
+    // Check if the puzzle is completed (once the last piece has landed)
+    if ((nodes_[current_].state == goalState) && !timeline_.IsAnimating())
     {
         isSolved_ = true;
 
         // Update the stats
-        moves_ = (history_.size() - 1);
+        moves_ = nodes_[current_].depth;
     }
 
     // Update the background music
@@ -281,120 +288,95 @@ void Board::Draw() const
 {
     DrawBoard();
 
-    // Draw text on the buttons
-    Rectangle undoBox{undoBtnX_, undoBtnY_, buttonWidth_, buttonHeight_};
-    if (undoBtnState_ == gui::ButtonState::Selected)
-    {
-        DrawRectangle(undoBox.x, undoBox.y, undoBox.width, undoBox.height, TANGERINE);
-        DrawText(TextFormat("Undo"), undoBtnX_ + 15, undoBtnY_ + 15, 40, WHITE);
-    }
-    else if (undoBtnState_ == gui::ButtonState::Hovered)
-    {
-        DrawRectangle(undoBox.x, undoBox.y, undoBox.width, undoBox.height, TIGER);
-        DrawText(TextFormat("Undo"), undoBtnX_ + 15, undoBtnY_ + 15, 40, WHITE);
-    }
-    else
-    {
-        DrawRectangle(undoBox.x, undoBox.y, undoBox.width, undoBox.height, APRICOT);
-        DrawText(TextFormat("Undo"), undoBtnX_ + 15, undoBtnY_ + 15, 40, WHITE);
-    }
-
-    Rectangle restartBox{restartBtnX_, restartBtnY_, buttonWidth_, buttonHeight_};
-    if (restartBtnState_ == gui::ButtonState::Selected)
-    {
-        DrawRectangle(restartBox.x, restartBox.y, restartBox.width, restartBox.height, CRIMSON);
-        DrawText(TextFormat("Restart"), restartBtnX_ + 15, restartBtnY_ + 15, 40, WHITE);
-    }
-    else if (restartBtnState_ == gui::ButtonState::Hovered)
-    {
-        DrawRectangle(restartBox.x, restartBox.y, restartBox.width, restartBox.height, FIREBRICK);
-        DrawText(TextFormat("Restart"), restartBtnX_ + 15, restartBtnY_ + 15, 40, WHITE);
-    }
-    else
-    {
-        DrawRectangle(restartBox.x, restartBox.y, restartBox.width, restartBox.height, MAROON);
-        DrawText(TextFormat("Restart"), restartBtnX_ + 15, restartBtnY_ + 15, 40, WHITE);
-    }
-
-    Rectangle helpBox{helpBtnX_, helpBtnY_, buttonWidth_, buttonHeight_};
-    if (helpBtnState_ == gui::ButtonState::Selected)
-    {
-        DrawRectangle(helpBox.x, helpBox.y, helpBox.width, helpBox.height, DEEP_SKY_BLUE);
-        DrawText(TextFormat("Help"), helpBtnX_ + 15, helpBtnY_ + 15, 40, WHITE);
-    }
-    else if (helpBtnState_ == gui::ButtonState::Hovered)
-    {
-        DrawRectangle(helpBox.x, helpBox.y, helpBox.width, helpBox.height, STEEL_BLUE);
-        DrawText(TextFormat("Help"), helpBtnX_ + 15, helpBtnY_ + 15, 40, WHITE);
-    }
-    else
-    {
-        DrawRectangle(helpBox.x, helpBox.y, helpBox.width, helpBox.height, CAROLINE_BLUE);
-        DrawText(TextFormat("Help"), helpBtnX_ + 15, helpBtnY_ + 15, 40, WHITE);
-    }
+    // Draw the buttons and the text on them
+    const gui::BoardLayout &l = layout_.board;
+    DrawRectangleRec(l.undoBtn, (undoBtnState_ == gui::ButtonState::Selected)  ? TANGERINE
+                                : (undoBtnState_ == gui::ButtonState::Hovered) ? TIGER
+                                                                               : APRICOT);
+    atlas_.Draw(gui::Sprite::UndoTxt,
+                {l.undoBtn.x + l.btnTxtPadding, l.undoBtn.y + l.btnTxtPadding}, WHITE);
+
+    DrawRectangleRec(l.redoBtn, (redoBtnState_ == gui::ButtonState::Selected)  ? TANGERINE
+                                : (redoBtnState_ == gui::ButtonState::Hovered) ? TIGER
+                                                                               : APRICOT);
+    atlas_.Draw(gui::Sprite::RedoTxt,
+                {l.redoBtn.x + l.btnTxtPadding, l.redoBtn.y + l.btnTxtPadding}, WHITE);
+
+    DrawRectangleRec(l.restartBtn, (restartBtnState_ == gui::ButtonState::Selected)  ? CRIMSON
+                                   : (restartBtnState_ == gui::ButtonState::Hovered) ? FIREBRICK
+                                                                                     : MAROON);
+    atlas_.Draw(gui::Sprite::RestartTxt,
+                {l.restartBtn.x + l.btnTxtPadding, l.restartBtn.y + l.btnTxtPadding}, WHITE);
+
+    DrawRectangleRec(l.helpBtn, (helpBtnState_ == gui::ButtonState::Selected)  ? DEEP_SKY_BLUE
+                                : (helpBtnState_ == gui::ButtonState::Hovered) ? STEEL_BLUE
+                                                                               : CAROLINE_BLUE);
+    atlas_.Draw(gui::Sprite::HelpTxt,
+                {l.helpBtn.x + l.btnTxtPadding, l.helpBtn.y + l.btnTxtPadding}, WHITE);
+
+    DrawRectangleRec(l.hintBtn, (hintBtnState_ == gui::ButtonState::Selected)  ? TEAL
+                                : (hintBtnState_ == gui::ButtonState::Hovered) ? JADE_GREEN
+                                                                               : DARK_GREEN);
+    atlas_.Draw(gui::Sprite::HintTxt,
+                {l.hintBtn.x + l.btnTxtPadding, l.hintBtn.y + l.btnTxtPadding}, WHITE);
 
     // Draw the number of steps (depth) on the top
-    const int depth = history_.top()->GetDepth();
-    if (depth < 100)
-    {
-        DrawText(TextFormat("Moves: %02i", depth), (screenWidth_ - boardWidth__) / 2,
-                 (screenHeight_ - boardHeight_) / 2 - 40, 40, BLUE);
-    }
-    else
+    DrawMoves();
+
+    if (showHistoryStats_)
     {
-        DrawText(TextFormat("Moves: %03i", depth), (screenWidth_ - boardWidth__) / 2,
-                 (screenHeight_ - boardHeight_) / 2 - 40, 40, BLUE);
+        DrawHistoryStats();
     }
 }
 
 void Board::DrawResult() const
 {
-    // Calculate the positions
-    const float rectX = (screenWidth_ - gui::counterWidth) / 2;
-    const float optimalMovesRectY = screenHeight_ / 2 - gui::counterHeight - 10;
-    const float userMovesRectY = screenHeight_ / 2 + 10;
-
-    // Construct the text
-    std::string optimalMovesText = fmt::format("Optimal Moves: {}", optimalMoves_);
-    std::string userMovesText = fmt::format("User Moves: {}", moves_);
+    const Rectangle &optimalMovesRect = layout_.board.optimalMovesCounter;
+    const Rectangle &userMovesRect = layout_.board.userMovesCounter;
 
     // Calculate the width of the text
-    int textWidth = std::max(MeasureText(optimalMovesText.c_str(), gui::moveCounterFontSize),
-                             MeasureText(userMovesText.c_str(), gui::moveCounterFontSize));
-
-    // Construct and draw the rectangles
-    Rectangle optimalMovesRect = {rectX, optimalMovesRectY, gui::counterWidth, gui::counterHeight};
-    Rectangle userMovesRect = {rectX, userMovesRectY, gui::counterWidth, gui::counterHeight};
+    const float optimalMovesTxtWidth =
+        atlas_.GetSize(gui::Sprite::OptimalMovesTxt).x +
+        atlas_.MeasureNumber(optimalMoves_, 1, gui::DigitSize::Small);
+    const float userMovesTxtWidth = atlas_.GetSize(gui::Sprite::UserMovesTxt).x +
+                                    atlas_.MeasureNumber(moves_, 1, gui::DigitSize::Small);
+    const float textWidth = std::max(optimalMovesTxtWidth, userMovesTxtWidth);
+    const float textHeight = atlas_.GetSize(gui::Sprite::UserMovesTxt).y;
+
+    // Draw the rectangles
     DrawRectangleRounded(optimalMovesRect, gui::cornerRadius, gui::segments, LIGHTGRAY);
     DrawRectangleRounded(userMovesRect, gui::cornerRadius, gui::segments, LIGHTGRAY);
 
     // Draw the text
-    DrawText(optimalMovesText.c_str(), rectX + (gui::counterWidth - textWidth) / 2,
-             optimalMovesRectY + (gui::counterHeight - gui::moveCounterFontSize) / 2,
-             gui::moveCounterFontSize, DARKBLUE);
-    DrawText(userMovesText.c_str(), rectX + (gui::counterWidth - textWidth) / 2,
-             userMovesRectY + (gui::counterHeight - gui::moveCounterFontSize) / 2,
-             gui::moveCounterFontSize, MAROON);
+    Vector2 pos = {optimalMovesRect.x + (optimalMovesRect.width - textWidth) / 2,
+                   optimalMovesRect.y + (optimalMovesRect.height - textHeight) / 2};
+    atlas_.Draw(gui::Sprite::OptimalMovesTxt, pos, DARKBLUE);
+    pos.x += atlas_.GetSize(gui::Sprite::OptimalMovesTxt).x;
+    atlas_.DrawNumber(optimalMoves_, 1, gui::DigitSize::Small, pos, DARKBLUE);
+
+    pos = {userMovesRect.x + (userMovesRect.width - textWidth) / 2,
+           userMovesRect.y + (userMovesRect.height - textHeight) / 2};
+    atlas_.Draw(gui::Sprite::UserMovesTxt, pos, MAROON);
+    pos.x += atlas_.GetSize(gui::Sprite::UserMovesTxt).x;
+    atlas_.DrawNumber(moves_, 1, gui::DigitSize::Small, pos, MAROON);
 }
 
 void Board::UpdateSolution()
 {
-    static double prevTime = GetTime();
-    double curTime = GetTime();
-    if (((curTime - prevTime) > 0.8) && (itr_ != solutionDir_.cend()))
-    {
-        const std::shared_ptr<Node> top = history_.top();
+    const float dt = GetFrameTime();
+    timeline_.Update(dt);
+    solutionTimer_ += dt;
 
-        auto [childLayout, childPosX] = top->GetNextLayout(*itr_);
-        history_.push(
-            std::make_shared<Node>(childLayout, childPosX, top->GetDepth() + 1, top, *itr_));
+    if ((solutionTimer_ > solutionStepInterval) && (itr_ != solutionDir_.cend()))
+    {
+        MakeMove(*itr_);
 
-        prevTime = curTime;
+        solutionTimer_ = 0.0f;
 
         ++itr_;
     }
 
-    if (((curTime - prevTime) > 1.0) && (itr_ == solutionDir_.cend()))
+    if ((solutionTimer_ > solutionEndDelay) && (itr_ == solutionDir_.cend()))
     {
         isSolved_ = true;
     }
@@ -405,33 +387,26 @@ void Board::DrawSolution() const
     DrawBoard();
 
     // Draw text on the top
-    // NOTE: the number of moves is always 2 digits only
-    DrawText(TextFormat("Moves: %02i", history_.top()->GetDepth()),
-             (screenWidth_ - boardWidth__) / 2, (screenHeight_ - boardHeight_) / 2 - 40, 40, BLUE);
+    DrawMoves();
 }
 
 void Board::Reset()
 {
     restartBtnState_ = gui::ButtonState::Unselected;
     undoBtnState_ = gui::ButtonState::Unselected;
+    redoBtnState_ = gui::ButtonState::Unselected;
     helpBtnState_ = gui::ButtonState::Unselected;
+    hintBtnState_ = gui::ButtonState::Unselected;
+    hintedPiece_ = noHint;
     isSolved_ = false;
     requestedHelp_ = false;
     moves_ = INT_MAX;
-    itr_ = solutionDir_.cbegin();
-
-    std::vector<int> initalLayout = creator::GetRandomLayout();
-    std::shared_ptr<Node> startNode = std::make_shared<Node>(initalLayout);
-
-    std::stack<std::shared_ptr<Node>> newHistory;
-    newHistory.push(startNode);
-    std::swap(history_, newHistory);
-
-    slidr::Solver s{*history_.top()};
 
-    s.SolvePuzzle();
+    playTime_ = 0.0f;
 
-    optimalMoves_ = (s.GetSolutionDirection().size() - 1);
+    // The nodes of the last puzzle go all at once
+    current_ = StartNextPuzzle();
+    timeline_.Reset(nodes_.GetLayout(current_));
 }
 
 void Board::Restart()
@@ -439,17 +414,34 @@ void Board::Restart()
     // Reset all members
     restartBtnState_ = gui::ButtonState::Unselected;
     undoBtnState_ = gui::ButtonState::Unselected;
+    redoBtnState_ = gui::ButtonState::Unselected;
     helpBtnState_ = gui::ButtonState::Unselected;
+    hintBtnState_ = gui::ButtonState::Unselected;
+    hintedPiece_ = noHint;
     isSolved_ = false;
     requestedHelp_ = false;
     moves_ = INT_MAX;
+    playTime_ = 0.0f;
     itr_ = solutionDir_.cbegin();
 
-    // Pop the stack until there is only one left
-    while (history_.size() > 1)
-    {
-        history_.pop();
-    }
+    // Go back to the start, the start node is always the first one
+    current_ = 0;
+    timeline_.Reset(nodes_.GetLayout(current_));
+}
+
+stats::GameRecord Board::GetRecord() const
+{
+    const auto now = std::chrono::system_clock::now().time_since_epoch();
+
+    stats::GameRecord record{};
+    record.startState = startState_;
+    record.finishedAt = std::chrono::duration_cast<std::chrono::seconds>(now).count();
+    record.durationMs = static_cast<std::uint32_t>(playTime_ * 1000.0f);
+    record.optimalMoves = static_cast<std::uint16_t>(optimalMoves_);
+    record.userMoves = static_cast<std::uint16_t>(moves_);
+    record.usedHelp = requestedHelp_ ? 1 : 0;
+
+    return record;
 }
 
 void Board::EnableBackgroundMusic() const
@@ -462,16 +454,215 @@ void Board::DisableBackgroundMusic() const
     SetMusicVolume(backgroundMusic_, 0.0f);
 }
 
-gui::Button Board::CheckWhichButtonIsPressed(const Vector2 &mousePos)
+std::vector<short> Board::FindSolution(search::NodeIndex index)
+{
+    const search::ArenaNode &node = nodes_[index];
+    const search::Layout layout = nodes_.GetLayout(index);
+    const search::PackedState key = node.state;
+    const bool isStart = (node.depth == 0);
+
+    if (std::optional<search::Solution> cached = solutionCache_.Find(key))
+    {
+        // Keep the solver on the same puzzle so a later SolveFrom() stays correct
+        if (isStart)
+        {
+            solver_.Adopt(layout, node.posX, cached->dirs);
+        }
+
+        return std::move(cached->dirs);
+    }
+
+    // The selected solver serves both the new puzzles and the help
+    std::vector<short> dirs;
+    if (algorithm_ == search::Algorithm::BIDIRECTIONAL_BFS)
+    {
+        dirs = bidirectionalPtr_->Solve(layout, node.posX);
+        TraceLog(LOG_DEBUG, "SOLVER: Bidirectional search expanded %llu nodes in %zu bytes",
+                 static_cast<unsigned long long>(bidirectionalPtr_->GetExpandedNodes()),
+                 bidirectionalPtr_->GetPeakMemory());
+    }
+    else if (algorithm_ == search::Algorithm::PARALLEL_IDA_STAR)
+    {
+        dirs = parallelPtr_->Solve(layout, node.posX);
+        TraceLog(LOG_DEBUG, "SOLVER: Parallel IDA* expanded %llu nodes",
+                 static_cast<unsigned long long>(parallelPtr_->GetExpandedNodes()));
+
+        // The split of the work shows how well the workers kept each other busy
+        const std::span<const std::uint64_t> perWorker =
+            parallelPtr_->GetExpandedNodesPerWorker();
+        for (size_t worker = 0; worker < perWorker.size(); worker++)
+        {
+            TraceLog(LOG_DEBUG, "SOLVER:     worker %zu expanded %llu nodes", worker,
+                     static_cast<unsigned long long>(perWorker[worker]));
+        }
+    }
+    else
+    {
+        // The solver reuses what it learned from the start, so solving from a
+        // later node is much cheaper than a cold solve
+        dirs = isStart ? solver_.Solve(layout, node.posX)
+                       : solver_.SolveFrom(layout, node.posX, node.depth);
+        const search::TableCounters table = solver_.GetTableCounters();
+        TraceLog(LOG_DEBUG, "SOLVER: IDA* expanded %llu nodes (table: %llu hits, %llu misses, "
+                            "%llu collisions)",
+                 static_cast<unsigned long long>(solver_.GetExpandedNodes()),
+                 static_cast<unsigned long long>(table.hits),
+                 static_cast<unsigned long long>(table.misses),
+                 static_cast<unsigned long long>(table.collisions));
+    }
+    solutionCache_.Insert(key, dirs);
+
+    return dirs;
+}
+
+search::NodeIndex Board::StartNextPuzzle()
+{
+    TraceLog(LOG_DEBUG, "HISTORY: %zu nodes in %zu bytes", nodes_.GetSize(),
+             nodes_.GetMemoryFootprint());
+    nodes_.Reset();
+
+    // An imported puzzle is only taken once its background solve is done
+    std::optional<creator::Puzzle> puzzle = puzzleImporter_.TryPop();
+    if (!puzzle && puzzlePack_.IsLoaded())
+    {
+        // The first game of a day is its daily puzzle, the practice ones follow it in the pack
+        const std::int64_t today = creator::GetToday();
+        if (today != packDay_)
+        {
+            packDay_ = today;
+            packOffset_ = 0;
+        }
+        puzzle = puzzlePack_.Get(puzzlePack_.GetDailyIndex(packDay_) + packOffset_++);
+    }
+
+    search::NodeIndex startNode;
+    if (puzzle)
+    {
+        // The optimal solution is already known, so nothing is solved here
+        startNode = nodes_.AddRoot(puzzle->layout);
+        solver_.Adopt(puzzle->layout, nodes_[startNode].posX, puzzle->dirs);
+        solutionDir_ = std::move(puzzle->dirs);
+    }
+    else
+    {
+        startNode = nodes_.AddRoot(creator::GetRandomLayout(rng_));
+        solutionDir_ = FindSolution(startNode);
+    }
+
+    startState_ = nodes_[startNode].state;
+    itr_ = solutionDir_.cbegin();
+    optimalMoves_ = static_cast<unsigned>(solutionDir_.size());
+
+    return startNode;
+}
+
+bool Board::MakeMove(short dir)
+{
+    const int prevPosX = nodes_[current_].posX;
+    const search::NodeIndex child = nodes_.AddChild(current_, dir);
+    if (child == search::noNode)
+    {
+        return false;
+    }
+
+    current_ = child;
+
+    // The piece slides into the old empty grid
+    timeline_.Push(nodes_[current_].posX, prevPosX);
+
+    // The hint is stale once the piece moves
+    hintedPiece_ = noHint;
+
+    return true;
+}
+
+bool Board::UpdateButton(gui::Button button, gui::Button hovered, gui::Button clicked,
+                         gui::ButtonState &state) const
+{
+    if (hovered != button)
+    {
+        state = gui::ButtonState::Unselected;
+        return false;
+    }
+
+    state = input_.IsMouseDown() ? gui::ButtonState::Selected : gui::ButtonState::Hovered;
+
+    return clicked == button;
+}
+
+void Board::Undo()
+{
+    hintedPiece_ = noHint;
+
+    // Step back to the parent iff the current node is not the start, the node stays the first
+    // child of its parent so redo comes back to it
+    if (const search::NodeIndex parent = nodes_[current_].parent; parent != search::noNode)
+    {
+        const int prevPosX = nodes_[current_].posX;
+        current_ = parent;
+
+        // The piece slides back into the grid that is empty again
+        timeline_.Push(nodes_[current_].posX, prevPosX);
+    }
+}
+
+void Board::Redo()
 {
-    // Loop through all pieces on the board
-    for (size_t i = 0; i <= std::to_underlying(gui::Button::NinthPiece); i++)
+    hintedPiece_ = noHint;
+
+    if (const search::NodeIndex child = nodes_.GetRedo(current_); child != search::noNode)
     {
-        if (CheckCollisionPointRec(mousePos, buttonPositions_[i]))
+        const int prevPosX = nodes_[current_].posX;
+        current_ = child;
+
+        timeline_.Push(nodes_[current_].posX, prevPosX);
+    }
+}
+
+void Board::JumpTo(search::NodeIndex index)
+{
+    hintedPiece_ = noHint;
+
+    // Every node holds its whole state, so a jump of any distance costs the same
+    current_ = index;
+    timeline_.Reset(nodes_.GetLayout(current_));
+}
+
+void Board::ShowHint()
+{
+    const search::ArenaNode &node = nodes_[current_];
+
+    // The lookup is a handful of table reads, so it is cheap enough to do on every click
+    const short dir = distanceTable_.GetNextMove(nodes_.GetLayout(current_), node.posX);
+    if (dir == search::noMove)
+    {
+        hintedPiece_ = noHint;
+        return;
+    }
+
+    // The empty piece swaps with the piece to slide, so that is where it ends up
+    for (const search::Move &move : search::moves)
+    {
+        if (move.dir == dir)
         {
-            return (gui::Button)i;
+            hintedPiece_ = search::GetTarget(node.posX, move, N_);
         }
     }
+}
+
+gui::Button Board::CheckWhichButtonIsPressed(const Vector2 &mousePos)
+{
+    // The pieces form a uniform grid so the piece is found by a division
+    if (const int idx = gui::GetCellIndex(layout_.board.box, N_, N_, mousePos); idx != gui::noHit)
+    {
+        return static_cast<gui::Button>(idx);
+    }
+
+    // The other buttons are looked up in the spatial grid
+    if (const int id = layout_.board.hitGrid.Query(mousePos); id != gui::noHit)
+    {
+        return static_cast<gui::Button>(id);
+    }
 
     // Not button is pressed
     return gui::Button::Invalid;
@@ -479,46 +670,90 @@ gui::Button Board::CheckWhichButtonIsPressed(const Vector2 &mousePos)
 
 void Board::DrawBoard() const
 {
+    // Highlight the hinted piece underneath the lines
+    if (hintedPiece_ != noHint)
+    {
+        DrawRectangleRec(layout_.board.cells[static_cast<size_t>(hintedPiece_)], LEMON);
+    }
+
     // Draw the board
-    Rectangle box{boxX_, boxY_, (float)boardWidth__, (float)boardHeight_};
-    DrawRectangleLinesEx(box, borderThickness_, DARKBLUE);
+    const Rectangle &box = layout_.board.box;
+    const float thickness = layout_.board.borderThickness;
+    DrawRectangleLinesEx(box, thickness, DARKBLUE);
 
     // Draw the lines
+    const float cellWidth = box.width / static_cast<float>(N_);
+    const float cellHeight = box.height / static_cast<float>(N_);
     for (int i = 1; i < N_; i++)
     {
         // Draw horizontal lines
-        float y = boxY_ + (i * cellHeight_);
-        Vector2 startPos = {boxX_, y};
-        Vector2 endPos = {boxX_ + boardWidth__, y};
-        DrawLineEx(startPos, endPos, borderThickness_, DARKBLUE);
+        float y = box.y + (static_cast<float>(i) * cellHeight);
+        Vector2 startPos = {box.x, y};
+        Vector2 endPos = {box.x + box.width, y};
+        DrawLineEx(startPos, endPos, thickness, DARKBLUE);
 
         // Draw vertical lines
-        float x = boxX_ + (i * cellWidth_);
-        startPos = {x, boxY_};
-        endPos = {x, boxY_ + boardHeight_};
-        DrawLineEx(startPos, endPos, borderThickness_, DARKBLUE);
+        float x = box.x + (static_cast<float>(i) * cellWidth);
+        startPos = {x, box.y};
+        endPos = {x, box.y + box.height};
+        DrawLineEx(startPos, endPos, thickness, DARKBLUE);
     }
 
-    // Loop through all the elements in the node and draw all the pieces
-    std::span<const int> curState = history_.top()->GetState();
+    // Loop through all the elements in the shown layout and draw all the pieces
+    std::span<const int> curState = timeline_.GetLayout();
+    const int movingFrom = timeline_.GetMovingFrom();
+    const int movingTo = timeline_.GetMovingTo();
+    const float progress = timeline_.GetProgress();
     for (size_t i = 0; i < curState.size(); i++)
     {
         // Only draw the number if the current piece is non-empty
         if (int num = curState[i]; num != constants::EMPTY)
         {
-            // Calculate the position of the number located on the texture
-            // (sprite sheet technique)
-            int recX = (num - 1) % 5;
-            int recY = (num - 1) / 5;
-            Rectangle sourceRec = {recX * w, recY * h, w, h};
-
             // Calculate the position of the texture
-            float posX = boxX_ + ((i % 3) * cellWidth_) + offsetW_;
-            float posY = boxY_ + ((i / 3) * cellHeight_) + offsetH_;
-            Vector2 position = {posX, posY};
+            const Rectangle &cell = layout_.board.cells[i];
+            Vector2 position = {cell.x + cell.width * pieceOffsetRatioX,
+                                cell.y + cell.height * pieceOffsetRatioY};
+
+            // The moving piece is drawn between its old and its new grid
+            if (static_cast<int>(i) == movingTo)
+            {
+                const Rectangle &fromCell = layout_.board.cells[static_cast<size_t>(movingFrom)];
+                position.x -= (cell.x - fromCell.x) * (1.0f - progress);
+                position.y -= (cell.y - fromCell.y) * (1.0f - progress);
+            }
 
-            // Draw a fraction of the texture
-            DrawTextureRec(numbers_, sourceRec, position, WHITE);
+            // Draw the piece from the atlas
+            atlas_.Draw(gui::GetPieceSprite(num), position, WHITE);
         }
     }
 }
+
+void Board::DrawHistoryStats() const
+{
+    const Rectangle &box = layout_.board.box;
+    const unsigned numOfNodes = static_cast<unsigned>(nodes_.GetSize());
+    const unsigned kib = static_cast<unsigned>(nodes_.GetMemoryFootprint() / 1024);
+
+    // Drawn from the atlas like the other counters, so the debug view costs no extra draw call
+    Vector2 pos = {box.x, box.y + box.height + atlas_.GetSize(gui::Sprite::HistoryTxt).y / 2};
+    atlas_.Draw(gui::Sprite::HistoryTxt, pos, GRAY);
+    pos.x += atlas_.GetSize(gui::Sprite::HistoryTxt).x;
+    atlas_.DrawNumber(numOfNodes, 1, gui::DigitSize::Small, pos, GRAY);
+    pos.x += atlas_.MeasureNumber(numOfNodes, 1, gui::DigitSize::Small);
+    atlas_.Draw(gui::Sprite::HistoryNodesTxt, pos, GRAY);
+    pos.x += atlas_.GetSize(gui::Sprite::HistoryNodesTxt).x;
+    atlas_.DrawNumber(kib, 1, gui::DigitSize::Small, pos, GRAY);
+    pos.x += atlas_.MeasureNumber(kib, 1, gui::DigitSize::Small);
+    atlas_.Draw(gui::Sprite::HistoryKibTxt, pos, GRAY);
+}
+
+void Board::DrawMoves() const
+{
+    // Pad the number of moves to 2 digits, or 3 digits once it reaches 100
+    const unsigned depth = nodes_[current_].depth;
+    Vector2 pos = layout_.board.movesTxt;
+
+    atlas_.Draw(gui::Sprite::MovesTxt, pos, BLUE);
+    pos.x += atlas_.GetSize(gui::Sprite::MovesTxt).x;
+    atlas_.DrawNumber(depth, (depth < 100) ? 2 : 3, gui::DigitSize::Large, pos, BLUE);
+}
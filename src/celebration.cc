@@ -3,8 +3,6 @@
 #include <algorithm> // std::generate
 #include <array>     // std::array
 
-#include "slidr/math/mathlib.hpp" // GetNormalFloatDist, GetUniformIntDist, GetUniformFloatDist
-
 namespace
 {
 constexpr float GRAVITY = 200.0;
@@ -12,7 +10,7 @@ constexpr std::array<Color, 6> CONFETTI_COLOURS{LIGHT_CORAL, APRICOT,  LEMON,
                                                 MINT,        SKY_BLUE, LAVENDER};
 } // namespace
 
-Celebration::Celebration()
+Celebration::Celebration(Xoshiro256 rng) : rng_(rng)
 {
     // Generate confetti
     std::generate(confetti_.begin(), confetti_.end(), [this]() { return GenerateConfetti(); });
@@ -92,14 +90,13 @@ Celebration::Confetti Celebration::GenerateConfetti()
 {
     // Use designated initializer
     const float quarterScreen = 0.2 * GetScreenWidth();
-    return Confetti{.position = {GetUniformFloatDist(0, GetScreenWidth()),
-                                 GetUniformFloatDist(-quarterScreen, quarterScreen)},
-                    .velocity = {GetNormalFloatDist(10, 50), GetNormalFloatDist(10, 50)},
-                    .size = GetUniformFloatDist(5, 12),
-                    GetUniformFloatDist(8, 20),
-                    .orientation = GetUniformFloatDist(0, 360),
-                    .omega = GetNormalFloatDist(10, 50),
-                    .colour = CONFETTI_COLOURS[GetUniformIntDist(0, CONFETTI_COLOURS.size() - 1)],
+    return Confetti{.position = {rng_.NextFloat(0, GetScreenWidth()),
+                                 rng_.NextFloat(-quarterScreen, quarterScreen)},
+                    .velocity = {rng_.NextNormal(10, 50), rng_.NextNormal(10, 50)},
+                    .size = {rng_.NextFloat(5, 12), rng_.NextFloat(8, 20)},
+                    .orientation = rng_.NextFloat(0, 360),
+                    .omega = rng_.NextNormal(10, 50),
+                    .colour = CONFETTI_COLOURS[rng_.NextInt(0, CONFETTI_COLOURS.size() - 1)],
                     .active = true};
 }
 
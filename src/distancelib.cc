@@ -0,0 +1,170 @@
+#include <array>   // std::array
+#include <cstdint> // std::uint8_t, std::uint32_t, std::uint64_t
+#include <span>    // std::span
+#include <utility> // std::pair, std::swap
+#include <vector>  // std::vector
+
+#include "slidr/constants/constantslib.hpp" // constants::EMPTY
+
+#include "search/distancelib.hpp"
+#include "search/packedstatelib.hpp" // search::moves, search::GetTarget
+#include "search/rankinglib.hpp"     // search::HalfRank, search::IsSolvable, search::ToDigits
+
+namespace
+{
+constexpr int N = constants::EIGHT_PUZZLE_SIZE;
+constexpr size_t numOfPieces = constants::EIGHT_PUZZLE_NUM;
+constexpr std::uint32_t numOfReachableStates = search::numOfHalfRanks;
+
+using search::Digits;
+
+/// @brief Converts a layout into digits
+/// @param layout The layout of the puzzle
+/// @return The digits
+Digits LayoutToDigits(std::span<const int> layout)
+{
+    Digits digits{};
+    for (size_t i = 0; i < numOfPieces; i++)
+    {
+        digits[i] = (layout[i] == constants::EMPTY) ? 0 : static_cast<std::uint8_t>(layout[i]);
+    }
+
+    return digits;
+}
+
+/// @brief Packs the digits and the position of the empty piece into 40 bits
+/// @param digits The digits
+/// @param posX The position of the empty piece
+/// @return The packed state
+std::uint64_t PackDigits(const Digits &digits, int posX)
+{
+    std::uint64_t packed = static_cast<std::uint64_t>(posX) << (4 * numOfPieces);
+    for (size_t i = 0; i < numOfPieces; i++)
+    {
+        packed |= static_cast<std::uint64_t>(digits[i]) << (4 * i);
+    }
+
+    return packed;
+}
+
+/// @brief Unpacks the digits and the position of the empty piece
+/// @param packed The packed state
+/// @return The digits and the position of the empty piece
+std::pair<Digits, int> UnpackDigits(std::uint64_t packed)
+{
+    Digits digits{};
+    for (size_t i = 0; i < numOfPieces; i++)
+    {
+        digits[i] = static_cast<std::uint8_t>((packed >> (4 * i)) & 0xF);
+    }
+
+    return {digits, static_cast<int>(packed >> (4 * numOfPieces))};
+}
+} // namespace
+
+namespace search
+{
+DistanceTable::DistanceTable()
+    : distances_(numOfReachableStates, unreachable)
+{
+    // The goal is 1, 2, ..., 8 followed by the empty piece
+    Digits goal{};
+    for (size_t i = 0; i < numOfPieces - 1; i++)
+    {
+        goal[i] = static_cast<std::uint8_t>(i + 1);
+    }
+
+    std::vector<std::uint64_t> frontier;
+    std::vector<std::uint64_t> next;
+    frontier.reserve(numOfReachableStates);
+    next.reserve(numOfReachableStates);
+
+    frontier.push_back(PackDigits(goal, numOfPieces - 1));
+    distances_[HalfRank(goal)] = 0;
+
+    // Expand the states layer by layer, every layer is one move further away
+    for (std::uint8_t depth = 1; !frontier.empty(); depth++)
+    {
+        for (const std::uint64_t packed : frontier)
+        {
+            auto [digits, posX] = UnpackDigits(packed);
+
+            for (const search::Move &move : search::moves)
+            {
+                const int target = search::GetTarget(posX, move, N);
+                if (target < 0)
+                {
+                    continue;
+                }
+
+                std::swap(digits[static_cast<size_t>(posX)], digits[static_cast<size_t>(target)]);
+
+                if (std::uint8_t &dist = distances_[HalfRank(digits)]; dist == unreachable)
+                {
+                    dist = depth;
+                    next.push_back(PackDigits(digits, target));
+                }
+
+                std::swap(digits[static_cast<size_t>(posX)], digits[static_cast<size_t>(target)]);
+            }
+        }
+
+        frontier.swap(next);
+        next.clear();
+    }
+}
+
+std::uint8_t DistanceTable::GetDistance(std::span<const int> layout) const
+{
+    const Digits digits = LayoutToDigits(layout);
+
+    // Only the solvable states have a slot in the table
+    return IsSolvable(digits) ? distances_[HalfRank(digits)] : unreachable;
+}
+
+short DistanceTable::GetNextMove(std::span<const int> layout, int posX) const
+{
+    return FindNextMove(LayoutToDigits(layout), posX);
+}
+
+short DistanceTable::GetNextMove(PackedState state, int posX) const
+{
+    // The packed state uses the same encoding as the digits
+    return FindNextMove(ToDigits(state), posX);
+}
+
+short DistanceTable::FindNextMove(Digits digits, int posX) const
+{
+    if (!IsSolvable(digits))
+    {
+        return noMove;
+    }
+
+    const std::uint8_t dist = distances_[HalfRank(digits)];
+    if ((dist == 0) || (dist == unreachable))
+    {
+        return noMove;
+    }
+
+    // Any neighbour that is one move closer lies on an optimal path
+    for (const search::Move &move : search::moves)
+    {
+        const int target = search::GetTarget(posX, move, N);
+        if (target < 0)
+        {
+            continue;
+        }
+
+        std::swap(digits[static_cast<size_t>(posX)], digits[static_cast<size_t>(target)]);
+        const bool closer = (distances_[HalfRank(digits)] == dist - 1);
+        std::swap(digits[static_cast<size_t>(posX)], digits[static_cast<size_t>(target)]);
+
+        if (closer)
+        {
+            return move.dir;
+        }
+    }
+
+    return noMove;
+}
+} // namespace search
@@ -0,0 +1,868 @@
+#include <algorithm> // std::max
+#include <chrono>    // std::chrono::seconds
+#include <cstdint>   // std::uint64_t
+#include <future>    // std::future_status
+#include <memory>    // std::make_unique, std::unique_ptr
+#include <mutex>     // std::call_once
+#include <optional>  // std::optional, std::nullopt
+
+#include "raylib.h"
+
+#include "gui/animationlib.hpp"   // RaylibAnimation
+#include "gui/arenalib.hpp"       // Arena
+#include "gui/buttonlib.hpp"      // gui::ButtonState, gui::ClickTracker
+#include "gui/celebrationlib.hpp" // Celebration
+#include "gui/colourlib.hpp"
+#include "gui/gamescreenslib.hpp"
+#include "gui/inputlib.hpp"       // gui::InputQueue
+#include "gui/layerlib.hpp"       // Layer
+#include "gui/menulib.hpp"        // Menu
+
+namespace
+{
+constexpr int celebrationInstrOffsetY = 50;
+
+// The leaderboard of this kiosk alone, kept apart from the file of the shared server
+constexpr const char *leaderboardPath = "kiosk-leaderboard.bin";
+
+/// @brief Waits for a full left click (press and release) or ENTER
+///
+/// The click has to start on the screen itself, so the release of the click
+/// that opened the screen does not skip it straight away.
+class ClickThrough
+{
+public:
+    ClickThrough() : leftClickPressed_(false) {}
+
+    /// @brief Forgets any click that started on another screen
+    inline void Reset() noexcept { leftClickPressed_ = false; }
+
+    /// @brief Updates the state
+    /// @param input The input of the frame
+    /// @return TRUE if the user has clicked through
+    bool Update(const gui::InputQueue &input)
+    {
+        if (input.WasMousePressed())
+        {
+            leftClickPressed_ = true;
+        }
+
+        return input.WasKeyPressed(KEY_ENTER) || (leftClickPressed_ && input.WasMouseReleased());
+    }
+
+private:
+    /// @brief TRUE if the left button was pressed on this screen
+    bool leftClickPressed_;
+};
+
+/// @brief The intro animation
+class LogoScreen : public Screen
+{
+public:
+    explicit LogoScreen(ScreenContext &context) : animation_(context.GetLayout()) {}
+
+    GameScreenState Update() override
+    {
+        animation_.Update();
+
+        // Wait for the intro before jumping to TITLE screen
+        return animation_.IsDone() ? GameScreenState::TITLE : GameScreenState::LOGO;
+    }
+
+    void Draw() const override { animation_.Draw(); }
+
+    FramePacing GetFramePacing() const noexcept override { return FramePacing::FULL; }
+
+private:
+    RaylibAnimation animation_;
+};
+
+/// @brief The greeting
+class TitleScreen : public Screen
+{
+public:
+    explicit TitleScreen(ScreenContext &context)
+        : context_(context),
+          layout_(context.GetLayout()),
+          layer_(layout_.width, layout_.height, RAYWHITE)
+    {
+    }
+
+    GameScreenState Update() override
+    {
+        // Press enter or left click to change to MENU screen
+        const gui::InputQueue &input = context_.GetInput();
+        if (input.WasKeyPressed(KEY_ENTER) || input.WasMousePressed())
+        {
+            return GameScreenState::MENU;
+        }
+
+        return GameScreenState::TITLE;
+    }
+
+    void RefreshCache() override
+    {
+        // The title screen never changes once it is rendered
+        if (!layer_.NeedsRedraw(0))
+        {
+            return;
+        }
+
+        layer_.Begin(0);
+
+        DrawRectangle(0, 0, layout_.width, layout_.height, JADE_GREEN);
+
+        context_.DrawCentredText(gui::Sprite::GreetingTitleTxt,
+                                 static_cast<float>(layout_.height) / 3.0f, BLACK);
+        context_.DrawCentredText(gui::Sprite::TitleInstrTxt, layout_.instrTxtY, DARKBLUE);
+
+        layer_.End();
+    }
+
+    void Draw() const override { layer_.Draw(); }
+
+    void Resize(int width, int height) override { layer_.Resize(width, height); }
+
+private:
+    ScreenContext &context_;
+    const gui::Layout &layout_;
+    Layer layer_;
+};
+
+/// @brief The main menu
+class MenuScreen : public Screen
+{
+public:
+    explicit MenuScreen(ScreenContext &context)
+        : context_(context),
+          layout_(context.GetLayout()),
+          menu_(context.GetAtlas(), layout_, context.GetInput()),
+          layer_(layout_.width, layout_.height, RAYWHITE)
+    {
+    }
+
+    GameScreenState Update() override
+    {
+        menu_.Update();
+
+        switch (menu_.GetSelection())
+        {
+        case 0:
+        {
+            return GameScreenState::GAMEPLAY;
+        }
+        case 1:
+        {
+            return GameScreenState::ARENA;
+        }
+        case 2:
+        {
+            return GameScreenState::SETTINGS;
+        }
+        case 3:
+        {
+            context_.RequestClose();
+            break;
+        }
+        default:
+        {
+            break;
+        }
+        }
+
+        return GameScreenState::MENU;
+    }
+
+    void RefreshCache() override
+    {
+        const std::uint64_t key = static_cast<std::uint64_t>(menu_.GetHighlightedOption());
+        if (!layer_.NeedsRedraw(key))
+        {
+            return;
+        }
+
+        layer_.Begin(key);
+
+        menu_.Draw();
+
+        context_.DrawCentredText(gui::Sprite::MenuInstrTxt, layout_.instrTxtY, DARKBLUE);
+
+        layer_.End();
+    }
+
+    void Draw() const override { layer_.Draw(); }
+
+    void Resize(int width, int height) override { layer_.Resize(width, height); }
+
+private:
+    ScreenContext &context_;
+    const gui::Layout &layout_;
+    Menu menu_;
+    Layer layer_;
+};
+
+/// @brief The settings of the game
+class SettingsScreen : public Screen
+{
+public:
+    explicit SettingsScreen(ScreenContext &context)
+        : context_(context),
+          layout_(context.GetLayout()),
+          settings_(context.GetSettings()),
+          layer_(layout_.width, layout_.height, RAYWHITE)
+    {
+    }
+
+    GameScreenState Update() override
+    {
+        settings_.Update();
+
+        return settings_.Exit() ? GameScreenState::MENU : GameScreenState::SETTINGS;
+    }
+
+    void RefreshCache() override
+    {
+        const std::uint64_t key = settings_.GetStaticStateKey();
+        if (!layer_.NeedsRedraw(key))
+        {
+            return;
+        }
+
+        layer_.Begin(key);
+
+        settings_.DrawStatic();
+
+        context_.DrawCentredText(gui::Sprite::SettingsInstrTxt, layout_.instrTxtY, DARKBLUE);
+
+        layer_.End();
+    }
+
+    void Draw() const override
+    {
+        layer_.Draw();
+
+        // The widgets handle the input while drawing so they cannot be cached
+        settings_.DrawWidgets();
+    }
+
+    void Resize(int width, int height) override { layer_.Resize(width, height); }
+
+private:
+    const ScreenContext &context_;
+    const gui::Layout &layout_;
+    Settings &settings_;
+    Layer layer_;
+};
+
+/// @brief The puzzle itself
+class GameplayScreen : public Screen
+{
+public:
+    explicit GameplayScreen(ScreenContext &context)
+        : context_(context),
+          layout_(context.GetLayout()),
+          board_(context.GetBoard()),
+          settings_(context.GetSettings()),
+          statsLog_(context.GetStatsLog())
+    {
+    }
+
+    GameScreenState Update() override
+    {
+        // Follow the user's choice of background music
+        if (settings_.GetBackgroundMusic())
+        {
+            board_.EnableBackgroundMusic();
+        }
+        else
+        {
+            board_.DisableBackgroundMusic();
+        }
+
+        board_.Update();
+
+        if (board_.IsFinished())
+        {
+            const stats::GameRecord record = board_.GetRecord();
+            statsLog_.Append(record);
+            context_.SubmitToLeaderboard(record);
+            return GameScreenState::CELEBRATION;
+        }
+        else if (board_.RequestedHelp())
+        {
+            return GameScreenState::HELP;
+        }
+
+        return GameScreenState::GAMEPLAY;
+    }
+
+    void Draw() const override
+    {
+        DrawRectangle(0, 0, layout_.width, layout_.height, BEIGE);
+
+        board_.Draw();
+    }
+
+    FramePacing GetFramePacing() const noexcept override
+    {
+        // The background music is streamed and has to be updated regularly, a
+        // sliding piece needs every frame to look smooth
+        return board_.IsAnimating() ? FramePacing::FULL : FramePacing::REDUCED;
+    }
+
+private:
+    ScreenContext &context_;
+    const gui::Layout &layout_;
+    Board &board_;
+    const Settings &settings_;
+    stats::StatsLog &statsLog_;
+};
+
+/// @brief The solution played back by the board
+class HelpScreen : public Screen
+{
+public:
+    explicit HelpScreen(ScreenContext &context)
+        : layout_(context.GetLayout()),
+          board_(context.GetBoard()),
+          statsLog_(context.GetStatsLog())
+    {
+    }
+
+    GameScreenState Update() override
+    {
+        board_.UpdateSolution();
+
+        if (board_.IsFinished())
+        {
+            statsLog_.Append(board_.GetRecord());
+            return GameScreenState::SAD;
+        }
+
+        return GameScreenState::HELP;
+    }
+
+    void Draw() const override
+    {
+        DrawRectangle(0, 0, layout_.width, layout_.height, RED);
+
+        board_.DrawSolution();
+    }
+
+    FramePacing GetFramePacing() const noexcept override { return FramePacing::FULL; }
+
+private:
+    const gui::Layout &layout_;
+    Board &board_;
+    stats::StatsLog &statsLog_;
+};
+
+/// @brief The screen after the solution is shown
+class SadScreen : public Screen
+{
+public:
+    explicit SadScreen(ScreenContext &context)
+        : context_(context),
+          layout_(context.GetLayout())
+    {
+    }
+
+    void Enter() override { clickThrough_.Reset(); }
+
+    GameScreenState Update() override
+    {
+        // Press ENTER or left click to change to ENDING screen
+        return clickThrough_.Update(context_.GetInput()) ? GameScreenState::ENDING
+                                                         : GameScreenState::SAD;
+    }
+
+    void Draw() const override
+    {
+        DrawRectangle(0, 0, layout_.width, layout_.height, RED);
+
+        context_.DrawCentredText(gui::Sprite::SadInstrTxt, layout_.instrTxtY, DARKBLUE);
+        context_.DrawCentredText(gui::Sprite::PepTalkTxt, layout_.centre.y, DARKBLUE);
+    }
+
+private:
+    ScreenContext &context_;
+    const gui::Layout &layout_;
+    ClickThrough clickThrough_;
+};
+
+/// @brief The confetti after the user solves the puzzle
+class CelebrationScreen : public Screen
+{
+public:
+    explicit CelebrationScreen(ScreenContext &context)
+        : context_(context),
+          layout_(context.GetLayout()),
+          board_(context.GetBoard()),
+          celebration_(context.GetRandomService().MakeStream(RandomStream::CELEBRATION))
+    {
+    }
+
+    void Enter() override { clickThrough_.Reset(); }
+
+    void Exit() override { celebration_.StopApplauseSound(); }
+
+    GameScreenState Update() override
+    {
+        celebration_.PlayApplauseSound();
+        celebration_.Update();
+
+        // Press ENTER or left click to change to ENDING screen
+        return clickThrough_.Update(context_.GetInput()) ? GameScreenState::ENDING
+                                                         : GameScreenState::CELEBRATION;
+    }
+
+    void Draw() const override
+    {
+        DrawRectangle(0, 0, layout_.width, layout_.height, BEIGE);
+
+        context_.DrawCentredText(gui::Sprite::CelebrationInstrTxt,
+                                 layout_.instrTxtY + celebrationInstrOffsetY * layout_.scale,
+                                 DARKBLUE);
+
+        board_.DrawResult();
+        DrawRank();
+        celebration_.Draw();
+    }
+
+    FramePacing GetFramePacing() const noexcept override { return FramePacing::FULL; }
+
+private:
+    /// @brief Draws the ranks of the game on the leaderboard of its band (once it answers)
+    void DrawRank() const
+    {
+        const std::optional<stats::Standing> standing = context_.GetLastStanding();
+        if (!standing)
+        {
+            return;
+        }
+
+        const Atlas &atlas = context_.GetAtlas();
+
+        // Both ranks start at the same x like the moves above them
+        const float ofWidth = atlas.GetSize(gui::Sprite::RankOfTxt).x +
+                              atlas.MeasureNumber(standing->numOfEntries, 1, gui::DigitSize::Small);
+        const float textWidth =
+            ofWidth +
+            std::max(atlas.GetSize(gui::Sprite::RankTxt).x +
+                         atlas.MeasureNumber(standing->efficiencyRank, 1, gui::DigitSize::Small),
+                     atlas.GetSize(gui::Sprite::TimeRankTxt).x +
+                         atlas.MeasureNumber(standing->timeRank, 1, gui::DigitSize::Small));
+
+        DrawRankCounter(layout_.board.rankCounter, gui::Sprite::RankTxt, standing->efficiencyRank,
+                        standing->numOfEntries, textWidth, DARKGREEN);
+        DrawRankCounter(layout_.board.timeRankCounter, gui::Sprite::TimeRankTxt,
+                        standing->timeRank, standing->numOfEntries, textWidth, DARKPURPLE);
+    }
+
+    /// @brief Draws a rank in its counter
+    /// @param rect The counter
+    /// @param label The text before the rank
+    /// @param rank The rank
+    /// @param numOfEntries The number of games in the band
+    /// @param textWidth The width of the widest rank
+    /// @param colour The colour of the text
+    void DrawRankCounter(const Rectangle &rect, gui::Sprite label, unsigned rank,
+                         unsigned numOfEntries, float textWidth, Color colour) const
+    {
+        const Atlas &atlas = context_.GetAtlas();
+        const float textHeight = atlas.GetSize(label).y;
+
+        DrawRectangleRounded(rect, gui::cornerRadius, gui::segments, LIGHTGRAY);
+
+        Vector2 pos = {rect.x + (rect.width - textWidth) / 2,
+                       rect.y + (rect.height - textHeight) / 2};
+        atlas.Draw(label, pos, colour);
+        pos.x += atlas.GetSize(label).x;
+        atlas.DrawNumber(rank, 1, gui::DigitSize::Small, pos, colour);
+        pos.x += atlas.MeasureNumber(rank, 1, gui::DigitSize::Small);
+        atlas.Draw(gui::Sprite::RankOfTxt, pos, colour);
+        pos.x += atlas.GetSize(gui::Sprite::RankOfTxt).x;
+        atlas.DrawNumber(numOfEntries, 1, gui::DigitSize::Small, pos, colour);
+    }
+
+private:
+    ScreenContext &context_;
+    const gui::Layout &layout_;
+    const Board &board_;
+    Celebration celebration_;
+    ClickThrough clickThrough_;
+};
+
+/// @brief The choice between restarting the puzzle and a new one
+class EndingScreen : public Screen
+{
+public:
+    explicit EndingScreen(ScreenContext &context)
+        : context_(context),
+          layout_(context.GetLayout()),
+          board_(context.GetBoard()),
+          layer_(layout_.width, layout_.height, RAYWHITE),
+          restartBtnState_(gui::ButtonState::Unselected),
+          newGameBtnState_(gui::ButtonState::Unselected),
+          clickTracker_()
+    {
+    }
+
+    // A press that started on the board is a drag, not a click on a button here
+    void Enter() override { clickTracker_.Reset(); }
+
+    GameScreenState Update() override
+    {
+        const gui::InputQueue &input = context_.GetInput();
+
+        // A click only counts if it is released over the button it was pressed on
+        const Vector2 mousePos = input.GetMousePos();
+        const gui::Button hovered =
+            CheckCollisionPointRec(mousePos, layout_.ending.restartBtn)   ? gui::Button::Restart
+            : CheckCollisionPointRec(mousePos, layout_.ending.newGameBtn) ? gui::Button::NewGame
+                                                                          : gui::Button::Invalid;
+        const gui::Button clicked =
+            clickTracker_.Update(hovered, input.WasMousePressed(), input.WasMouseReleased());
+
+        const bool restartBtnAction =
+            UpdateButton(gui::Button::Restart, hovered, clicked, input, restartBtnState_);
+        const bool newGameBtnAction =
+            UpdateButton(gui::Button::NewGame, hovered, clicked, input, newGameBtnState_);
+
+        // Check if the restart button needs to take action
+        if (restartBtnAction)
+        {
+            board_.Restart();
+            return GameScreenState::GAMEPLAY;
+        }
+
+        // Check if the new game button needs to take action
+        if (newGameBtnAction)
+        {
+            board_.Reset();
+            return GameScreenState::GAMEPLAY;
+        }
+
+        return GameScreenState::ENDING;
+    }
+
+    void RefreshCache() override
+    {
+        const std::uint64_t key = (static_cast<std::uint64_t>(restartBtnState_) << 8) |
+                                  static_cast<std::uint64_t>(newGameBtnState_);
+        if (!layer_.NeedsRedraw(key))
+        {
+            return;
+        }
+
+        layer_.Begin(key);
+
+        DrawRectangle(0, 0, layout_.width, layout_.height, BLUE);
+
+        context_.DrawCentredText(gui::Sprite::EndingInstrTxt, layout_.instrTxtY, DARKBLUE);
+
+        // The restart button
+        const Rectangle &restartBox = layout_.ending.restartBtn;
+        DrawRectangleRounded(restartBox, gui::cornerRadius, gui::segments,
+                             (restartBtnState_ == gui::ButtonState::Selected)  ? CRIMSON
+                             : (restartBtnState_ == gui::ButtonState::Hovered) ? FIREBRICK
+                                                                               : MAROON);
+        context_.DrawTextInBox(gui::Sprite::RestartBtnTxt, restartBox);
+
+        // The new game button
+        const Rectangle &newGameBox = layout_.ending.newGameBtn;
+        DrawRectangleRounded(newGameBox, gui::cornerRadius, gui::segments,
+                             (newGameBtnState_ == gui::ButtonState::Selected)  ? DEEP_SKY_BLUE
+                             : (newGameBtnState_ == gui::ButtonState::Hovered) ? STEEL_BLUE
+                                                                               : CAROLINE_BLUE);
+        context_.DrawTextInBox(gui::Sprite::NewGameBtnTxt, newGameBox);
+
+        layer_.End();
+    }
+
+    void Draw() const override { layer_.Draw(); }
+
+    void Resize(int width, int height) override { layer_.Resize(width, height); }
+
+private:
+    /// @brief Updates the state of a button
+    /// @param button The button
+    /// @param hovered The button under the cursor
+    /// @param clicked The button that was clicked in this frame, see gui::ClickTracker
+    /// @param input The input of the frame
+    /// @param state The state of the button
+    /// @return TRUE if the button is clicked
+    static bool UpdateButton(gui::Button button, gui::Button hovered, gui::Button clicked,
+                             const gui::InputQueue &input, gui::ButtonState &state)
+    {
+        if (hovered != button)
+        {
+            state = gui::ButtonState::Unselected;
+            return false;
+        }
+
+        state = input.IsMouseDown() ? gui::ButtonState::Selected : gui::ButtonState::Hovered;
+
+        return clicked == button;
+    }
+
+private:
+    ScreenContext &context_;
+    const gui::Layout &layout_;
+    Board &board_;
+    Layer layer_;
+    gui::ButtonState restartBtnState_;
+    gui::ButtonState newGameBtnState_;
+    gui::ClickTracker clickTracker_;
+};
+
+/// @brief Many boards solving themselves
+class ArenaScreen : public Screen
+{
+public:
+    explicit ArenaScreen(ScreenContext &context)
+        : context_(context),
+          layout_(context.GetLayout()),
+          arena_(context.GetAtlas(), layout_, context.GetDistanceTable(),
+                 context.GetThreadPool(), context.GetRandomService())
+    {
+    }
+
+    void Enter() override { arena_.Reset(); }
+
+    GameScreenState Update() override
+    {
+        arena_.Update();
+
+        // Press ENTER to go back to MENU screen
+        return context_.GetInput().WasKeyPressed(KEY_ENTER) ? GameScreenState::MENU
+                                                            : GameScreenState::ARENA;
+    }
+
+    void Draw() const override
+    {
+        DrawRectangle(0, 0, layout_.width, layout_.height, BEIGE);
+
+        context_.DrawCentredText(gui::Sprite::ArenaInstrTxt, layout_.instrTxtY, DARKBLUE);
+
+        arena_.Draw();
+    }
+
+    FramePacing GetFramePacing() const noexcept override { return FramePacing::FULL; }
+
+private:
+    ScreenContext &context_;
+    const gui::Layout &layout_;
+    Arena arena_;
+};
+} // namespace
+
+ScreenContext::ScreenContext(const Atlas &atlas, const gui::Layout &layout,
+                             search::SolutionCache &solutionCache, ThreadPool &pool,
+                             stats::StatsLog &statsLog, const RandomService &random,
+                             const creator::PuzzlePack &puzzlePack,
+                             creator::PuzzleImporter &puzzleImporter, gui::InputQueue &input,
+                             search::Algorithm algorithm)
+    : atlas_(atlas),
+      layout_(layout),
+      solutionCache_(solutionCache),
+      pool_(pool),
+      statsLog_(statsLog),
+      random_(random),
+      puzzlePack_(puzzlePack),
+      puzzleImporter_(puzzleImporter),
+      input_(input),
+      algorithm_(algorithm),
+      distanceTablePtr_(nullptr),
+      boardPtr_(nullptr),
+      settingsPtr_(nullptr),
+      leaderboardClient_(stats::defaultLeaderboardSocket),
+      leaderboardPtr_(nullptr),
+      lastStanding_(std::nullopt),
+      close_(false)
+{
+}
+
+ScreenContext::~ScreenContext()
+{
+    // The tasks on the pool still refer to the members of the context
+    if (boardBuild_.valid())
+    {
+        boardBuild_.wait();
+    }
+    if (lastSubmit_.valid())
+    {
+        lastSubmit_.wait();
+    }
+}
+
+const search::DistanceTable &ScreenContext::GetDistanceTable()
+{
+    std::call_once(distanceTableOnce_,
+                   [this] { distanceTablePtr_ = std::make_unique<search::DistanceTable>(); });
+
+    return *distanceTablePtr_;
+}
+
+bool ScreenContext::PrepareBoard()
+{
+    if (boardBuild_.valid())
+    {
+        return boardBuild_.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    if (boardPtr_)
+    {
+        return true;
+    }
+
+    // The distance table and the cold solve take far longer than a frame
+    boardBuild_ = pool_.Submit(
+        [this]
+        {
+            boardPtr_ = std::make_unique<Board>(atlas_, layout_, GetDistanceTable(), solutionCache_,
+                                                puzzlePack_, puzzleImporter_,
+                                                random_.MakeStream(RandomStream::CREATOR),
+                                                algorithm_, pool_, input_);
+        });
+
+    return false;
+}
+
+Board &ScreenContext::GetBoard()
+{
+    if (boardPtr_ && !boardBuild_.valid())
+    {
+        return *boardPtr_;
+    }
+
+    // Take the board that the pool built (or build it right here), then give it its audio
+    if (!PrepareBoard())
+    {
+        boardBuild_.wait();
+    }
+    boardBuild_.get();
+    boardPtr_->LoadAudio();
+
+    return *boardPtr_;
+}
+
+Settings &ScreenContext::GetSettings()
+{
+    if (!settingsPtr_)
+    {
+        settingsPtr_ = std::make_unique<Settings>(atlas_, layout_, input_);
+    }
+
+    return *settingsPtr_;
+}
+
+void ScreenContext::SubmitToLeaderboard(const stats::GameRecord &record)
+{
+    // NOTE: a game takes far longer than a submission, so this hardly ever waits
+    if (lastSubmit_.valid())
+    {
+        lastSubmit_.wait();
+    }
+
+    // A server that hangs keeps the socket busy until it times out, so the round
+    // trip (or the first read of the local file) never runs on the main thread
+    const stats::Entry entry = stats::ToEntry(record);
+    lastSubmit_ = pool_.Submit(
+        [this, entry]
+        {
+            lastStanding_ = leaderboardClient_.Submit(entry);
+            if (lastStanding_)
+            {
+                return;
+            }
+
+            if (!leaderboardPtr_)
+            {
+                leaderboardPtr_ = std::make_unique<stats::Leaderboard>(leaderboardPath);
+            }
+            lastStanding_ = leaderboardPtr_->Submit(entry);
+        });
+}
+
+std::optional<stats::Standing> ScreenContext::GetLastStanding() const
+{
+    if (!lastSubmit_.valid() ||
+        (lastSubmit_.wait_for(std::chrono::seconds(0)) != std::future_status::ready))
+    {
+        return std::nullopt;
+    }
+
+    return lastStanding_;
+}
+
+void ScreenContext::DrawCentredText(gui::Sprite sprite, float y, Color colour) const
+{
+    const float width = atlas_.GetSize(sprite).x;
+    atlas_.Draw(sprite, {(static_cast<float>(layout_.width) - width) / 2, y}, colour);
+}
+
+void ScreenContext::DrawTextInBox(gui::Sprite sprite, const Rectangle &box) const
+{
+    const Vector2 size = atlas_.GetSize(sprite);
+    atlas_.Draw(sprite, {box.x + (box.width - size.x) / 2, box.y + (box.height - size.y) / 2},
+                WHITE);
+}
+
+namespace gui
+{
+std::unique_ptr<Screen> CreateLogoScreen(ScreenContext &context)
+{
+    return std::make_unique<LogoScreen>(context);
+}
+
+std::unique_ptr<Screen> CreateTitleScreen(ScreenContext &context)
+{
+    return std::make_unique<TitleScreen>(context);
+}
+
+std::unique_ptr<Screen> CreateMenuScreen(ScreenContext &context)
+{
+    return std::make_unique<MenuScreen>(context);
+}
+
+std::unique_ptr<Screen> CreateSettingsScreen(ScreenContext &context)
+{
+    return std::make_unique<SettingsScreen>(context);
+}
+
+std::unique_ptr<Screen> CreateGameplayScreen(ScreenContext &context)
+{
+    return std::make_unique<GameplayScreen>(context);
+}
+
+bool PrepareGameplayScreen(ScreenContext &context)
+{
+    return context.PrepareBoard();
+}
+
+std::unique_ptr<Screen> CreateHelpScreen(ScreenContext &context)
+{
+    return std::make_unique<HelpScreen>(context);
+}
+
+std::unique_ptr<Screen> CreateSadScreen(ScreenContext &context)
+{
+    return std::make_unique<SadScreen>(context);
+}
+
+std::unique_ptr<Screen> CreateCelebrationScreen(ScreenContext &context)
+{
+    return std::make_unique<CelebrationScreen>(context);
+}
+
+std::unique_ptr<Screen> CreateEndingScreen(ScreenContext &context)
+{
+    return std::make_unique<EndingScreen>(context);
+}
+
+std::unique_ptr<Screen> CreateArenaScreen(ScreenContext &context)
+{
+    return std::make_unique<ArenaScreen>(context);
+}
+} // namespace gui
@@ -0,0 +1,353 @@
+#include <algorithm> // std::max
+#include <array>     // std::array
+#include <cstdint>   // std::uint8_t, std::uint16_t, std::uint64_t
+#include <cstdlib>   // std::abs
+#include <deque>     // std::deque
+#include <vector>    // std::vector
+
+#include "search/heuristicslib.hpp"
+
+namespace
+{
+constexpr int N = constants::EIGHT_PUZZLE_SIZE;
+
+// The fields of a walking distance configuration: the count of each
+// (line, goal line) pair, then the line of the empty piece
+constexpr int countBits = 3;
+constexpr int blankShift = countBits * N * N;
+
+// The transition that leaves the board
+constexpr std::uint16_t noConfig = 0xFFFF;
+
+/// @brief The number of pieces in each line that belong in each goal line
+using Counts = std::array<std::array<int, N>, N>;
+
+/// @brief Encodes a walking distance configuration
+/// @param counts The counts
+/// @param blank The line of the empty piece
+/// @return The key of the configuration
+std::uint64_t EncodeConfig(const Counts &counts, int blank) noexcept
+{
+    std::uint64_t key = static_cast<std::uint64_t>(blank) << blankShift;
+    for (size_t i = 0; i < N; i++)
+    {
+        for (size_t j = 0; j < N; j++)
+        {
+            key |= static_cast<std::uint64_t>(counts[i][j]) << (countBits * (i * N + j));
+        }
+    }
+
+    return key;
+}
+
+/// @brief Decodes a walking distance configuration
+/// @param key The key of the configuration
+/// @param counts The counts
+/// @return The line of the empty piece
+int DecodeConfig(std::uint64_t key, Counts &counts) noexcept
+{
+    for (size_t i = 0; i < N; i++)
+    {
+        for (size_t j = 0; j < N; j++)
+        {
+            counts[i][j] = static_cast<int>((key >> (countBits * (i * N + j))) & 0x7);
+        }
+    }
+
+    return static_cast<int>(key >> blankShift);
+}
+
+/// @brief Counts the extra moves of the pieces of a line that are in the wrong order
+/// @param goals The goal positions along the line of the pieces that belong in it, in the
+/// order they are in
+/// @param size The number of such pieces
+/// @return Two moves for each piece that has to leave the line
+int CountConflicts(const std::array<int, N> &goals, size_t size) noexcept
+{
+    // The pieces that may stay form the longest increasing run of goals
+    std::array<size_t, N> longest{};
+    size_t kept = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        longest[i] = 1;
+        for (size_t j = 0; j < i; j++)
+        {
+            if (goals[j] < goals[i])
+            {
+                longest[i] = std::max(longest[i], longest[j] + 1);
+            }
+        }
+        kept = std::max(kept, longest[i]);
+    }
+
+    return 2 * static_cast<int>(size - kept);
+}
+
+/// @brief Gets the pieces of a column, one nibble each from the top
+/// @param state The packed state
+/// @param col The column
+/// @return The key of the column
+size_t GetColumnKey(search::PackedState state, int col) noexcept
+{
+    size_t key = 0;
+    for (int row = 0; row < N; row++)
+    {
+        key |= static_cast<size_t>(search::GetPiece(state, row * N + col)) << (4 * row);
+    }
+
+    return key;
+}
+} // namespace
+
+namespace search
+{
+Heuristics::Heuristics(HeuristicKind kind)
+    : kind_(kind),
+      manhattan_{},
+      rowConflicts_(N * numOfLineKeys, 0),
+      colConflicts_(N * numOfLineKeys, 0)
+{
+    // The goal of piece p is position p - 1, the empty piece (0) does not count
+    for (int piece = 1; piece < numOfPieces; piece++)
+    {
+        const int goal = piece - 1;
+        for (int pos = 0; pos < numOfPieces; pos++)
+        {
+            const int dist = std::abs(pos / N - goal / N) + std::abs(pos % N - goal % N);
+            manhattan_[static_cast<size_t>(piece)][static_cast<size_t>(pos)] =
+                static_cast<std::uint8_t>(dist);
+        }
+    }
+
+    BuildConflicts();
+    BuildWalkingDistance();
+}
+
+Estimate Heuristics::Evaluate(PackedState state) const
+{
+    Estimate estimate{0, 0, 0, 0, 0};
+    for (int pos = 0; pos < numOfPieces; pos++)
+    {
+        estimate.manhattan += GetManhattan(GetPiece(state, pos), pos);
+    }
+
+    // The diagonal touches every row and every column once
+    for (int i = 0; i < N; i++)
+    {
+        estimate.conflicts += GetLineConflicts(state, i * N + i, i * N + i);
+    }
+
+    estimate.rowsConfig = FindConfig(state, true);
+    estimate.colsConfig = FindConfig(state, false);
+    SetValue(estimate);
+
+    return estimate;
+}
+
+Estimate Heuristics::Update(const Estimate &parent, PackedState state, int posX,
+                            int target) const
+{
+    Estimate estimate = parent;
+
+    // Only the piece that slides changes the Manhattan distance
+    const int piece = GetPiece(state, target);
+    estimate.manhattan += GetManhattan(piece, posX) - GetManhattan(piece, target);
+
+    if (kind_ != HeuristicKind::MANHATTAN)
+    {
+        // Only the lines through the two positions change
+        const PackedState child = Slide(state, posX, target);
+        estimate.conflicts +=
+            GetLineConflicts(child, posX, target) - GetLineConflicts(state, posX, target);
+    }
+
+    if (kind_ == HeuristicKind::WALKING_DISTANCE)
+    {
+        // A vertical move takes the piece to another row, a horizontal one to another column
+        const size_t down = (target > posX) ? 1 : 0;
+        const size_t goal = static_cast<size_t>(piece - 1);
+        if (std::abs(target - posX) == N)
+        {
+            estimate.rowsConfig = transitions_[parent.rowsConfig][2 * (goal / N) + down];
+        }
+        else
+        {
+            estimate.colsConfig = transitions_[parent.colsConfig][2 * (goal % N) + down];
+        }
+    }
+
+    SetValue(estimate);
+
+    return estimate;
+}
+
+void Heuristics::BuildConflicts()
+{
+    for (int line = 0; line < N; line++)
+    {
+        for (size_t key = 0; key < numOfLineKeys; key++)
+        {
+            std::array<int, N> rowGoals{};
+            std::array<int, N> colGoals{};
+            size_t rowSize = 0;
+            size_t colSize = 0;
+            for (int k = 0; k < N; k++)
+            {
+                const int piece = static_cast<int>((key >> (4 * k)) & 0xF);
+                if ((piece == 0) || (piece >= numOfPieces))
+                {
+                    continue;
+                }
+
+                // A piece in its goal row is in the way along the row, likewise the columns
+                const int goal = piece - 1;
+                if (goal / N == line)
+                {
+                    rowGoals[rowSize++] = goal % N;
+                }
+                if (goal % N == line)
+                {
+                    colGoals[colSize++] = goal / N;
+                }
+            }
+
+            const size_t index = static_cast<size_t>(line) * numOfLineKeys + key;
+            rowConflicts_[index] = static_cast<std::uint8_t>(CountConflicts(rowGoals, rowSize));
+            colConflicts_[index] =
+                static_cast<std::uint8_t>(CountConflicts(colGoals, colSize));
+        }
+    }
+}
+
+void Heuristics::BuildWalkingDistance()
+{
+    // At the goal every line holds its own pieces, the last one is short of the empty piece
+    Counts goal{};
+    for (size_t i = 0; i < N; i++)
+    {
+        goal[i][i] = (i == N - 1) ? N - 1 : N;
+    }
+
+    std::deque<std::uint64_t> frontier{EncodeConfig(goal, N - 1)};
+    configIndex_.emplace(frontier.front(), 0);
+    walkingDistance_.push_back(0);
+    transitions_.emplace_back().fill(noConfig);
+
+    while (!frontier.empty())
+    {
+        const std::uint64_t key = frontier.front();
+        frontier.pop_front();
+
+        const std::uint16_t index = configIndex_.at(key);
+        Counts counts;
+        const int blank = DecodeConfig(key, counts);
+
+        // A piece of the line above or below slides into the line of the empty piece
+        for (size_t down = 0; down < 2; down++)
+        {
+            const int next = down ? blank + 1 : blank - 1;
+            if ((next < 0) || (next >= N))
+            {
+                continue;
+            }
+
+            const size_t from = static_cast<size_t>(next);
+            const size_t to = static_cast<size_t>(blank);
+            for (size_t g = 0; g < N; g++)
+            {
+                if (counts[from][g] == 0)
+                {
+                    continue;
+                }
+
+                Counts child = counts;
+                child[from][g]--;
+                child[to][g]++;
+                const std::uint64_t childKey = EncodeConfig(child, next);
+
+                auto [itr, isNew] = configIndex_.emplace(
+                    childKey, static_cast<std::uint16_t>(walkingDistance_.size()));
+                if (isNew)
+                {
+                    walkingDistance_.push_back(walkingDistance_[index] + 1);
+                    transitions_.emplace_back().fill(noConfig);
+                    frontier.push_back(childKey);
+                }
+                transitions_[index][2 * g + down] = itr->second;
+            }
+        }
+    }
+}
+
+int Heuristics::GetLineConflicts(PackedState state, int posA, int posB) const
+{
+    const int rowA = posA / N;
+    const int rowB = posB / N;
+    const int colA = posA % N;
+    const int colB = posB % N;
+
+    // The pieces of a row are next to each other in the packed state
+    const size_t rowMask = numOfLineKeys - 1;
+    const auto rowIndex = [&](int row)
+    { return static_cast<size_t>(row) * numOfLineKeys + ((state >> (4 * N * row)) & rowMask); };
+    const auto colIndex = [&](int col)
+    { return static_cast<size_t>(col) * numOfLineKeys + GetColumnKey(state, col); };
+
+    int conflicts = rowConflicts_[rowIndex(rowA)] + colConflicts_[colIndex(colA)];
+    if (rowB != rowA)
+    {
+        conflicts += rowConflicts_[rowIndex(rowB)];
+    }
+    if (colB != colA)
+    {
+        conflicts += colConflicts_[colIndex(colB)];
+    }
+
+    return conflicts;
+}
+
+std::uint16_t Heuristics::FindConfig(PackedState state, bool byRow) const
+{
+    Counts counts{};
+    int blank = 0;
+    for (int pos = 0; pos < numOfPieces; pos++)
+    {
+        const int line = byRow ? pos / N : pos % N;
+        const int piece = GetPiece(state, pos);
+        if (piece == 0)
+        {
+            blank = line;
+            continue;
+        }
+
+        const int goal = piece - 1;
+        counts[static_cast<size_t>(line)][static_cast<size_t>(byRow ? goal / N : goal % N)]++;
+    }
+
+    return configIndex_.at(EncodeConfig(counts, blank));
+}
+
+void Heuristics::SetValue(Estimate &estimate) const
+{
+    switch (kind_)
+    {
+    case HeuristicKind::MANHATTAN:
+    {
+        estimate.value = estimate.manhattan;
+        break;
+    }
+    case HeuristicKind::LINEAR_CONFLICT:
+    {
+        estimate.value = estimate.manhattan + estimate.conflicts;
+        break;
+    }
+    case HeuristicKind::WALKING_DISTANCE:
+    {
+        const int walking =
+            walkingDistance_[estimate.rowsConfig] + walkingDistance_[estimate.colsConfig];
+        estimate.value = std::max(walking, estimate.manhattan + estimate.conflicts);
+        break;
+    }
+    }
+}
+} // namespace search
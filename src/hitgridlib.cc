@@ -0,0 +1,135 @@
+#include <algorithm> // std::clamp, std::max
+#include <cmath>     // std::ceil
+
+#include "raylib.h" // CheckCollisionPointRec
+
+#include "gui/hitgridlib.hpp"
+
+namespace
+{
+/// @brief Maps a coordinate to a column (or a row) of a grid without bound checks
+/// @param v The coordinate
+/// @param start The start of the grid
+/// @param len The length of the grid
+/// @param n The number of columns (or rows)
+/// @return The column (or the row) clamped into the grid
+int ToGridIndex(float v, float start, float len, int n)
+{
+    return std::clamp(static_cast<int>((v - start) * static_cast<float>(n) / len), 0, n - 1);
+}
+
+/// @brief Maps the end of a range to the last column (or row) it reaches
+/// NOTE: the end itself is outside the range, so an end on a cell edge stays in the cell before
+/// @param end The end of the range (exclusive)
+/// @param start The start of the grid
+/// @param len The length of the grid
+/// @param n The number of columns (or rows)
+/// @return The column (or the row) clamped into the grid
+int ToLastGridIndex(float end, float start, float len, int n)
+{
+    const float pos = (end - start) * static_cast<float>(n) / len;
+    return std::clamp(static_cast<int>(std::ceil(pos)) - 1, 0, n - 1);
+}
+} // namespace
+
+namespace gui
+{
+int GetCellIndex(const Rectangle &box, int cols, int rows, Vector2 pos) noexcept
+{
+    if ((pos.x < box.x) || (pos.y < box.y) || (pos.x >= box.x + box.width) ||
+        (pos.y >= box.y + box.height))
+    {
+        return noHit;
+    }
+
+    const int col = ToGridIndex(pos.x, box.x, box.width, cols);
+    const int row = ToGridIndex(pos.y, box.y, box.height, rows);
+
+    return row * cols + col;
+}
+} // namespace gui
+
+HitGrid::HitGrid()
+    : bounds_{},
+      cells_{},
+      recs_{},
+      ids_{},
+      numOfWidgets_(0)
+{
+}
+
+void HitGrid::Reset(const Rectangle &bounds)
+{
+    bounds_ = bounds;
+    numOfWidgets_ = 0;
+
+    for (Cell &cell : cells_)
+    {
+        cell.count = 0;
+    }
+}
+
+bool HitGrid::Register(int id, const Rectangle &rec)
+{
+    if (numOfWidgets_ == maxWidgets)
+    {
+        return false;
+    }
+
+    // Find the cells that the rectangle overlaps
+    const int firstCol = ToGridIndex(rec.x, bounds_.x, bounds_.width, gridSize);
+    const int lastCol = std::max(
+        firstCol, ToLastGridIndex(rec.x + rec.width, bounds_.x, bounds_.width, gridSize));
+    const int firstRow = ToGridIndex(rec.y, bounds_.y, bounds_.height, gridSize);
+    const int lastRow = std::max(
+        firstRow, ToLastGridIndex(rec.y + rec.height, bounds_.y, bounds_.height, gridSize));
+
+    // Make sure there is room in every cell before touching any of them
+    for (int row = firstRow; row <= lastRow; row++)
+    {
+        for (int col = firstCol; col <= lastCol; col++)
+        {
+            if (cells_[static_cast<size_t>(row * gridSize + col)].count == maxWidgetsPerCell)
+            {
+                return false;
+            }
+        }
+    }
+
+    const size_t widget = static_cast<size_t>(numOfWidgets_++);
+    recs_[widget] = rec;
+    ids_[widget] = id;
+
+    for (int row = firstRow; row <= lastRow; row++)
+    {
+        for (int col = firstCol; col <= lastCol; col++)
+        {
+            Cell &cell = cells_[static_cast<size_t>(row * gridSize + col)];
+            cell.widgets[cell.count++] = static_cast<std::uint8_t>(widget);
+        }
+    }
+
+    return true;
+}
+
+int HitGrid::Query(Vector2 pos) const noexcept
+{
+    const int idx = gui::GetCellIndex(bounds_, gridSize, gridSize, pos);
+    if (idx == gui::noHit)
+    {
+        return gui::noHit;
+    }
+
+    // Only the widgets in the cell can be hit
+    const Cell &cell = cells_[static_cast<size_t>(idx)];
+    for (size_t i = 0; i < cell.count; i++)
+    {
+        const size_t widget = cell.widgets[i];
+        if (CheckCollisionPointRec(pos, recs_[widget]))
+        {
+            return ids_[widget];
+        }
+    }
+
+    return gui::noHit;
+}
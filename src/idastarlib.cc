@@ -0,0 +1,228 @@
+#include <algorithm> // std::max, std::min
+#include <cstdint>   // std::uint8_t
+#include <span>      // std::span
+#include <vector>    // std::vector
+
+#include "search/idastarlib.hpp"
+#include "search/packedstatelib.hpp" // search::Pack, search::Slide, search::moves
+
+namespace
+{
+constexpr int infinity = 1'000;
+constexpr short noDir = -1;
+
+// The memory of the table of the lower bounds (a million entries)
+constexpr size_t defaultTableMemory = size_t{8} << 20;
+} // namespace
+
+namespace search
+{
+IdaStar::IdaStar() : IdaStar(HeuristicKind::WALKING_DISTANCE, defaultTableMemory)
+{
+}
+
+IdaStar::IdaStar(HeuristicKind heuristic, size_t tableMemory)
+    : heuristics_(heuristic),
+      lowerBounds_(tableMemory),
+      solvedLength_(-1),
+      bound_(0),
+      joinedState_(0),
+      joinedPosX_(0),
+      found_(false),
+      expandedNodes_(0),
+      tableCounters_{}
+{
+}
+
+std::vector<short> IdaStar::Solve(std::span<const int> layout, int posX)
+{
+    lowerBounds_.NewSearch();
+    optimalPath_.clear();
+
+    const PackedState start = Pack(layout);
+    std::vector<short> dirs = Search(start, posX, 0);
+
+    RememberPath(start, posX, dirs);
+    solvedLength_ = static_cast<int>(dirs.size());
+
+    return dirs;
+}
+
+void IdaStar::Adopt(std::span<const int> layout, int posX, std::span<const short> dirs)
+{
+    lowerBounds_.NewSearch();
+    optimalPath_.clear();
+
+    RememberPath(Pack(layout), posX, dirs);
+    solvedLength_ = static_cast<int>(dirs.size());
+}
+
+std::vector<short> IdaStar::SolveFrom(std::span<const int> layout, int posX, int movesFromStart)
+{
+    if (solvedLength_ < 0)
+    {
+        return Solve(layout, posX);
+    }
+
+    // The optimal solution from the start can never be longer than the moves
+    // made so far plus the optimal solution from here
+    const PackedState start = Pack(layout);
+    std::vector<short> dirs = Search(start, posX, solvedLength_ - movesFromStart);
+
+    RememberPath(start, posX, dirs);
+
+    return dirs;
+}
+
+void IdaStar::ForgetBounds() noexcept
+{
+    lowerBounds_.Clear();
+    tableCounters_ = {};
+}
+
+std::vector<short> IdaStar::Search(PackedState start, int posX, int lowerBound)
+{
+    path_.clear();
+    found_ = false;
+    expandedNodes_ = 0;
+
+    const Estimate estimate = heuristics_.Evaluate(start);
+    bound_ = std::max({lowerBound, estimate.value, lowerBounds_.Probe(start, tableCounters_)});
+
+    // Deepen the bound until a solution shows up
+    while (!found_ && (bound_ < infinity))
+    {
+        // A whole iteration without a solution rules out every length up to the bound,
+        // even if the bound it returns was lowered by a learned one that got evicted
+        const int next = DepthFirst(start, posX, 0, estimate, infinity, noDir);
+        bound_ = found_ ? next : std::max(next, bound_ + 1);
+    }
+
+    std::vector<short> dirs = path_;
+    if (found_)
+    {
+        FollowKnownPath(joinedState_, joinedPosX_, dirs);
+    }
+
+    return dirs;
+}
+
+int IdaStar::DepthFirst(PackedState state, int posX, int g, const Estimate &estimate,
+                        int parentLowerBound, short prevDir)
+{
+    ++expandedNodes_;
+
+    // A state on a known optimal path has an exact distance
+    if (const auto itr = optimalPath_.find(state); itr != optimalPath_.cend())
+    {
+        const int f = g + itr->second.distance;
+        if (f <= bound_)
+        {
+            found_ = true;
+            joinedState_ = state;
+            joinedPosX_ = posX;
+        }
+        return f;
+    }
+
+    if (estimate.value == 0)
+    {
+        found_ = true;
+        joinedState_ = state;
+        joinedPosX_ = posX;
+        return g;
+    }
+
+    const int lowerBound = std::max(estimate.value, lowerBounds_.Probe(state, tableCounters_));
+
+    if (g + lowerBound > bound_)
+    {
+        return g + lowerBound;
+    }
+
+    // NOTE: going back is never expanded but it still bounds the distance of
+    // this state, which keeps the learned bounds admissible
+    int next = g + 1 + parentLowerBound;
+    for (const Move &move : moves)
+    {
+        if (move.opposite == prevDir)
+        {
+            continue;
+        }
+
+        const int target = GetTarget(posX, move, N);
+        if (target < 0)
+        {
+            continue;
+        }
+
+        // The child is estimated from this state and the piece that slides
+        const Estimate childEstimate = heuristics_.Update(estimate, state, posX, target);
+
+        path_.push_back(move.dir);
+        const int f = DepthFirst(Slide(state, posX, target), target, g + 1, childEstimate,
+                                 lowerBound, move.dir);
+        if (found_)
+        {
+            return f;
+        }
+        path_.pop_back();
+
+        next = std::min(next, f);
+    }
+
+    // Every way out of this state was proven to exceed the bound
+    const int learned = std::min(next - g, infinity - 1);
+    if (learned > lowerBound)
+    {
+        lowerBounds_.Store(state, learned, bound_ - g, tableCounters_);
+    }
+
+    return next;
+}
+
+void IdaStar::FollowKnownPath(PackedState state, int posX, std::vector<short> &dirs) const
+{
+    for (auto itr = optimalPath_.find(state);
+         (itr != optimalPath_.cend()) && (itr->second.distance > 0);
+         itr = optimalPath_.find(state))
+    {
+        const short dir = itr->second.nextDir;
+        for (const Move &move : moves)
+        {
+            if (move.dir == dir)
+            {
+                const int target = GetTarget(posX, move, N);
+                state = Slide(state, posX, target);
+                posX = target;
+                break;
+            }
+        }
+
+        dirs.push_back(dir);
+    }
+}
+
+void IdaStar::RememberPath(PackedState start, int posX, std::span<const short> dirs)
+{
+    PackedState state = start;
+    for (size_t i = 0; i < dirs.size(); i++)
+    {
+        optimalPath_[state] = {static_cast<std::uint8_t>(dirs.size() - i), dirs[i]};
+
+        for (const Move &move : moves)
+        {
+            if (move.dir == dirs[i])
+            {
+                const int target = GetTarget(posX, move, N);
+                state = Slide(state, posX, target);
+                posX = target;
+                break;
+            }
+        }
+    }
+
+    // The goal itself
+    optimalPath_[state] = {0, noDir};
+}
+} // namespace search
@@ -0,0 +1,256 @@
+#include <algorithm>    // std::find
+#include <array>        // std::array
+#include <charconv>     // std::from_chars
+#include <fstream>      // std::ifstream
+#include <mutex>        // std::lock_guard, std::unique_lock
+#include <string_view>  // std::string_view
+#include <system_error> // std::errc
+#include <vector>       // std::vector
+
+#include "raylib.h" // TraceLog
+
+#include "creator/importerlib.hpp"
+#include "creator/paritylib.hpp" // creator::IsValidLayout, creator::IsSolvable
+
+namespace
+{
+// The fields of ImportStats in the order of the counters
+enum Count : size_t
+{
+    READ = 0,
+    INVALID,
+    UNSOLVABLE,
+    DUPLICATES,
+    QUEUED
+};
+
+/// @brief A layout being read, one element per piece
+using Layout = std::array<int, constants::EIGHT_PUZZLE_NUM>;
+
+// The bits of a packed state that hold the pieces
+constexpr int stateBits = 4 * constants::EIGHT_PUZZLE_NUM;
+
+/// @brief Checks if a character separates the numbers of a text layout
+/// @param c The character
+/// @return TRUE for blanks and commas
+bool IsSeparator(char c) noexcept
+{
+    return (c == ' ') || (c == '\t') || (c == ',') || (c == '\r');
+}
+} // namespace
+
+namespace creator
+{
+bool ParseLine(std::string_view line, std::span<int> layout) noexcept
+{
+    size_t numOfPieces = 0;
+    const char *itr = line.data();
+    const char *end = line.data() + line.size();
+    while (itr != end)
+    {
+        if (IsSeparator(*itr))
+        {
+            itr++;
+            continue;
+        }
+
+        int piece = 0;
+        const auto [next, ec] = std::from_chars(itr, end, piece);
+        if ((ec != std::errc()) || (numOfPieces == layout.size()))
+        {
+            return false;
+        }
+
+        layout[numOfPieces++] = (piece == 0) ? constants::EMPTY : piece;
+        itr = next;
+    }
+
+    return numOfPieces == layout.size();
+}
+
+PuzzleImporter::PuzzleImporter(const std::string &path, size_t capacity)
+    : path_(path),
+      capacity_(capacity),
+      seen_{},
+      solver_(),
+      ready_{},
+      stop_(false),
+      finished_(path.empty()),
+      counts_{}
+{
+    if (!path_.empty())
+    {
+        importer_ = std::thread(&PuzzleImporter::ImportLoop, this);
+    }
+}
+
+PuzzleImporter::~PuzzleImporter()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_.store(true, std::memory_order_relaxed);
+    }
+    cv_.notify_one();
+
+    if (importer_.joinable())
+    {
+        importer_.join();
+    }
+}
+
+std::optional<Puzzle> PuzzleImporter::TryPop()
+{
+    PackedPuzzle packed;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (ready_.empty())
+        {
+            return std::nullopt;
+        }
+
+        packed = ready_.front();
+        ready_.pop_front();
+    }
+    cv_.notify_one();
+
+    return UnpackPuzzle(packed);
+}
+
+ImportStats PuzzleImporter::GetStats() const noexcept
+{
+    return {counts_[READ].load(std::memory_order_relaxed),
+            counts_[INVALID].load(std::memory_order_relaxed),
+            counts_[UNSOLVABLE].load(std::memory_order_relaxed),
+            counts_[DUPLICATES].load(std::memory_order_relaxed),
+            counts_[QUEUED].load(std::memory_order_relaxed)};
+}
+
+void PuzzleImporter::ImportLoop()
+{
+    std::ifstream in(path_, std::ios::binary);
+    if (!in)
+    {
+        TraceLog(LOG_WARNING, "IMPORT: Could not open %s", path_.c_str());
+        finished_.store(true, std::memory_order_release);
+        return;
+    }
+
+    // A binary list announces itself, anything else is read as text from the start
+    std::array<char, listMagic.size()> header{};
+    in.read(header.data(), header.size());
+    if ((in.gcount() == static_cast<std::streamsize>(header.size())) && (header == listMagic))
+    {
+        ReadBinary(in);
+    }
+    else
+    {
+        in.clear();
+        in.seekg(0);
+        ReadText(in);
+    }
+
+    const ImportStats stats = GetStats();
+    TraceLog(LOG_INFO,
+             "IMPORT: Read %llu layouts from %s (%llu invalid, %llu unsolvable, %llu duplicates)",
+             static_cast<unsigned long long>(stats.read), path_.c_str(),
+             static_cast<unsigned long long>(stats.invalid),
+             static_cast<unsigned long long>(stats.unsolvable),
+             static_cast<unsigned long long>(stats.duplicates));
+
+    finished_.store(true, std::memory_order_release);
+}
+
+void PuzzleImporter::ReadText(std::istream &in)
+{
+    std::string line;
+    Layout layout{};
+    while (!stop_.load(std::memory_order_relaxed) && std::getline(in, line))
+    {
+        const size_t first = line.find_first_not_of(" \t\r");
+        if ((first == std::string::npos) || (line[first] == '#'))
+        {
+            continue;
+        }
+
+        counts_[READ].fetch_add(1, std::memory_order_relaxed);
+        if (!ParseLine(line, layout))
+        {
+            counts_[INVALID].fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        if (!Offer(layout))
+        {
+            return;
+        }
+    }
+}
+
+void PuzzleImporter::ReadBinary(std::istream &in)
+{
+    search::PackedState state = 0;
+    Layout layout{};
+    while (!stop_.load(std::memory_order_relaxed) &&
+           in.read(reinterpret_cast<char *>(&state), sizeof(state)))
+    {
+        counts_[READ].fetch_add(1, std::memory_order_relaxed);
+        if ((state >> stateBits) != 0)
+        {
+            counts_[INVALID].fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        search::Unpack(state, layout);
+        if (!Offer(layout))
+        {
+            return;
+        }
+    }
+}
+
+bool PuzzleImporter::Offer(std::span<const int> layout)
+{
+    if (!IsValidLayout(layout))
+    {
+        counts_[INVALID].fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // The parity check is O(n), so the unsolvable half never reaches the solver
+    if (!IsSolvable(layout))
+    {
+        counts_[UNSOLVABLE].fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    if (!seen_.insert(search::Pack(layout)).second)
+    {
+        counts_[DUPLICATES].fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // The optimal length is found here, so the board never solves an imported puzzle itself
+    const auto empty = std::find(layout.begin(), layout.end(), constants::EMPTY);
+    const int posX = static_cast<int>(empty - layout.begin());
+    const std::vector<short> dirs = solver_.Solve(layout, posX);
+    if (dirs.empty())
+    {
+        // The goal itself is nothing to play
+        counts_[INVALID].fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this] { return stop_ || (ready_.size() < capacity_); });
+        if (stop_)
+        {
+            return false;
+        }
+        ready_.push_back(PackPuzzle(layout, dirs));
+    }
+    counts_[QUEUED].fetch_add(1, std::memory_order_relaxed);
+
+    return true;
+}
+} // namespace creator
@@ -0,0 +1,164 @@
+#include <algorithm> // std::max, std::min
+
+#include "raylib.h" // GetTime, GetMousePosition, IsMouseButtonPressed, GetKeyPressed
+
+#include "gui/inputlib.hpp"
+
+namespace
+{
+// Room for the events of a busy frame before the queue has to grow
+constexpr size_t eventCapacity = 16;
+
+/// @brief Gets the modifier keys that are held
+/// @return The InputModifier bits
+unsigned GetModifiers()
+{
+    unsigned modifiers = 0;
+    if (IsKeyDown(KEY_LEFT_CONTROL) || IsKeyDown(KEY_RIGHT_CONTROL))
+    {
+        modifiers |= gui::MODIFIER_CTRL;
+    }
+    if (IsKeyDown(KEY_LEFT_SHIFT) || IsKeyDown(KEY_RIGHT_SHIFT))
+    {
+        modifiers |= gui::MODIFIER_SHIFT;
+    }
+
+    return modifiers;
+}
+} // namespace
+
+namespace gui
+{
+InputQueue::InputQueue()
+    : events_{},
+      mousePos_(GetMousePosition()),
+      isMouseDown_(false),
+      trackedSince_(-1.0),
+      latencyBuckets_{},
+      latencyCount_(0),
+      latencySum_(0.0),
+      latencyMax_(0.0)
+{
+    events_.reserve(eventCapacity);
+}
+
+void InputQueue::Poll()
+{
+    events_.clear();
+
+    // NOTE: raylib polled the OS at the end of the last frame, so the events may be older
+    const double timestamp = GetTime();
+    const unsigned modifiers = GetModifiers();
+
+    const Vector2 pos = GetMousePosition();
+    if ((pos.x != mousePos_.x) || (pos.y != mousePos_.y))
+    {
+        events_.push_back({InputKind::MOUSE_MOVED, 0, pos, modifiers, timestamp});
+    }
+    mousePos_ = pos;
+
+    // A click that is shorter than a frame shows up as both
+    if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT))
+    {
+        events_.push_back({InputKind::MOUSE_PRESSED, 0, pos, modifiers, timestamp});
+    }
+    if (IsMouseButtonReleased(MOUSE_BUTTON_LEFT))
+    {
+        events_.push_back({InputKind::MOUSE_RELEASED, 0, pos, modifiers, timestamp});
+    }
+    isMouseDown_ = IsMouseButtonDown(MOUSE_BUTTON_LEFT);
+
+    for (int key = GetKeyPressed(); key != 0; key = GetKeyPressed())
+    {
+        events_.push_back({InputKind::KEY_PRESSED, key, pos, modifiers, timestamp});
+    }
+}
+
+const InputEvent *InputQueue::Find(InputKind kind) const noexcept
+{
+    for (const InputEvent &event : events_)
+    {
+        if (event.kind == kind)
+        {
+            return &event;
+        }
+    }
+
+    return nullptr;
+}
+
+const InputEvent *InputQueue::FindKey(int key) const noexcept
+{
+    for (const InputEvent &event : events_)
+    {
+        if ((event.kind == InputKind::KEY_PRESSED) && (event.key == key))
+        {
+            return &event;
+        }
+    }
+
+    return nullptr;
+}
+
+void InputQueue::TrackLatency(const InputEvent &event) noexcept
+{
+    // Only the first response of a frame counts, the others are presented with it
+    if (trackedSince_ < 0.0)
+    {
+        trackedSince_ = event.timestamp;
+    }
+}
+
+void InputQueue::OnFramePresented() noexcept
+{
+    if (trackedSince_ < 0.0)
+    {
+        return;
+    }
+
+    const double latency = GetTime() - trackedSince_;
+    trackedSince_ = -1.0;
+
+    const size_t bucket = std::min(static_cast<size_t>(latency * 1000.0), numOfLatencyBuckets - 1);
+    latencyBuckets_[bucket]++;
+    latencyCount_++;
+    latencySum_ += latency;
+    latencyMax_ = std::max(latencyMax_, latency);
+}
+
+LatencySummary InputQueue::GetLatencySummary() const noexcept
+{
+    LatencySummary summary{latencyCount_, 0.0, 0.0, 0.0, latencyMax_ * 1000.0};
+    if (latencyCount_ == 0)
+    {
+        return summary;
+    }
+
+    summary.meanMs = latencySum_ * 1000.0 / static_cast<double>(latencyCount_);
+
+    // Walk the buckets until half and then 95% of the latencies are behind
+    const std::uint64_t p50Rank = (latencyCount_ + 1) / 2;
+    const std::uint64_t p95Rank = (latencyCount_ * 95 + 99) / 100;
+    std::uint64_t seen = 0;
+    for (size_t bucket = 0; bucket < latencyBuckets_.size(); bucket++)
+    {
+        const std::uint64_t before = seen;
+        seen += latencyBuckets_[bucket];
+        if ((before < p50Rank) && (seen >= p50Rank))
+        {
+            summary.p50Ms = static_cast<double>(bucket + 1);
+        }
+        if ((before < p95Rank) && (seen >= p95Rank))
+        {
+            summary.p95Ms = static_cast<double>(bucket + 1);
+            break;
+        }
+    }
+
+    // The last bucket has no upper edge
+    summary.p50Ms = std::min(summary.p50Ms, summary.maxMs);
+    summary.p95Ms = std::min(summary.p95Ms, summary.maxMs);
+
+    return summary;
+}
+} // namespace gui
@@ -0,0 +1,45 @@
+#include "raylib.h" // LoadRenderTexture, BeginTextureMode, DrawTextureRec
+
+#include "gui/layerlib.hpp"
+
+Layer::Layer(int width, int height, Color background)
+    : target_(LoadRenderTexture(width, height)),
+      background_(background),
+      key_(0),
+      valid_(false)
+{
+}
+
+Layer::~Layer() { UnloadRenderTexture(target_); }
+
+void Layer::Resize(int width, int height)
+{
+    UnloadRenderTexture(target_);
+    target_ = LoadRenderTexture(width, height);
+
+    valid_ = false;
+}
+
+void Layer::Begin(std::uint64_t key)
+{
+    BeginTextureMode(target_);
+    ClearBackground(background_);
+
+    key_ = key;
+}
+
+void Layer::End()
+{
+    EndTextureMode();
+
+    valid_ = true;
+}
+
+void Layer::Draw() const
+{
+    // NOTE: render textures are stored upside down (OpenGL convention), so
+    // flip the source rectangle
+    const Rectangle sourceRec = {0, 0, (float)target_.texture.width,
+                                 -(float)target_.texture.height};
+    DrawTextureRec(target_.texture, sourceRec, {0, 0}, WHITE);
+}
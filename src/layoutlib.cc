@@ -0,0 +1,200 @@
+#include <algorithm> // std::max, std::min
+#include <array>     // std::array
+#include <cassert>   // assert
+#include <span>      // std::span
+#include <utility>   // std::to_underlying
+
+#include "gui/buttonlib.hpp" // gui::counterWidth, gui::counterHeight, gui::Button
+#include "gui/layoutlib.hpp"
+
+namespace
+{
+constexpr int counterGap = 10;
+constexpr int rankCounterWidth = 360;
+constexpr int endingBtnPadding = 20;
+constexpr float endingBtnAspectRatio = 1.6f;
+constexpr int settingsBtnHeight = 60;
+constexpr int settingsBtnPadding = 10;
+constexpr int settingsRowGap = 50;
+constexpr int checkboxSize = 40;
+constexpr int checkboxGap = 10;
+constexpr int volumeSliderLen = 140;
+constexpr int volumeSliderHeight = 16;
+constexpr int volumeLabelWidth = 60;
+constexpr int volumeLabelHeight = 24;
+constexpr int volumeLabelOffsetX = 150;
+constexpr int volumeLabelOffsetY = 100;
+constexpr int arenaMargin = 40;
+constexpr int arenaBoardGap = 8;
+constexpr int arenaPiecePadding = 2;
+
+/// @brief Gets the smallest rectangle that contains every rectangle
+/// @param recs The rectangles, at least one
+/// @return The bounding rectangle
+Rectangle GetBounds(std::span<const Rectangle> recs)
+{
+    float left = recs.front().x;
+    float top = recs.front().y;
+    float right = left + recs.front().width;
+    float bottom = top + recs.front().height;
+    for (const Rectangle &rec : recs)
+    {
+        left = std::min(left, rec.x);
+        top = std::min(top, rec.y);
+        right = std::max(right, rec.x + rec.width);
+        bottom = std::max(bottom, rec.y + rec.height);
+    }
+
+    return {left, top, right - left, bottom - top};
+}
+
+/// @brief Registers a button in a hit grid
+/// NOTE: the grid covers the buttons of its screen only, so a cell never holds more than a
+/// couple of them whatever the shape of the window and the registration cannot fail
+/// @param grid The hit grid
+/// @param id The id of the button
+/// @param rec The rectangle of the button
+void RegisterButton(HitGrid &grid, int id, const Rectangle &rec)
+{
+    [[maybe_unused]] const bool isRegistered = grid.Register(id, rec);
+    assert(isRegistered && "the hit grid is too small for the buttons");
+}
+} // namespace
+
+namespace gui
+{
+float GetLayoutScale(int width, int height)
+{
+    return static_cast<float>(std::min(width, height)) / referenceSize;
+}
+
+Layout ComputeLayout(int width, int height, const Atlas &atlas)
+{
+    Layout l{};
+    l.width = width;
+    l.height = height;
+    l.scale = GetLayoutScale(width, height);
+    l.instrTxtY = instrTxtY * l.scale;
+
+    const float s = l.scale;
+    const float screenWidth = static_cast<float>(width);
+    const float screenHeight = static_cast<float>(height);
+    l.centre = {0.5f * screenWidth, 0.5f * screenHeight};
+
+    // The board sits in the centre with the buttons on its right
+    BoardLayout &b = l.board;
+    const float boxWidth = boardWidth * s;
+    const float boxHeight = boardHeight * s;
+    b.box = {(screenWidth - boxWidth) / 2, (screenHeight - boxHeight) / 2, boxWidth, boxHeight};
+    b.borderThickness = borderThickness * s;
+    b.btnTxtPadding = boardBtnTxtPadding * s;
+
+    const size_t N = constants::EIGHT_PUZZLE_SIZE;
+    const float cellWidth = boxWidth / N;
+    const float cellHeight = boxHeight / N;
+    for (size_t i = 0; i < b.cells.size(); i++)
+    {
+        b.cells[i] = {b.box.x + static_cast<float>(i % N) * cellWidth,
+                      b.box.y + static_cast<float>(i / N) * cellHeight, cellWidth, cellHeight};
+    }
+
+    const float btnX = b.box.x + boxWidth + b.borderThickness;
+    const float btnStep = (boardBtnHeight * s) + b.borderThickness;
+    b.undoBtn = {btnX, b.box.y, boardBtnWidth * s, boardBtnHeight * s};
+    b.redoBtn = {btnX, b.undoBtn.y + btnStep, b.undoBtn.width, b.undoBtn.height};
+    b.restartBtn = {btnX, b.redoBtn.y + btnStep, b.undoBtn.width, b.undoBtn.height};
+    b.helpBtn = {btnX, b.restartBtn.y + btnStep, b.undoBtn.width, b.undoBtn.height};
+    b.hintBtn = {btnX, b.helpBtn.y + btnStep, b.undoBtn.width, b.undoBtn.height};
+
+    // On the whole screen a tall window would put all five buttons into one row of cells
+    const std::array<Rectangle, 5> boardBtns{b.undoBtn, b.redoBtn, b.restartBtn, b.helpBtn,
+                                             b.hintBtn};
+    b.hitGrid.Reset(GetBounds(boardBtns));
+    RegisterButton(b.hitGrid, std::to_underlying(Button::Undo), b.undoBtn);
+    RegisterButton(b.hitGrid, std::to_underlying(Button::Redo), b.redoBtn);
+    RegisterButton(b.hitGrid, std::to_underlying(Button::Restart), b.restartBtn);
+    RegisterButton(b.hitGrid, std::to_underlying(Button::Help), b.helpBtn);
+    RegisterButton(b.hitGrid, std::to_underlying(Button::Hint), b.hintBtn);
+
+    b.movesTxt = {b.box.x, b.box.y - atlas.GetSize(Sprite::MovesTxt).y};
+
+    const float counterX = (screenWidth - counterWidth * s) / 2;
+    b.optimalMovesCounter = {counterX, l.centre.y - (counterHeight + counterGap) * s,
+                             counterWidth * s, counterHeight * s};
+    b.userMovesCounter = {counterX, l.centre.y + counterGap * s, counterWidth * s,
+                          counterHeight * s};
+
+    // The ranks need more room than the moves, so their counters are wider
+    const float rankCounterX = (screenWidth - rankCounterWidth * s) / 2;
+    b.rankCounter = {rankCounterX, b.userMovesCounter.y + (counterHeight + counterGap * 2) * s,
+                     rankCounterWidth * s, counterHeight * s};
+    b.timeRankCounter = {rankCounterX, b.rankCounter.y + (counterHeight + counterGap) * s,
+                         rankCounterWidth * s, counterHeight * s};
+
+    // The menu buttons are stacked in the middle
+    MenuLayout &m = l.menu;
+    const float menuBtnX = (screenWidth - menuBtnWidth * s) / 2;
+    float menuBtnY = (screenHeight - menuBtnWidth * s) / 2;
+    for (Rectangle &btn : m.btns)
+    {
+        btn = {menuBtnX, menuBtnY, menuBtnWidth * s, menuBtnHeight * s};
+        menuBtnY += (menuBtnHeight + menuBtnPadding * 2) * s;
+    }
+
+    m.hitGrid.Reset(GetBounds(m.btns));
+    for (size_t i = 0; i < m.btns.size(); i++)
+    {
+        RegisterButton(m.hitGrid, static_cast<int>(i), m.btns[i]);
+    }
+
+    // The settings are anchored to the volume label
+    SettingsLayout &st = l.settings;
+    st.btnTxtPadding = settingsBtnPadding * s;
+    st.volumeLabel = {l.centre.x - volumeLabelOffsetX * s, l.centre.y - volumeLabelOffsetY * s,
+                      volumeLabelWidth * s, volumeLabelHeight * s};
+
+    float anchorY = st.volumeLabel.y + st.volumeLabel.height;
+    st.volumeSliderBar = {st.volumeLabel.x + atlas.GetSize(Sprite::MainVolumeTxt).x,
+                          anchorY + 0.75f * volumeSliderHeight * s, volumeSliderLen * s,
+                          volumeSliderHeight * s};
+
+    anchorY += settingsRowGap * s;
+    st.backgroundCheckbox = {st.volumeLabel.x + atlas.GetSize(Sprite::BackgroundMusicOffTxt).x +
+                                 checkboxGap * s,
+                             anchorY, checkboxSize * s, checkboxSize * s};
+
+    anchorY += settingsRowGap * s;
+    const float exitTxtWidth = atlas.GetSize(Sprite::BackToMenuTxt).x;
+    st.exitBtn = {(screenWidth - exitTxtWidth) / 2, anchorY, exitTxtWidth + 2 * st.btnTxtPadding,
+                  settingsBtnHeight * s};
+
+    // The ending buttons are side by side and sized by the longer text
+    EndingLayout &e = l.ending;
+    const float endingBtnWidth = std::max(atlas.GetSize(Sprite::RestartBtnTxt).x,
+                                          atlas.GetSize(Sprite::NewGameBtnTxt).x) +
+                                 endingBtnPadding * s;
+    const float endingBtnHeight = endingBtnAspectRatio * endingBtnWidth;
+    e.restartBtn = {l.centre.x - endingBtnWidth - endingBtnPadding * s,
+                    (screenHeight - endingBtnHeight) / 2, endingBtnWidth, endingBtnHeight};
+    e.newGameBtn = {l.centre.x + endingBtnPadding * s, e.restartBtn.y, endingBtnWidth,
+                    endingBtnHeight};
+
+    // The arena boards fill a square grid under the instructions
+    ArenaLayout &a = l.arena;
+    const float arenaTop = l.instrTxtY + arenaMargin * s;
+    const float arenaLen = std::max(0.0f, std::min(screenWidth - 2 * arenaMargin * s,
+                                                   screenHeight - arenaTop - arenaMargin * s));
+    const float arenaStep = arenaLen / arenaSize;
+    const float arenaBoardLen = std::max(0.0f, arenaStep - arenaBoardGap * s);
+    const float arenaLeft = (screenWidth - arenaLen) / 2;
+    for (size_t i = 0; i < a.boards.size(); i++)
+    {
+        a.boards[i] = {arenaLeft + static_cast<float>(i % arenaSize) * arenaStep,
+                       arenaTop + static_cast<float>(i / arenaSize) * arenaStep, arenaBoardLen,
+                       arenaBoardLen};
+    }
+    a.piecePadding = arenaPiecePadding * s;
+
+    return l;
+}
+} // namespace gui
@@ -0,0 +1,195 @@
+#include <algorithm> // std::min
+#include <array>     // std::array
+#include <cstring>   // std::memcmp
+#include <utility>   // std::move
+#include <vector>    // std::vector
+
+#include <fcntl.h>    // open, O_RDWR, O_CREAT, O_APPEND
+#include <sys/stat.h> // fstat
+#include <unistd.h>   // read, write, ftruncate, close
+
+#include "fmt/core.h"
+
+#include "stats/leaderboardlib.hpp"
+
+namespace
+{
+// The first bytes of the file, bump the last digit when Entry changes
+constexpr std::array<char, 8> magic{'8', 'P', 'Z', 'L', 'E', 'A', 'D', '1'};
+
+// The largest number of optimal moves of each band
+constexpr unsigned easyMaxMoves = 10;
+constexpr unsigned mediumMaxMoves = 20;
+
+// The number of entries read at a time while loading
+constexpr size_t loadChunkSize = 512;
+
+/// @brief Gets the efficiency of a game as a fixed-point ratio (lower is better)
+/// @param entry The game
+/// @return The user moves over the optimal moves in 16.16 fixed point
+std::uint64_t GetRatio(const stats::Entry &entry) noexcept
+{
+    // An already solved puzzle is as efficient as it gets
+    if (entry.optimalMoves == 0)
+    {
+        return std::uint64_t{1} << 16;
+    }
+
+    return (static_cast<std::uint64_t>(entry.userMoves) << 16) / entry.optimalMoves;
+}
+
+/// @brief Gets the key of a game on the efficiency ranking, ties go to the faster game
+/// @param entry The game
+/// @return The key
+std::uint64_t GetEfficiencyKey(const stats::Entry &entry) noexcept
+{
+    return (GetRatio(entry) << 32) | entry.durationMs;
+}
+
+/// @brief Gets the key of a game on the time ranking, ties go to the more efficient game
+/// @param entry The game
+/// @return The key
+std::uint64_t GetTimeKey(const stats::Entry &entry) noexcept
+{
+    return (static_cast<std::uint64_t>(entry.durationMs) << 32) | GetRatio(entry);
+}
+} // namespace
+
+namespace stats
+{
+Band GetBand(unsigned optimalMoves) noexcept
+{
+    if (optimalMoves <= easyMaxMoves)
+    {
+        return Band::EASY;
+    }
+    else if (optimalMoves <= mediumMaxMoves)
+    {
+        return Band::MEDIUM;
+    }
+
+    return Band::HARD;
+}
+
+Leaderboard::Leaderboard(std::string path)
+    : path_(std::move(path)),
+      fd_(open(path_.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644)),
+      bands_{}
+{
+    if (fd_ < 0)
+    {
+        fmt::print(stderr, "WARNING: LEADERBOARD: Could not open {}, games will not be saved\n",
+                   path_);
+        return;
+    }
+
+    struct stat info;
+    if (fstat(fd_, &info) != 0)
+    {
+        close(fd_);
+        fd_ = -1;
+        return;
+    }
+
+    // A new file starts with the magic
+    if (info.st_size == 0)
+    {
+        if (write(fd_, magic.data(), magic.size()) != static_cast<ssize_t>(magic.size()))
+        {
+            close(fd_);
+            fd_ = -1;
+        }
+        return;
+    }
+
+    // Never append to a file that is not a leaderboard of this version
+    std::array<char, magic.size()> header{};
+    if ((read(fd_, header.data(), header.size()) != static_cast<ssize_t>(header.size())) ||
+        (std::memcmp(header.data(), magic.data(), magic.size()) != 0))
+    {
+        fmt::print(stderr,
+                   "WARNING: LEADERBOARD: {} is not a leaderboard, games will not be saved\n",
+                   path_);
+        close(fd_);
+        fd_ = -1;
+        return;
+    }
+
+    // A torn entry at the end is ignored and overwritten by the next one
+    const size_t numOfEntries = (static_cast<size_t>(info.st_size) - magic.size()) / sizeof(Entry);
+    if (ftruncate(fd_, static_cast<off_t>(magic.size() + numOfEntries * sizeof(Entry))) != 0)
+    {
+        fmt::print(stderr, "WARNING: LEADERBOARD: Could not repair {}\n", path_);
+    }
+
+    std::vector<Entry> chunk(loadChunkSize);
+    size_t numOfRead = 0;
+    while (numOfRead < numOfEntries)
+    {
+        const size_t count = std::min(loadChunkSize, numOfEntries - numOfRead);
+        if (read(fd_, chunk.data(), count * sizeof(Entry)) !=
+            static_cast<ssize_t>(count * sizeof(Entry)))
+        {
+            break;
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            Insert(chunk[i]);
+        }
+        numOfRead += count;
+    }
+}
+
+Leaderboard::~Leaderboard()
+{
+    if (fd_ >= 0)
+    {
+        close(fd_);
+    }
+}
+
+Standing Leaderboard::Submit(const Entry &entry)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    Insert(entry);
+
+    // One small write per game, the kernel takes care of flushing it
+    if ((fd_ >= 0) && (write(fd_, &entry, sizeof(Entry)) != static_cast<ssize_t>(sizeof(Entry))))
+    {
+        fmt::print(stderr, "WARNING: LEADERBOARD: Could not write to {}\n", path_);
+    }
+
+    return FindStanding(entry);
+}
+
+Standing Leaderboard::GetStanding(const Entry &entry) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    return FindStanding(entry);
+}
+
+void Leaderboard::Insert(const Entry &entry)
+{
+    Rankings &rankings = bands_[static_cast<size_t>(GetBand(entry.optimalMoves))];
+    rankings.efficiency.Insert(GetEfficiencyKey(entry));
+    rankings.time.Insert(GetTimeKey(entry));
+}
+
+Standing Leaderboard::FindStanding(const Entry &entry) const noexcept
+{
+    const Band band = GetBand(entry.optimalMoves);
+    const Rankings &rankings = bands_[static_cast<size_t>(band)];
+
+    Standing standing;
+    standing.band = static_cast<std::uint32_t>(band);
+    standing.efficiencyRank =
+        static_cast<std::uint32_t>(rankings.efficiency.CountLess(GetEfficiencyKey(entry)) + 1);
+    standing.timeRank = static_cast<std::uint32_t>(rankings.time.CountLess(GetTimeKey(entry)) + 1);
+    standing.numOfEntries = static_cast<std::uint32_t>(rankings.efficiency.GetSize());
+
+    return standing;
+}
+} // namespace stats
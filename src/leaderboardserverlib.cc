@@ -0,0 +1,257 @@
+#include <cstring> // std::memset, std::strncpy
+#include <utility> // std::move
+
+#include <poll.h>       // poll
+#include <sys/socket.h> // socket, bind, listen, accept, connect, send, setsockopt
+#include <sys/time.h>   // timeval
+#include <sys/un.h>     // sockaddr_un
+#include <unistd.h>     // read, close, unlink
+
+#include "fmt/core.h"
+
+#include "stats/leaderboardserverlib.hpp"
+
+namespace
+{
+// The operations of a request
+constexpr std::uint32_t submitOp = 1;
+constexpr std::uint32_t standingOp = 2;
+
+// The longest time either end waits for the other (in microseconds)
+constexpr int ioTimeoutUs = 200'000;
+
+// How often the acceptor checks if it should stop (in milliseconds)
+constexpr int pollIntervalMs = 100;
+
+// The number of connections that can wait to be accepted
+constexpr int backlog = 16;
+
+/// @brief A request as it is sent over the socket
+struct RequestMessage
+{
+    std::uint32_t op;
+    stats::Entry entry;
+};
+
+/// @brief Fills the address of a socket
+/// @param path The path to the socket
+/// @param addr The address
+/// @return FALSE if the path is too long
+bool MakeAddress(const std::string &path, sockaddr_un &addr) noexcept
+{
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path))
+    {
+        return false;
+    }
+
+    std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+    return true;
+}
+
+/// @brief Stops a socket from blocking for too long
+/// @param fd The file descriptor of the socket
+void SetTimeouts(int fd) noexcept
+{
+    const timeval timeout{0, ioTimeoutUs};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+}
+
+/// @brief Reads a whole message
+/// @param fd The file descriptor of the socket
+/// @param data The buffer
+/// @param size The size of the message in bytes
+/// @return FALSE if the connection fails or times out first
+bool ReadAll(int fd, void *data, size_t size)
+{
+    char *bytes = static_cast<char *>(data);
+    while (size > 0)
+    {
+        const ssize_t received = read(fd, bytes, size);
+        if (received <= 0)
+        {
+            return false;
+        }
+
+        bytes += received;
+        size -= static_cast<size_t>(received);
+    }
+
+    return true;
+}
+
+/// @brief Writes a whole message
+/// @param fd The file descriptor of the socket
+/// @param data The buffer
+/// @param size The size of the message in bytes
+/// @return FALSE if the connection fails or times out first
+bool WriteAll(int fd, const void *data, size_t size)
+{
+    const char *bytes = static_cast<const char *>(data);
+    while (size > 0)
+    {
+        // A kiosk that hangs up must not kill the server with SIGPIPE
+        const ssize_t sent = send(fd, bytes, size, MSG_NOSIGNAL);
+        if (sent <= 0)
+        {
+            return false;
+        }
+
+        bytes += sent;
+        size -= static_cast<size_t>(sent);
+    }
+
+    return true;
+}
+} // namespace
+
+namespace stats
+{
+LeaderboardServer::LeaderboardServer(Leaderboard &leaderboard, std::string socketPath)
+    : leaderboard_(leaderboard),
+      socketPath_(std::move(socketPath)),
+      listenFd_(-1),
+      stop_(false)
+{
+    sockaddr_un addr;
+    if (!MakeAddress(socketPath_, addr))
+    {
+        fmt::print(stderr, "WARNING: LEADERBOARD: Socket path {} is too long\n", socketPath_);
+        return;
+    }
+
+    listenFd_ = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd_ < 0)
+    {
+        return;
+    }
+
+    // A socket left behind by a crashed server would make bind() fail
+    unlink(socketPath_.c_str());
+
+    if ((bind(listenFd_, reinterpret_cast<const sockaddr *>(&addr), sizeof(addr)) != 0) ||
+        (listen(listenFd_, backlog) != 0))
+    {
+        fmt::print(stderr, "WARNING: LEADERBOARD: Could not listen on {}\n", socketPath_);
+        close(listenFd_);
+        listenFd_ = -1;
+        return;
+    }
+
+    acceptor_ = std::thread(&LeaderboardServer::AcceptLoop, this);
+}
+
+LeaderboardServer::~LeaderboardServer()
+{
+    stop_.store(true, std::memory_order_relaxed);
+
+    if (acceptor_.joinable())
+    {
+        acceptor_.join();
+    }
+
+    if (listenFd_ >= 0)
+    {
+        close(listenFd_);
+        unlink(socketPath_.c_str());
+    }
+}
+
+void LeaderboardServer::AcceptLoop()
+{
+    pollfd pfd{listenFd_, POLLIN, 0};
+
+    while (!stop_.load(std::memory_order_relaxed))
+    {
+        // Wake up now and then to check if the server is stopping
+        if (poll(&pfd, 1, pollIntervalMs) <= 0)
+        {
+            continue;
+        }
+
+        const int fd = accept(listenFd_, nullptr, nullptr);
+        if (fd < 0)
+        {
+            continue;
+        }
+
+        // A request is a few bytes and a couple of skiplist walks, so the
+        // connections are simply answered one after the other
+        HandleConnection(fd);
+        close(fd);
+    }
+}
+
+void LeaderboardServer::HandleConnection(int fd)
+{
+    SetTimeouts(fd);
+
+    RequestMessage request;
+    if (!ReadAll(fd, &request, sizeof(request)))
+    {
+        return;
+    }
+
+    Standing standing;
+    if (request.op == submitOp)
+    {
+        standing = leaderboard_.Submit(request.entry);
+    }
+    else if (request.op == standingOp)
+    {
+        standing = leaderboard_.GetStanding(request.entry);
+    }
+    else
+    {
+        return;
+    }
+
+    WriteAll(fd, &standing, sizeof(standing));
+}
+
+LeaderboardClient::LeaderboardClient(std::string socketPath) : socketPath_(std::move(socketPath))
+{
+}
+
+std::optional<Standing> LeaderboardClient::Submit(const Entry &entry) const
+{
+    return Request(submitOp, entry);
+}
+
+std::optional<Standing> LeaderboardClient::GetStanding(const Entry &entry) const
+{
+    return Request(standingOp, entry);
+}
+
+std::optional<Standing> LeaderboardClient::Request(std::uint32_t op, const Entry &entry) const
+{
+    sockaddr_un addr;
+    if (!MakeAddress(socketPath_, addr))
+    {
+        return std::nullopt;
+    }
+
+    const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+    {
+        return std::nullopt;
+    }
+
+    SetTimeouts(fd);
+
+    std::optional<Standing> reply;
+    const RequestMessage request{op, entry};
+    Standing standing;
+    if ((connect(fd, reinterpret_cast<const sockaddr *>(&addr), sizeof(addr)) == 0) &&
+        WriteAll(fd, &request, sizeof(request)) && ReadAll(fd, &standing, sizeof(standing)))
+    {
+        reply = standing;
+    }
+
+    close(fd);
+
+    return reply;
+}
+} // namespace stats
@@ -4,39 +4,22 @@
 #include "raylib.h"
 
 #include "gui/colourlib.hpp"
+#include "gui/hitgridlib.hpp" // gui::noHit
 #include "gui/menulib.hpp"
 
-namespace
-{
-constexpr int btnFontSize = 35;
-constexpr int btnWidth = 250;
-constexpr int btnHeight = 60;
-constexpr float btnY = 350;
-constexpr float btnPadding = 10;
-} // namespace
-
-Menu::Menu()
-    : screenWidth_(GetScreenWidth()),
-      screenHeight_(GetScreenHeight()),
+Menu::Menu(const Atlas &atlas, const gui::Layout &layout, const gui::InputQueue &input)
+    : atlas_(atlas),
+      layout_(layout),
+      input_(input),
       selectedOption_(0),
+      leftClickPressed_(false),
       action_(false)
 {
     // Initialize the colours and the texts
-    btns_[0] = {{TEAL, DARK_GREEN}, "New Game"};
-    btns_[1] = {{CORAL, BURNT_SIENNA}, "Settings"};
-    btns_[2] = {{LIGHT_GOLD, DARK_SEPIACLITERAL}, "Quit"};
-
-    const float btnX = 0.5 * (screenWidth_ - btnWidth);
-    float btnY = 0.5 * (screenWidth_ - btnWidth);
-
-    // Calculate and construct the rectangles
-    for (size_t i = 0; i < btns_.size(); ++i, btnY += (btnHeight + btnPadding * 2))
-    {
-        // Construct a button
-        btns_[i].rec = Rectangle{btnX, btnY, btnWidth, btnHeight};
-
-        btns_[i].txtLen = MeasureText(btns_[i].txt.data(), btnFontSize);
-    }
+    btns_[0] = {{TEAL, DARK_GREEN}, gui::Sprite::MenuNewGameTxt};
+    btns_[1] = {{LAVENDER, DARK_LAVENDER}, gui::Sprite::MenuArenaTxt};
+    btns_[2] = {{CORAL, BURNT_SIENNA}, gui::Sprite::MenuSettingsTxt};
+    btns_[3] = {{LIGHT_GOLD, DARK_SEPIACLITERAL}, gui::Sprite::MenuQuitTxt};
 
     // Load sound effects
     fxMenuMove_ = LoadSound("resources/switch-menu.mp3");
@@ -53,36 +36,26 @@ Menu::~Menu()
 void Menu::Update()
 {
     const unsigned int N = btns_.size();
-    static unsigned int curSelection = selectedOption_;
-    static bool leftClickPressedInState = false;
-    static Vector2 prevMousePos = GetMousePosition();
+    unsigned int curSelection = selectedOption_;
 
-    const Vector2 mousePos = GetMousePosition();
+    const Vector2 mousePos = input_.GetMousePos();
 
     // Detect key actions first then check if the mouse moves to a new position
-    if (IsKeyPressed(KEY_UP))
+    if (input_.WasKeyPressed(KEY_UP))
     {
         curSelection = (selectedOption_ - 1 + N) % N;
     }
-    else if (IsKeyPressed(KEY_DOWN))
+    else if (input_.WasKeyPressed(KEY_DOWN))
     {
         curSelection = (selectedOption_ + 1 + N) % N;
     }
-    else if ((mousePos.x != prevMousePos.x) || (mousePos.y != prevMousePos.y))
+    else if (input_.HasMouseMoved())
     {
         // Check if the cursor is over a button
-        for (size_t i = 0; i < N; i++)
+        if (const int hit = layout_.menu.hitGrid.Query(mousePos); hit != gui::noHit)
         {
-            if (CheckCollisionPointRec(mousePos, btns_[i].rec))
-            {
-                curSelection = i;
-
-                break;
-            }
+            curSelection = hit;
         }
-
-        // Update the mouse position
-        prevMousePos = mousePos;
     }
 
     // Check if another button is selected, if so then play the music
@@ -94,22 +67,21 @@ void Menu::Update()
     }
 
     // Check if the user click a button
-    if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT) &&
-        CheckCollisionPointRec(mousePos, btns_[selectedOption_].rec))
+    const bool isOverSelection = (layout_.menu.hitGrid.Query(mousePos) == selectedOption_);
+    if (input_.WasMousePressed())
     {
-        leftClickPressedInState = true;
+        leftClickPressed_ = isOverSelection;
     }
 
     // Check for user's input
     // (i) the user presses ENTER
     // (ii) the user clicks on the button
-    if (IsKeyPressed(KEY_ENTER) ||
-        (leftClickPressedInState && CheckCollisionPointRec(mousePos, btns_[selectedOption_].rec) &&
-         IsMouseButtonReleased(MOUSE_BUTTON_LEFT)))
+    if (input_.WasKeyPressed(KEY_ENTER) ||
+        (leftClickPressed_ && isOverSelection && input_.WasMouseReleased()))
     {
         PlaySound(fxMenuSelect_);
 
-        leftClickPressedInState = false;
+        leftClickPressed_ = false;
         action_ = true;
     }
 }
@@ -118,21 +90,20 @@ void Menu::Draw() const
 {
     const unsigned int N = btns_.size();
 
-    const float btnX = 0.5 * (screenWidth_ - btnWidth);
-    float btnY = 0.5 * (screenWidth_ - btnWidth);
-
     // Draw each option and its button
-    for (size_t i = 0; i < N; ++i, btnY += (btnHeight + btnPadding * 2))
+    for (size_t i = 0; i < N; ++i)
     {
+        const Rectangle &rec = layout_.menu.btns[i];
+        const Vector2 txtSize = atlas_.GetSize(btns_[i].txt);
+
         // Pick the colour depends on if the button is selcted or not
         Color btnColour = (i == selectedOption_) ? btns_[i].colours.first : btns_[i].colours.second;
 
         // Draw the button and the text
-        DrawRectangle(btns_[i].rec.x, btns_[i].rec.y, btns_[i].rec.width, btns_[i].rec.height,
-                      btnColour);
-        DrawText(TextFormat(btns_[i].txt.data()),
-                 0.5 * (screenWidth_ - btns_[i].txtLen) - btnPadding, btnY + btnPadding,
-                 btnFontSize, WHITE);
+        DrawRectangleRec(rec, btnColour);
+        atlas_.Draw(btns_[i].txt,
+                    {rec.x + (rec.width - txtSize.x) / 2, rec.y + (rec.height - txtSize.y) / 2},
+                    WHITE);
     }
 }
 
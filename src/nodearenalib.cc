@@ -0,0 +1,90 @@
+#include <cstdint> // std::int8_t, std::uint16_t, UINT16_MAX
+#include <span>    // std::span
+
+#include "search/nodearenalib.hpp"
+
+namespace
+{
+constexpr std::int8_t noDir = -1;
+} // namespace
+
+namespace search
+{
+NodeArena::NodeArena(size_t capacity)
+{
+    nodes_.reserve(capacity);
+}
+
+NodeIndex NodeArena::AddRoot(std::span<const int> layout)
+{
+    std::int8_t posX = 0;
+    while (layout[static_cast<size_t>(posX)] != constants::EMPTY)
+    {
+        posX++;
+    }
+
+    nodes_.push_back({Pack(layout), noNode, noNode, noNode, 0, posX, noDir});
+
+    return static_cast<NodeIndex>(nodes_.size() - 1);
+}
+
+NodeIndex NodeArena::AddChild(NodeIndex parent, short dir)
+{
+    // A move that was made before leads to the same child, which moves to the front
+    NodeIndex prev = noNode;
+    for (NodeIndex child = nodes_[parent].firstChild; child != noNode;
+         child = nodes_[child].nextSibling)
+    {
+        if (nodes_[child].dir == dir)
+        {
+            if (prev != noNode)
+            {
+                nodes_[prev].nextSibling = nodes_[child].nextSibling;
+                nodes_[child].nextSibling = nodes_[parent].firstChild;
+                nodes_[parent].firstChild = child;
+            }
+            return child;
+        }
+        prev = child;
+    }
+
+    // Copied because the push below may move the nodes
+    const ArenaNode node = nodes_[parent];
+    if (node.depth == UINT16_MAX)
+    {
+        return noNode;
+    }
+
+    for (const Move &move : moves)
+    {
+        if (move.dir != dir)
+        {
+            continue;
+        }
+
+        const int target = GetTarget(node.posX, move, N);
+        if (target < 0)
+        {
+            return noNode;
+        }
+
+        const NodeIndex child = static_cast<NodeIndex>(nodes_.size());
+        nodes_.push_back({Slide(node.state, node.posX, target), parent, noNode, node.firstChild,
+                          static_cast<std::uint16_t>(node.depth + 1),
+                          static_cast<std::int8_t>(target), static_cast<std::int8_t>(dir)});
+        nodes_[parent].firstChild = child;
+
+        return child;
+    }
+
+    return noNode;
+}
+
+Layout NodeArena::GetLayout(NodeIndex index) const noexcept
+{
+    Layout layout;
+    Unpack(nodes_[index].state, layout);
+
+    return layout;
+}
+} // namespace search
@@ -0,0 +1,301 @@
+#include <algorithm> // std::fill, std::min
+#include <memory>    // std::make_unique
+#include <numeric>   // std::accumulate
+#include <utility>   // std::move
+#include <vector>    // std::vector
+
+#include "search/packedstatelib.hpp" // search::Pack, search::Slide, search::moves
+#include "search/parallelidastarlib.hpp"
+
+namespace
+{
+constexpr int infinity = 1'000;
+constexpr short noDir = -1;
+
+// Split the root until every worker has this many tasks to start with
+constexpr size_t tasksPerWorker = 16;
+
+// Never split deeper than this, the tasks would only get smaller
+constexpr int maxSplitDepth = 10;
+
+// The memory of the table of the lower bounds (a million entries)
+constexpr size_t tableMemory = size_t{8} << 20;
+
+// The strongest of the heuristics, the workers spend little time per node anyway
+constexpr search::HeuristicKind heuristic = search::HeuristicKind::WALKING_DISTANCE;
+} // namespace
+
+namespace search
+{
+ParallelIdaStar::ParallelIdaStar(ThreadPool &pool)
+    : pool_(pool),
+      heuristics_(heuristic),
+      lowerBounds_(tableMemory),
+      bound_(0),
+      nextBound_(infinity),
+      found_(false),
+      expandedNodes_(pool.GetNumOfThreads(), 0),
+      tableCounters_(pool.GetNumOfThreads(), TableCounters{})
+{
+    for (unsigned i = 0; i < pool_.GetNumOfThreads(); i++)
+    {
+        deques_.push_back(std::make_unique<TaskDeque>());
+    }
+}
+
+ParallelIdaStar::~ParallelIdaStar()
+{
+}
+
+std::vector<short> ParallelIdaStar::Solve(std::span<const int> layout, int posX)
+{
+    const PackedState start = Pack(layout);
+    const Estimate estimate = heuristics_.Evaluate(start);
+
+    std::fill(expandedNodes_.begin(), expandedNodes_.end(), 0);
+    lowerBounds_.NewSearch();
+    found_.store(false, std::memory_order_relaxed);
+    solution_.clear();
+
+    if (estimate.value == 0)
+    {
+        return {};
+    }
+
+    // Deepen the bound until a solution shows up
+    for (bound_ = estimate.value; bound_ < infinity;
+         bound_ = nextBound_.load(std::memory_order_relaxed))
+    {
+        nextBound_.store(infinity, std::memory_order_relaxed);
+
+        SplitRoot(start, posX, estimate);
+        if (!found_.load(std::memory_order_relaxed))
+        {
+            pool_.ParallelFor(deques_.size(), 1,
+                              [this](size_t begin, size_t end)
+                              {
+                                  for (size_t worker = begin; worker < end; worker++)
+                                  {
+                                      RunWorker(worker);
+                                  }
+                              });
+        }
+
+        if (found_.load(std::memory_order_relaxed))
+        {
+            break;
+        }
+    }
+
+    return solution_;
+}
+
+std::uint64_t ParallelIdaStar::GetExpandedNodes() const noexcept
+{
+    return std::accumulate(expandedNodes_.cbegin(), expandedNodes_.cend(), std::uint64_t{0});
+}
+
+TableCounters ParallelIdaStar::GetTableCounters() const noexcept
+{
+    TableCounters sum{};
+    for (const TableCounters &counters : tableCounters_)
+    {
+        sum += counters;
+    }
+
+    return sum;
+}
+
+void ParallelIdaStar::SplitRoot(PackedState start, int posX, const Estimate &estimate)
+{
+    for (std::unique_ptr<TaskDeque> &deque : deques_)
+    {
+        deque->tasks.clear();
+    }
+
+    // Expand whole levels until there are enough subtrees to go around
+    std::vector<Task> level{{start, posX, estimate, infinity, noDir, {}}};
+    std::vector<Task> next;
+    const size_t numOfTasks = tasksPerWorker * deques_.size();
+    for (int depth = 0; (depth < maxSplitDepth) && !level.empty() && (level.size() < numOfTasks);
+         depth++)
+    {
+        next.clear();
+        for (const Task &task : level)
+        {
+            expandedNodes_[0]++;
+
+            const int g = static_cast<int>(task.path.size()) + 1;
+            for (const Move &move : moves)
+            {
+                const int target = GetTarget(task.posX, move, N);
+                if ((move.opposite == task.prevDir) || (target < 0))
+                {
+                    continue;
+                }
+
+                const Estimate childEstimate =
+                    heuristics_.Update(task.estimate, task.state, task.posX, target);
+                if (g + childEstimate.value > bound_)
+                {
+                    LowerNextBound(g + childEstimate.value);
+                    continue;
+                }
+
+                Task child{Slide(task.state, task.posX, target), target, childEstimate,
+                           task.estimate.value, move.dir, task.path};
+                child.path.push_back(move.dir);
+
+                // The levels are expanded in order, so a solution this shallow is optimal
+                if (childEstimate.value == 0)
+                {
+                    found_.store(true, std::memory_order_relaxed);
+                    solution_ = std::move(child.path);
+                    return;
+                }
+
+                next.push_back(std::move(child));
+            }
+        }
+
+        level.swap(next);
+    }
+
+    // Deal the subtrees out like cards, so every worker gets some of each region
+    for (size_t i = 0; i < level.size(); i++)
+    {
+        deques_[i % deques_.size()]->tasks.push_back(std::move(level[i]));
+    }
+}
+
+void ParallelIdaStar::RunWorker(size_t worker)
+{
+    WorkerState state{0, infinity, {}};
+
+    Task task;
+    while (!found_.load(std::memory_order_relaxed) && TakeTask(worker, task))
+    {
+        DepthFirst(task.state, task.posX, task.estimate, task.parentLowerBound, task.prevDir,
+                   task.path, state);
+    }
+
+    // Written once at the end so the workers do not share a cache line while searching
+    expandedNodes_[worker] += state.expanded;
+    tableCounters_[worker] += state.table;
+    LowerNextBound(state.nextBound);
+}
+
+bool ParallelIdaStar::TakeTask(size_t worker, Task &task)
+{
+    {
+        TaskDeque &own = *deques_[worker];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty())
+        {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+
+    // Steal the oldest task of the next worker that still has some
+    for (size_t i = 1; i < deques_.size(); i++)
+    {
+        TaskDeque &victim = *deques_[(worker + i) % deques_.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty())
+        {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+int ParallelIdaStar::DepthFirst(PackedState state, int posX, const Estimate &estimate,
+                                int parentLowerBound, short prevDir, std::vector<short> &path,
+                                WorkerState &worker)
+{
+    ++worker.expanded;
+
+    const int g = static_cast<int>(path.size());
+    if (estimate.value == 0)
+    {
+        // Only the first worker to get here writes the solution
+        bool expected = false;
+        if (found_.compare_exchange_strong(expected, true, std::memory_order_relaxed))
+        {
+            std::lock_guard<std::mutex> lock(solutionMutex_);
+            solution_ = path;
+        }
+        return g;
+    }
+
+    // Another worker may have proven a tighter bound through a different path
+    const int lowerBound = std::max(estimate.value, lowerBounds_.Probe(state, worker.table));
+    if (g + lowerBound > bound_)
+    {
+        worker.nextBound = std::min(worker.nextBound, g + lowerBound);
+        return g + lowerBound;
+    }
+
+    // NOTE: going back is never expanded but it still bounds the distance of
+    // this state, which keeps the learned bounds admissible
+    int next = g + 1 + parentLowerBound;
+    for (const Move &move : moves)
+    {
+        const int target = GetTarget(posX, move, N);
+        if ((move.opposite == prevDir) || (target < 0))
+        {
+            continue;
+        }
+
+        // Another worker already finished the iteration
+        if (found_.load(std::memory_order_relaxed))
+        {
+            return next;
+        }
+
+        // The child is estimated from this state and the piece that slides
+        const Estimate childEstimate = heuristics_.Update(estimate, state, posX, target);
+        if (g + 1 + childEstimate.value > bound_)
+        {
+            next = std::min(next, g + 1 + childEstimate.value);
+            worker.nextBound = std::min(worker.nextBound, g + 1 + childEstimate.value);
+            continue;
+        }
+
+        path.push_back(move.dir);
+        const int f = DepthFirst(Slide(state, posX, target), target, childEstimate, lowerBound,
+                                 move.dir, path, worker);
+        path.pop_back();
+
+        next = std::min(next, f);
+    }
+
+    // A subtree cut short by a solution elsewhere proved nothing
+    if (found_.load(std::memory_order_relaxed))
+    {
+        return next;
+    }
+
+    // Every way out of this state was proven to exceed the bound
+    const int learned = std::min(next - g, infinity - 1);
+    if (learned > lowerBound)
+    {
+        lowerBounds_.Store(state, learned, bound_ - g, worker.table);
+    }
+
+    return next;
+}
+
+void ParallelIdaStar::LowerNextBound(int f) noexcept
+{
+    int cur = nextBound_.load(std::memory_order_relaxed);
+    while ((f < cur) && !nextBound_.compare_exchange_weak(cur, f, std::memory_order_relaxed))
+    {
+    }
+}
+} // namespace search
@@ -0,0 +1,139 @@
+#include <bitset> // std::bitset
+
+#include "creator/paritylib.hpp"
+
+namespace
+{
+/// @brief Gets the goal position of a piece
+/// @param piece The piece
+/// @param empty The value of the empty piece
+/// @param numOfPieces The number of pieces
+/// @return The position the piece belongs in, the last one for the empty piece
+size_t GetGoal(int piece, int empty, size_t numOfPieces) noexcept
+{
+    return (piece == empty) ? numOfPieces - 1 : static_cast<size_t>(piece - 1);
+}
+
+/// @brief Checks if the distance of the empty piece to its goal, the last corner, is odd
+/// @param posX The position of the empty piece
+/// @param side The number of pieces in each row and column
+/// @return TRUE if it takes an odd number of moves to get there
+bool IsOddDistance(size_t posX, size_t side) noexcept
+{
+    return ((((side - 1) - posX / side) + ((side - 1) - posX % side)) % 2) == 1;
+}
+} // namespace
+
+namespace creator
+{
+size_t GetSide(size_t numOfPieces) noexcept
+{
+    if (numOfPieces > maxNumOfPieces)
+    {
+        return 0;
+    }
+
+    size_t side = 2;
+    while (side * side < numOfPieces)
+    {
+        side++;
+    }
+
+    return (side * side == numOfPieces) ? side : 0;
+}
+
+bool IsValidLayout(std::span<const int> layout, int empty) noexcept
+{
+    const size_t numOfPieces = layout.size();
+    const int lastPiece = static_cast<int>(numOfPieces) - 1;
+    if ((GetSide(numOfPieces) == 0) || ((empty >= 1) && (empty <= lastPiece)))
+    {
+        return false;
+    }
+
+    std::bitset<maxNumOfPieces> seen;
+    for (const int piece : layout)
+    {
+        if ((piece != empty) && ((piece < 1) || (piece > lastPiece)))
+        {
+            return false;
+        }
+
+        const size_t goal = GetGoal(piece, empty, numOfPieces);
+        if (seen.test(goal))
+        {
+            return false;
+        }
+        seen.set(goal);
+    }
+
+    return true;
+}
+
+bool IsOddPermutation(std::span<const int> layout, int empty) noexcept
+{
+    const size_t numOfPieces = layout.size();
+
+    std::bitset<maxNumOfPieces> visited;
+    size_t cycles = 0;
+    for (size_t start = 0; start < numOfPieces; start++)
+    {
+        if (visited.test(start))
+        {
+            continue;
+        }
+
+        // Follow each piece to the position it belongs in until the cycle closes
+        for (size_t pos = start; !visited.test(pos); pos = GetGoal(layout[pos], empty, numOfPieces))
+        {
+            visited.set(pos);
+        }
+        cycles++;
+    }
+
+    return ((numOfPieces - cycles) % 2) == 1;
+}
+
+bool IsSolvable(std::span<const int> layout, int empty) noexcept
+{
+    return ParityTracker(layout, empty).IsSolvable();
+}
+
+ParityTracker::ParityTracker(std::span<const int> layout, int empty) noexcept
+    : side_(GetSide(layout.size())), posX_(0), odd_(IsOddPermutation(layout, empty))
+{
+    while ((posX_ < layout.size()) && (layout[posX_] != empty))
+    {
+        posX_++;
+    }
+}
+
+void ParityTracker::Swap(size_t posA, size_t posB) noexcept
+{
+    if (posA == posB)
+    {
+        return;
+    }
+
+    odd_ = !odd_;
+    if (posX_ == posA)
+    {
+        posX_ = posB;
+    }
+    else if (posX_ == posB)
+    {
+        posX_ = posA;
+    }
+}
+
+bool ParityTracker::IsSolvable() const noexcept
+{
+    // A layout that is not square or has no empty piece never reaches the goal
+    if ((side_ == 0) || (posX_ >= side_ * side_))
+    {
+        return false;
+    }
+
+    return odd_ == IsOddDistance(posX_, side_);
+}
+} // namespace creator
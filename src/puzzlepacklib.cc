@@ -0,0 +1,250 @@
+#include <algorithm> // std::all_of, std::find, std::min, std::max
+#include <chrono>    // std::chrono::system_clock, std::chrono::days
+#include <cstddef>   // std::byte
+#include <cstring>   // std::memcpy
+
+#include <fcntl.h>    // open, O_RDONLY, O_WRONLY, O_CREAT, O_TRUNC
+#include <sys/mman.h> // mmap, munmap
+#include <sys/stat.h> // fstat
+#include <unistd.h>   // write, fsync, close, rename
+
+#include "raylib.h" // TraceLog
+
+#include "creator/puzzlepacklib.hpp"
+
+namespace
+{
+// The first bytes of a pack, bump the last digit when the format changes
+constexpr std::array<char, 8> magic{'8', 'P', 'Z', 'P', 'A', 'C', 'K', '1'};
+
+// The number of pieces of a packed puzzle
+constexpr int numOfPieces = constants::EIGHT_PUZZLE_NUM;
+
+// The parameters of the 64-bit FNV-1a hash
+constexpr std::uint64_t fnvOffset = 0xCBF29CE484222325ULL;
+constexpr std::uint64_t fnvPrime = 0x100000001B3ULL;
+
+/// @brief Hashes the puzzles of a pack
+/// @param puzzles The puzzles
+/// @return The FNV-1a hash of their bytes
+std::uint64_t GetChecksum(std::span<const creator::PackedPuzzle> puzzles) noexcept
+{
+    std::uint64_t hash = fnvOffset;
+    for (const std::byte b : std::as_bytes(puzzles))
+    {
+        hash = (hash ^ static_cast<std::uint64_t>(b)) * fnvPrime;
+    }
+
+    return hash;
+}
+
+/// @brief Writes a whole buffer and retries the short writes
+/// @param fd The file descriptor
+/// @param data The buffer
+/// @param size The size of the buffer in bytes
+/// @return FALSE if the write fails
+bool WriteAll(int fd, const void *data, size_t size)
+{
+    const char *bytes = static_cast<const char *>(data);
+    while (size > 0)
+    {
+        const ssize_t written = write(fd, bytes, size);
+        if (written < 0)
+        {
+            return false;
+        }
+
+        bytes += written;
+        size -= static_cast<size_t>(written);
+    }
+
+    return true;
+}
+} // namespace
+
+namespace creator
+{
+std::int64_t GetToday()
+{
+    const auto now = std::chrono::system_clock::now();
+
+    return std::chrono::floor<std::chrono::days>(now).time_since_epoch().count();
+}
+
+PackedPuzzle PackPuzzle(std::span<const int> layout, std::span<const short> dirs)
+{
+    PackedPuzzle packed{};
+    packed.startState = search::Pack(layout);
+    packed.optimalMoves = static_cast<std::uint8_t>(dirs.size());
+    packed.posX = static_cast<std::uint8_t>(
+        std::find(layout.begin(), layout.end(), constants::EMPTY) - layout.begin());
+
+    for (size_t i = 0; i < dirs.size(); i++)
+    {
+        std::uint64_t code = 0;
+        while (search::moves[code].dir != dirs[i])
+        {
+            code++;
+        }
+        packed.solution |= code << (2 * i);
+    }
+
+    return packed;
+}
+
+bool IsValidPuzzle(const PackedPuzzle &packed) noexcept
+{
+    if ((packed.optimalMoves > maxPackedMoves) || (packed.posX >= numOfPieces) ||
+        (search::GetPiece(packed.startState, packed.posX) != 0))
+    {
+        return false;
+    }
+
+    // Every piece shows up exactly once
+    unsigned seen = 0;
+    for (int pos = 0; pos < numOfPieces; pos++)
+    {
+        seen |= 1U << search::GetPiece(packed.startState, pos);
+    }
+
+    return seen == (1U << numOfPieces) - 1;
+}
+
+Puzzle UnpackPuzzle(const PackedPuzzle &packed)
+{
+    Puzzle puzzle;
+
+    puzzle.layout.resize(numOfPieces);
+    search::Unpack(packed.startState, puzzle.layout);
+
+    // A corrupted count never reads past the moves that fit into the solution
+    puzzle.dirs.resize(std::min<size_t>(packed.optimalMoves, maxPackedMoves));
+    for (size_t i = 0; i < puzzle.dirs.size(); i++)
+    {
+        puzzle.dirs[i] = search::moves[(packed.solution >> (2 * i)) & 3].dir;
+    }
+
+    return puzzle;
+}
+
+bool WritePack(const std::string &path, std::span<const PackedPuzzle> puzzles,
+               std::int64_t firstDay)
+{
+    PackHeader header{};
+    header.magic = magic;
+    header.numOfPuzzles = static_cast<std::uint32_t>(puzzles.size());
+    header.minMoves = maxPackedMoves;
+    header.firstDay = firstDay;
+    header.checksum = GetChecksum(puzzles);
+    for (const PackedPuzzle &puzzle : puzzles)
+    {
+        header.minMoves = std::min(header.minMoves, puzzle.optimalMoves);
+        header.maxMoves = std::max(header.maxMoves, puzzle.optimalMoves);
+    }
+
+    // Write next to the old pack and swap it in, so a running kiosk never maps half a file
+    const std::string tmpPath = path + ".tmp";
+    const int fd = open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    const bool ok = WriteAll(fd, &header, sizeof(header)) &&
+                    WriteAll(fd, puzzles.data(), puzzles.size_bytes()) && (fsync(fd) == 0);
+    close(fd);
+
+    return ok && (rename(tmpPath.c_str(), path.c_str()) == 0);
+}
+
+PuzzlePack::PuzzlePack(const std::string &path) : mapping_(nullptr), mappingSize_(0), header_{}
+{
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        TraceLog(LOG_INFO, "PACK: No puzzle pack at %s, puzzles are generated", path.c_str());
+        return;
+    }
+
+    struct stat info;
+    if ((fstat(fd, &info) != 0) || (static_cast<size_t>(info.st_size) < sizeof(PackHeader)))
+    {
+        TraceLog(LOG_WARNING, "PACK: %s is too small to be a puzzle pack", path.c_str());
+        close(fd);
+        return;
+    }
+
+    mappingSize_ = static_cast<size_t>(info.st_size);
+    mapping_ = mmap(nullptr, mappingSize_, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // The mapping stays valid after the descriptor is closed
+    close(fd);
+
+    if (mapping_ == MAP_FAILED)
+    {
+        TraceLog(LOG_WARNING, "PACK: Could not map %s", path.c_str());
+        mapping_ = nullptr;
+        mappingSize_ = 0;
+        return;
+    }
+
+    std::memcpy(&header_, mapping_, sizeof(header_));
+
+    const size_t expectedSize = sizeof(PackHeader) + header_.numOfPuzzles * sizeof(PackedPuzzle);
+    if ((header_.magic != magic) || (expectedSize != mappingSize_) || (header_.numOfPuzzles == 0))
+    {
+        TraceLog(LOG_WARNING, "PACK: %s is not a valid puzzle pack", path.c_str());
+        return;
+    }
+
+    // The records follow the 32-byte header, so they are aligned within the page
+    const std::span<const PackedPuzzle> puzzles(
+        reinterpret_cast<const PackedPuzzle *>(static_cast<const char *>(mapping_) +
+                                               sizeof(PackHeader)),
+        header_.numOfPuzzles);
+    if (GetChecksum(puzzles) != header_.checksum)
+    {
+        TraceLog(LOG_WARNING, "PACK: The checksum of %s does not match", path.c_str());
+        return;
+    }
+
+    // A bad record would hand the board a layout or a solution that does not exist
+    if (!std::all_of(puzzles.begin(), puzzles.end(), IsValidPuzzle))
+    {
+        TraceLog(LOG_WARNING, "PACK: %s has a puzzle that is not valid", path.c_str());
+        return;
+    }
+
+    puzzles_ = puzzles;
+
+    TraceLog(LOG_INFO, "PACK: Loaded %zu puzzles (%u to %u moves) from %s", puzzles_.size(),
+             header_.minMoves, header_.maxMoves, path.c_str());
+}
+
+PuzzlePack::~PuzzlePack()
+{
+    if (mapping_ != nullptr)
+    {
+        munmap(mapping_, mappingSize_);
+    }
+}
+
+size_t PuzzlePack::GetDailyIndex(std::int64_t day) const noexcept
+{
+    if (puzzles_.empty())
+    {
+        return 0;
+    }
+
+    // Days before the first one wrap around as well
+    const std::int64_t size = static_cast<std::int64_t>(puzzles_.size());
+    const std::int64_t offset = (day - header_.firstDay) % size;
+
+    return static_cast<size_t>((offset < 0) ? offset + size : offset);
+}
+
+Puzzle PuzzlePack::Get(size_t index) const
+{
+    return UnpackPuzzle(puzzles_[index % puzzles_.size()]);
+}
+} // namespace creator
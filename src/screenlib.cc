@@ -1,380 +1,210 @@
-#include <memory> // std::make_unique
+#include <memory>  // std::make_unique
+#include <thread>  // std::thread::hardware_concurrency
+#include <utility> // std::move
 
-#include "fmt/core.h"
 #include "raylib.h"
 
-#include "gui/animationlib.hpp"
-#include "gui/buttonlib.hpp"
-#include "gui/colourlib.hpp"
-#include "gui/menulib.hpp" // Menu
+#include "gui/atlaslib.hpp"
+#include "gui/gamescreenslib.hpp" // ScreenContext, gui::CreateLogoScreen, etc.
+#include "gui/layoutlib.hpp"      // gui::ComputeLayout, gui::GetLayoutScale
 #include "gui/screenlib.hpp"
-#include "gui/settingslib.hpp"
 
 namespace
 {
-constexpr int buttonFontSize = 40;
-constexpr int buttonPadding = 20;
-constexpr std::string_view greetingTitle{"Welcome to 8 Puzzle"};
-constexpr std::string_view pepTalkTxt{"U can do it next time!"};
-constexpr std::string_view celebrationInstrTxt{"Press ENTER or CLICK to skip"};
-constexpr std::string_view titleInstrTxt{"Press ENTER to start"};
-constexpr std::string_view menuInstrTxt{"Press ARROW UP or ARROW DOWN to select"};
-constexpr std::string_view settingsInstrTxt{"Click and change the settings"};
-constexpr std::string_view endingInstrTxt{"Select RESTART or NEW GAME"};
-constexpr std::string_view sadInstrTxt{"Press ENTER to skip"};
-constexpr std::string_view restartTxt{"RESTART"};
-constexpr std::string_view newGameTxt{"NEW GAME"};
-} // namespace
+constexpr size_t solutionCacheCapacity = 1024;
+constexpr const char *statsLogPath = "stats.bin";
+constexpr const char *puzzlePackPath = "resources/puzzles.pack";
 
-ScreenManager::ScreenManager()
-    : curState_(GameScreenState::LOGO),
-      screenWidth_(GetScreenWidth()),
-      screenHeight_(GetScreenHeight()),
-      raylibAnimationPtr_(std::make_unique<RaylibAnimation>()),
-      menuPtr_(std::make_unique<Menu>()),
-      settingsPtr_(std::make_unique<Settings>()),
-      boardPtr_(std::make_unique<Board>()),
-      celebrationPtr_(std::make_unique<Celebration>()),
-      close_(false)
-{
-    restartTxtWidth_ = MeasureText(restartTxt.data(), buttonFontSize);
-    newGameTxtWidth_ = MeasureText(newGameTxt.data(), buttonFontSize);
-
-    const float buttonWidth = std::max(restartTxtWidth_, newGameTxtWidth_) + buttonPadding;
-
-    const float buttonHeight = 1.6 * buttonWidth;
-
-    restartBox_ = {screenWidth_ / 2 - buttonWidth - buttonPadding,
-                   0.5f * (screenHeight_ - buttonHeight), buttonWidth, buttonHeight};
-    newGameBox_ = {0.5f * screenWidth_ + buttonPadding, restartBox_.y, buttonWidth, buttonHeight};
-}
-
-ScreenManager::~ScreenManager()
+/// @brief Gets the number of workers that leaves one core for the main thread
+/// @return The number of workers
+unsigned GetNumOfWorkers()
 {
+    const unsigned numOfCores = std::thread::hardware_concurrency();
+    return (numOfCores > 1) ? (numOfCores - 1) : 0;
 }
+} // namespace
 
-void ScreenManager::Update()
+ScreenManager::ScreenManager(std::uint64_t seed, search::Algorithm algorithm,
+                             const std::string &importPath)
+    : atlasPtr_(std::make_unique<Atlas>(gui::GetLayoutScale(GetScreenWidth(), GetScreenHeight()))),
+      layout_(gui::ComputeLayout(GetScreenWidth(), GetScreenHeight(), *atlasPtr_)),
+      solutionCachePtr_(std::make_unique<search::SolutionCache>(solutionCacheCapacity)),
+      threadPoolPtr_(std::make_unique<ThreadPool>(GetNumOfWorkers())),
+      randomServicePtr_(std::make_unique<RandomService>(seed)),
+      statsLogPtr_(std::make_unique<stats::StatsLog>(statsLogPath)),
+      puzzlePackPtr_(std::make_unique<creator::PuzzlePack>(puzzlePackPath)),
+      puzzleImporterPtr_(std::make_unique<creator::PuzzleImporter>(importPath)),
+      inputPtr_(std::make_unique<gui::InputQueue>()),
+      contextPtr_(std::make_unique<ScreenContext>(*atlasPtr_, layout_, *solutionCachePtr_,
+                                                  *threadPoolPtr_, *statsLogPtr_,
+                                                  *randomServicePtr_, *puzzlePackPtr_,
+                                                  *puzzleImporterPtr_, *inputPtr_, algorithm)),
+      // NOTE: in the same order as GameScreenState
+      slots_{{
+          {nullptr, gui::CreateLogoScreen, ConstructionPolicy::EAGER, nullptr},
+          {nullptr, gui::CreateTitleScreen, ConstructionPolicy::EAGER, nullptr},
+          {nullptr, gui::CreateMenuScreen, ConstructionPolicy::EAGER, nullptr},
+          {nullptr, gui::CreateSettingsScreen, ConstructionPolicy::BACKGROUND, nullptr},
+          {nullptr, gui::CreateGameplayScreen, ConstructionPolicy::BACKGROUND,
+           gui::PrepareGameplayScreen},
+          {nullptr, gui::CreateHelpScreen, ConstructionPolicy::LAZY, nullptr},
+          {nullptr, gui::CreateSadScreen, ConstructionPolicy::LAZY, nullptr},
+          {nullptr, gui::CreateCelebrationScreen, ConstructionPolicy::BACKGROUND, nullptr},
+          {nullptr, gui::CreateEndingScreen, ConstructionPolicy::LAZY, nullptr},
+          {nullptr, gui::CreateArenaScreen, ConstructionPolicy::LAZY, nullptr},
+      }},
+      transitionHooks_{},
+      curState_(GameScreenState::LOGO)
 {
-    switch (curState_)
-    {
-    case GameScreenState::LOGO:
+    for (ScreenSlot &slot : slots_)
     {
-        raylibAnimationPtr_->Update();
-
-        // Wait for the intro before jumping to TITLE screen
-        if (raylibAnimationPtr_->IsDone())
+        if (slot.policy == ConstructionPolicy::EAGER)
         {
-            curState_ = GameScreenState::TITLE;
+            slot.screen = slot.factory(*contextPtr_);
         }
-        break;
     }
-    case GameScreenState::TITLE:
-    {
-        // Press enter or left click to change to GAMEPLAY screen
-        if (IsKeyPressed(KEY_ENTER) || IsMouseButtonPressed(MOUSE_BUTTON_LEFT))
-        {
-            curState_ = GameScreenState::MENU;
-        }
-        break;
-    }
-    case GameScreenState::MENU:
-    {
-        menuPtr_->Update();
-
-        int selection = menuPtr_->GetSelection();
 
-        if (selection == 0)
-        {
-            curState_ = GameScreenState::GAMEPLAY;
-        }
-        else if (selection == 1)
-        {
-            curState_ = GameScreenState::SETTINGS;
-        }
-        else if (selection == 2)
-        {
-            close_ = true;
-        }
+    GetScreen(curState_).Enter();
+}
 
-        break;
-    }
-    case GameScreenState::SETTINGS:
+ScreenManager::~ScreenManager()
+{
+    // Nothing was measured without the input queue
+    if (!inputPtr_)
     {
-        settingsPtr_->Update();
-
-        bool exitToMenu = settingsPtr_->Exit();
-
-        if (exitToMenu)
-        {
-            curState_ = GameScreenState::MENU;
-        }
-
-        break;
+        return;
     }
-    case GameScreenState::GAMEPLAY:
-    {
-        SetBackgroundMusic();
-        boardPtr_->Update();
 
-        if (boardPtr_->IsFinished())
-        {
-            curState_ = GameScreenState::CELEBRATION;
-        }
-        else if (boardPtr_->RequestedHelp())
-        {
-            curState_ = GameScreenState::HELP;
-        }
-        break;
-    }
-    case GameScreenState::HELP:
+    const gui::LatencySummary latency = inputPtr_->GetLatencySummary();
+    if (latency.count > 0)
     {
-        boardPtr_->UpdateSolution();
-
-        if (boardPtr_->IsFinished())
-        {
-            curState_ = GameScreenState::SAD;
-        }
-        break;
+        TraceLog(LOG_INFO,
+                 "INPUT: Poll to present over %llu moves: mean %.1f ms, p50 %.0f ms, p95 %.0f ms, "
+                 "max %.1f ms",
+                 static_cast<unsigned long long>(latency.count), latency.meanMs, latency.p50Ms,
+                 latency.p95Ms, latency.maxMs);
     }
-    case GameScreenState::CELEBRATION:
-    {
-        celebrationPtr_->PlayApplauseSound();
-        celebrationPtr_->Update();
-
-        static bool leftClickPressedInState = false;
-
-        if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT))
-        {
-            leftClickPressedInState = true;
-        }
-
-        // Press ENTER or left click to change to ENDING screen
-        if (IsKeyPressed(KEY_ENTER) ||
-            (leftClickPressedInState && IsMouseButtonReleased(MOUSE_BUTTON_LEFT)))
-        {
-            curState_ = GameScreenState::ENDING;
-
-            celebrationPtr_->StopApplauseSound();
+}
 
-            leftClickPressedInState = false;
-        }
-        break;
-    }
-    case GameScreenState::SAD:
+void ScreenManager::Update()
+{
+    // Rebuild everything that depends on the size of the window
+    if (IsWindowResized())
     {
-        static bool leftClickPressedInState = false;
-
-        if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT))
-        {
-            leftClickPressedInState = true;
-        }
-
-        // Press ENTER or left click to change to ENDING screen
-        if (IsKeyPressed(KEY_ENTER) ||
-            (leftClickPressedInState && IsMouseButtonReleased(MOUSE_BUTTON_LEFT)))
-        {
-            curState_ = GameScreenState::ENDING;
-
-            leftClickPressedInState = false;
-        }
-        break;
+        Relayout();
     }
-    case GameScreenState::ENDING:
-    {
-        restartBtnAction_ = false;
-        newGameBtnAction_ = false;
-
-        const Vector2 mousePos = GetMousePosition();
-
-        if (CheckCollisionPointRec(mousePos, restartBox_))
-        {
-            if (IsMouseButtonDown(MOUSE_BUTTON_LEFT))
-            {
-                restartBtnState_ = gui::ButtonState::Selected;
-            }
-            else
-            {
-                restartBtnState_ = gui::ButtonState::Hovered;
-            }
-
-            if (IsMouseButtonReleased(MOUSE_BUTTON_LEFT))
-            {
-                restartBtnAction_ = true;
-            }
-        }
-        else
-        {
-            restartBtnState_ = gui::ButtonState::Unselected;
-        }
-
-        if (CheckCollisionPointRec(mousePos, newGameBox_))
-        {
-            if (IsMouseButtonDown(MOUSE_BUTTON_LEFT))
-            {
-                newGameBtnState_ = gui::ButtonState::Selected;
-            }
-            else
-            {
-                newGameBtnState_ = gui::ButtonState::Hovered;
-            }
-
-            if (IsMouseButtonReleased(MOUSE_BUTTON_LEFT))
-            {
-                newGameBtnAction_ = true;
-            }
-        }
-        else
-        {
-            newGameBtnState_ = gui::ButtonState::Unselected;
-        }
-
-        // Check if the undo button needs to take action
-        if (restartBtnAction_)
-        {
-            curState_ = GameScreenState::GAMEPLAY;
-            boardPtr_->Restart();
-        }
 
-        // Check if the help button needs to take action
-        if (newGameBtnAction_)
-        {
-            curState_ = GameScreenState::GAMEPLAY;
-            boardPtr_->Reset();
-        }
+    // Every screen reads the same events, so a click is never seen twice or missed
+    inputPtr_->Poll();
 
-        break;
-    }
-    default:
+    const GameScreenState next = GetScreen(curState_).Update();
+    if (next != curState_)
     {
-        break;
+        ChangeState(next);
     }
+    else
+    {
+        PreloadNextScreen();
     }
+
+    // Bring the cached layer of the new state up to date
+    GetScreen(curState_).RefreshCache();
+}
+
+void ScreenManager::OnFramePresented()
+{
+    inputPtr_->OnFramePresented();
 }
 
 void ScreenManager::Draw() const
 {
-    switch (curState_)
-    {
-    case GameScreenState::LOGO:
-    {
-        raylibAnimationPtr_->Draw();
+    // NOTE: the current screen is always constructed by the time it is drawn
+    slots_[static_cast<size_t>(curState_)].screen->Draw();
+}
 
-        break;
-    }
-    case GameScreenState::TITLE:
-    {
-        DrawRectangle(0, 0, screenWidth_, screenHeight_, JADE_GREEN);
+bool ScreenManager::GetWindowShouldBeClosed() const
+{
+    return contextPtr_->IsCloseRequested();
+}
 
-        int titleTextWidth = MeasureText(greetingTitle.data(), 60);
-        DrawText(greetingTitle.data(), (GetScreenWidth() - titleTextWidth) / 2,
-                 GetScreenHeight() / 3, 60, BLACK);
+FramePacing ScreenManager::GetFramePacing() const noexcept
+{
+    return slots_[static_cast<size_t>(curState_)].screen->GetFramePacing();
+}
 
-        const int subTxtWidth = MeasureText(titleInstrTxt.data(), 20);
-        DrawText(titleInstrTxt.data(), (GetScreenWidth() - subTxtWidth) / 2, 220, 20, DARKBLUE);
+void ScreenManager::AddTransitionHook(TransitionHook hook)
+{
+    transitionHooks_.push_back(std::move(hook));
+}
 
-        break;
-    }
-    case GameScreenState::MENU:
+Screen &ScreenManager::GetScreen(GameScreenState state)
+{
+    ScreenSlot &slot = slots_[static_cast<size_t>(state)];
+    if (!slot.screen)
     {
-        menuPtr_->Draw();
-
-        const int subTxtWidth = MeasureText(menuInstrTxt.data(), 20);
-        DrawText(menuInstrTxt.data(), (GetScreenWidth() - subTxtWidth) / 2, 220, 20, DARKBLUE);
-
-        break;
+        slot.screen = slot.factory(*contextPtr_);
     }
-    case GameScreenState::SETTINGS:
-    {
-        settingsPtr_->Draw();
 
-        const int subTxtWidth = MeasureText(settingsInstrTxt.data(), 20);
-        DrawText(settingsInstrTxt.data(), (GetScreenWidth() - subTxtWidth) / 2, 220, 20, DARKBLUE);
-
-        break;
-    }
-    case GameScreenState::GAMEPLAY:
-    {
-        DrawRectangle(0, 0, screenWidth_, screenHeight_, BEIGE);
+    return *slot.screen;
+}
 
-        boardPtr_->Draw();
+void ScreenManager::ChangeState(GameScreenState next)
+{
+    GetScreen(curState_).Exit();
 
-        break;
-    }
-    case GameScreenState::HELP:
+    for (const TransitionHook &hook : transitionHooks_)
     {
-        DrawRectangle(0, 0, screenWidth_, screenHeight_, RED);
-
-        boardPtr_->DrawSolution();
-
-        break;
+        hook(curState_, next);
     }
-    case GameScreenState::CELEBRATION:
-    {
-        DrawRectangle(0, 0, screenWidth_, screenHeight_, BEIGE);
 
-        const int subTxtWidth = MeasureText(celebrationInstrTxt.data(), 20);
-        DrawText(celebrationInstrTxt.data(), (GetScreenWidth() - subTxtWidth) / 2, 220 + 50, 20,
-                 DARKBLUE);
-
-        boardPtr_->DrawResult();
-        celebrationPtr_->Draw();
+    curState_ = next;
+    GetScreen(curState_).Enter();
+}
 
-        break;
-    }
-    case GameScreenState::SAD:
+void ScreenManager::PreloadNextScreen()
+{
+    for (ScreenSlot &slot : slots_)
     {
-        DrawRectangle(0, 0, screenWidth_, screenHeight_, RED);
+        if ((slot.policy != ConstructionPolicy::BACKGROUND) || slot.screen)
+        {
+            continue;
+        }
 
-        const int subTxtWidth = MeasureText(sadInstrTxt.data(), 20);
-        DrawText(sadInstrTxt.data(), (GetScreenWidth() - subTxtWidth) / 2, 220, 20, DARKBLUE);
+        // The pool keeps working on the heavy parts while the screen is animating
+        if (slot.prepare && !slot.prepare(*contextPtr_))
+        {
+            return;
+        }
 
-        const int mainTxtWidth = MeasureText(pepTalkTxt.data(), 50);
-        DrawText(pepTalkTxt.data(), (GetScreenWidth() - mainTxtWidth) / 2, GetScreenHeight() / 2,
-                 50, DARKBLUE);
+        // Never stall a screen that is animating
+        if (GetFramePacing() == FramePacing::FULL)
+        {
+            return;
+        }
 
-        break;
+        // NOTE: the textures and sounds can only be loaded on the main thread, so at
+        // most one screen is built per frame to keep the hitch short
+        slot.screen = slot.factory(*contextPtr_);
+        return;
     }
-    case GameScreenState::ENDING:
-    {
-        DrawRectangle(0, 0, screenWidth_, screenHeight_, BLUE);
+}
 
-        const int subTxtWidth = MeasureText(endingInstrTxt.data(), 20);
-        DrawText(endingInstrTxt.data(), (GetScreenWidth() - subTxtWidth) / 2, 220, 20, DARKBLUE);
+void ScreenManager::Relayout()
+{
+    const int width = GetScreenWidth();
+    const int height = GetScreenHeight();
 
-        // The restart button
-        DrawRectangleRounded(restartBox_, gui::cornerRadius, gui::segments,
-                             (restartBtnState_ == gui::ButtonState::Selected)  ? CRIMSON
-                             : (restartBtnState_ == gui::ButtonState::Hovered) ? FIREBRICK
-                                                                               : MAROON);
-        DrawText(restartTxt.data(), restartBox_.x + (restartBox_.width - restartTxtWidth_) / 2,
-                 restartBox_.y + (restartBox_.height - buttonFontSize) / 2, buttonFontSize, WHITE);
+    // The texts are rasterized again so they stay crisp at the new size
+    atlasPtr_->Build(gui::GetLayoutScale(width, height));
 
-        // The new game button
-        DrawRectangleRounded(newGameBox_, gui::cornerRadius, gui::segments,
-                             (newGameBtnState_ == gui::ButtonState::Selected)  ? DEEP_SKY_BLUE
-                             : (newGameBtnState_ == gui::ButtonState::Hovered) ? STEEL_BLUE
-                                                                               : CAROLINE_BLUE);
-        DrawText(newGameTxt.data(), newGameBox_.x + (newGameBox_.width - newGameTxtWidth_) / 2,
-                 newGameBox_.y + (newGameBox_.height - buttonFontSize) / 2, buttonFontSize, WHITE);
+    // NOTE: the screens hold a reference to the layout so they pick it up automatically
+    layout_ = gui::ComputeLayout(width, height, *atlasPtr_);
 
-        break;
-    }
-    default:
+    for (ScreenSlot &slot : slots_)
     {
-        break;
-    }
-    }
-}
-
-void ScreenManager::SetBackgroundMusic()
-{
-    bool enabled = settingsPtr_->GetBackgroundMusic();
-    if (enabled)
-    {
-        boardPtr_->EnableBackgroundMusic();
-    }
-    else
-    {
-        boardPtr_->DisableBackgroundMusic();
+        if (slot.screen)
+        {
+            slot.screen->Resize(width, height);
+        }
     }
 }
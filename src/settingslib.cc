@@ -1,5 +1,4 @@
 #include <utility> // std::to_underlying
-#include <string_view>  // std::string_view
 
 #include "raylib.h"
 #define RAYGUI_IMPLEMENTATION
@@ -8,60 +7,20 @@
 #include "gui/colourlib.hpp"
 #include "gui/settingslib.hpp"
 
-namespace
-{
-constexpr int btnFontSize = 35;
-constexpr int btnHeight = 60;
-constexpr int btnFont = 40;
-constexpr float btnY = 350;
-constexpr float btnPadding = 10;
-constexpr float volumeSliderLen = 140;
-const std::string_view exitBtnTxt{"Back to MENU"};
-const Rectangle backgroundCheckboxTxtRec{50, btnY, btnFont, btnFont};
-const char *checkboxText = "Background music: OFF";
-const char *sliderTxt = "Main volume: ";
-} // namespace
-
-Settings::Settings()
-    : screenWidth_(GetScreenWidth()),
-      screenHeight_(GetScreenHeight()),
+Settings::Settings(const Atlas &atlas, const gui::Layout &layout, const gui::InputQueue &input)
+    : atlas_(atlas),
+      layout_(layout),
+      input_(input),
       volume_(25.0f),
       exit_(false),
       exitBtnState_(gui::ButtonState::Unselected),
-      exitBtnWidth_(MeasureText(exitBtnTxt.data(), btnFont)),
-      exitBtnRec_(
-          {0.5f * (screenWidth_ - exitBtnWidth_), 800, exitBtnWidth_ + 2 * btnPadding, btnHeight}),
+      prevExitBtnState_(gui::ButtonState::Unselected),
       btnColours_({JADE_GREEN, DARK_GREEN, TEAL}),
-      volumeLabelRec_({0.5f * (screenWidth_)-150, 0.5f * screenHeight_ - 100, 60, 24}),
-      volumeSliderBarRec_(
-          {volumeLabelRec_.x, 0.5f * screenHeight_ - 100 + 24, volumeSliderLen, 16}),
-      backgroundCheckboxRec_(
-          {0, 0, backgroundCheckboxTxtRec.width, backgroundCheckboxTxtRec.height}),
       fxBackgroundEnabled_(true)
 {
     // Load sound effects
     fxMove_ = LoadSound("resources/switch-menu.mp3");
     fxSelect_ = LoadSound("resources/click-menu.mp3");
-
-    // Measure the length of the texts
-    backgroundMusicTxtLen_ = MeasureText(checkboxText, btnFont);
-    mainVolumeTxtLen_ = MeasureText(sliderTxt, btnFont);
-
-    // Reassign the rectangles
-    float anchorY = volumeSliderBarRec_.y;
-
-    volumeSliderBarRec_.x = volumeLabelRec_.x + mainVolumeTxtLen_;
-    volumeSliderBarRec_.y = (anchorY + 0.75f * volumeSliderBarRec_.height);
-
-    anchorY += 50.0f;
-
-    backgroundCheckboxRec_.x = volumeLabelRec_.x + backgroundMusicTxtLen_ + 10;
-    backgroundCheckboxRec_.y = anchorY;
-
-    anchorY += 50.0f;
-
-    // Draw the exit button
-    exitBtnRec_.y = anchorY;
 }
 
 Settings::~Settings()
@@ -73,14 +32,13 @@ Settings::~Settings()
 
 void Settings::Update()
 {
-    static bool exitAct = false;
-    static gui::ButtonState prevState = gui::ButtonState::Unselected;
+    bool exitAct = false;
 
     // Check if the restart button is hovered or pressed
-    const Vector2 mousePos = GetMousePosition();
-    if (CheckCollisionPointRec(mousePos, exitBtnRec_))
+    const Vector2 mousePos = input_.GetMousePos();
+    if (CheckCollisionPointRec(mousePos, layout_.settings.exitBtn))
     {
-        if (IsMouseButtonDown(MOUSE_BUTTON_LEFT))
+        if (input_.IsMouseDown())
         {
             exitBtnState_ = gui::ButtonState::Selected;
         }
@@ -89,7 +47,7 @@ void Settings::Update()
             exitBtnState_ = gui::ButtonState::Hovered;
         }
 
-        if (IsMouseButtonReleased(MOUSE_BUTTON_LEFT))
+        if (input_.WasMouseReleased())
         {
             exitAct = true;
         }
@@ -99,17 +57,18 @@ void Settings::Update()
         exitBtnState_ = gui::ButtonState::Unselected;
     }
 
-    if (exitBtnState_ != prevState)
+    if (exitBtnState_ != prevExitBtnState_)
     {
         if (fxBackgroundEnabled_)
         {
             PlaySound(fxSelect_);
         }
-        prevState = exitBtnState_;
+        prevExitBtnState_ = exitBtnState_;
     }
 
-    if (fxBackgroundEnabled_ && CheckCollisionPointRec(mousePos, volumeSliderBarRec_) &&
-        (IsMouseButtonDown(MOUSE_BUTTON_LEFT) || IsMouseButtonReleased(MOUSE_BUTTON_LEFT)))
+    if (fxBackgroundEnabled_ &&
+        CheckCollisionPointRec(mousePos, layout_.settings.volumeSliderBar) &&
+        (input_.IsMouseDown() || input_.WasMouseReleased()))
     {
         PlaySound(fxMove_);
     }
@@ -122,33 +81,45 @@ void Settings::Update()
             PlaySound(fxSelect_);
         }
         exit_ = true;
-        exitAct = false;
     }
 
     // Update the master volume
     SetMasterVolume(volume_);
 }
 
-void Settings::Draw()
+void Settings::DrawStatic() const
 {
+    const gui::SettingsLayout &l = layout_.settings;
+
+    // Draw the text descriptions of the slider and the checkbox
+    atlas_.Draw(gui::Sprite::MainVolumeTxt, {l.volumeLabel.x, l.volumeSliderBar.y}, BLACK);
+    atlas_.Draw((fxBackgroundEnabled_) ? gui::Sprite::BackgroundMusicOnTxt
+                                       : gui::Sprite::BackgroundMusicOffTxt,
+                {l.volumeLabel.x, l.backgroundCheckbox.y}, BLACK);
+
+    // Draw the exit button
+    DrawRectangleRec(l.exitBtn, btnColours_[static_cast<int>(exitBtnState_)]);
+    atlas_.Draw(gui::Sprite::BackToMenuTxt,
+                {l.exitBtn.x + l.btnTxtPadding, l.exitBtn.y + l.btnTxtPadding}, WHITE);
+}
+
+void Settings::DrawWidgets()
+{
+    const gui::SettingsLayout &l = layout_.settings;
+
     // Draw the volume slider
-    GuiLabel({volumeLabelRec_.x + mainVolumeTxtLen_,
-              (volumeLabelRec_.y - volumeSliderBarRec_.height), volumeLabelRec_.width,
-              volumeLabelRec_.height},
+    GuiLabel({l.volumeSliderBar.x, (l.volumeLabel.y - l.volumeSliderBar.height),
+              l.volumeLabel.width, l.volumeLabel.height},
              TextFormat("Volume: %i %", (int)volume_));
-    GuiSliderBar(volumeSliderBarRec_, NULL, NULL, &volume_, 0.0f, 100.0f);
-    DrawText("Main volume: ", volumeLabelRec_.x, volumeSliderBarRec_.y, btnFont, BLACK);
+    GuiSliderBar(l.volumeSliderBar, NULL, NULL, &volume_, 0.0f, 100.0f);
 
-    // Draw the checkbox and its text description
-    GuiCheckBox(backgroundCheckboxRec_, NULL, &fxBackgroundEnabled_);
-    DrawText(TextFormat("Background music: %s", (fxBackgroundEnabled_) ? "ON" : "OFF"),
-             volumeLabelRec_.x, backgroundCheckboxRec_.y, btnFont, BLACK);
+    // Draw the checkbox
+    GuiCheckBox(l.backgroundCheckbox, NULL, &fxBackgroundEnabled_);
+}
 
-    // Draw the exit button
-    DrawRectangle(exitBtnRec_.x, exitBtnRec_.y, exitBtnRec_.width, exitBtnRec_.height,
-                  btnColours_[static_cast<int>(exitBtnState_)]);
-    DrawText(exitBtnTxt.data(), exitBtnRec_.x + btnPadding, exitBtnRec_.y + btnPadding, btnFont,
-             WHITE);
+std::uint64_t Settings::GetStaticStateKey() const noexcept
+{
+    return (static_cast<std::uint64_t>(exitBtnState_) << 1) | (fxBackgroundEnabled_ ? 1 : 0);
 }
 
 bool Settings::Exit()
@@ -0,0 +1,142 @@
+#include <array> // std::array
+
+#include "stats/skiplistlib.hpp"
+
+namespace
+{
+// The seed of the level generator when none is given
+constexpr std::uint64_t defaultSeed = 0x9E3779B97F4A7C15ULL;
+} // namespace
+
+namespace stats
+{
+RankedSkipList::RankedSkipList() : RankedSkipList(defaultSeed)
+{
+}
+
+RankedSkipList::RankedSkipList(std::uint64_t seed)
+    : keys_{0},
+      firstLinks_{0},
+      links_(maxLevel, Link{nil, 0}),
+      level_(1),
+      size_(0),
+      rngState_(seed | 1)
+{
+}
+
+size_t RankedSkipList::Insert(std::uint64_t key)
+{
+    // The last node before the new key on every level and its position
+    std::array<std::uint32_t, maxLevel> update;
+    std::array<size_t, maxLevel> rankAt;
+
+    std::uint32_t x = head;
+    for (size_t i = level_; i-- > 0;)
+    {
+        rankAt[i] = (i == level_ - 1) ? 0 : rankAt[i + 1];
+        while ((GetLink(x, i).next != nil) && (keys_[GetLink(x, i).next] <= key))
+        {
+            rankAt[i] += GetLink(x, i).span;
+            x = GetLink(x, i).next;
+        }
+        update[i] = x;
+    }
+
+    // The new levels start at the head and skip the whole list
+    const size_t level = GetRandomLevel();
+    for (size_t i = level_; i < level; i++)
+    {
+        rankAt[i] = 0;
+        update[i] = head;
+        GetLink(head, i).span = static_cast<std::uint32_t>(size_);
+    }
+    level_ = (level > level_) ? level : level_;
+
+    const std::uint32_t node = static_cast<std::uint32_t>(keys_.size());
+    keys_.push_back(key);
+    firstLinks_.push_back(static_cast<std::uint32_t>(links_.size()));
+    links_.resize(links_.size() + level);
+
+    // Split the links that now jump over the new node
+    for (size_t i = 0; i < level; i++)
+    {
+        Link &prev = GetLink(update[i], i);
+        Link &cur = GetLink(node, i);
+
+        const std::uint32_t skipped = static_cast<std::uint32_t>(rankAt[0] - rankAt[i]);
+        cur.next = prev.next;
+        cur.span = prev.span - skipped;
+        prev.next = node;
+        prev.span = skipped + 1;
+    }
+
+    // The links above the new node skip one more position
+    for (size_t i = level; i < level_; i++)
+    {
+        GetLink(update[i], i).span++;
+    }
+
+    size_++;
+
+    return rankAt[0];
+}
+
+size_t RankedSkipList::CountLess(std::uint64_t key) const noexcept
+{
+    size_t rank = 0;
+
+    std::uint32_t x = head;
+    for (size_t i = level_; i-- > 0;)
+    {
+        while ((GetLink(x, i).next != nil) && (keys_[GetLink(x, i).next] < key))
+        {
+            rank += GetLink(x, i).span;
+            x = GetLink(x, i).next;
+        }
+    }
+
+    return rank;
+}
+
+std::uint64_t RankedSkipList::GetKeyAt(size_t rank) const noexcept
+{
+    // The head sits at position 0 and the keys at 1 to size_
+    const size_t target = rank + 1;
+    size_t pos = 0;
+
+    std::uint32_t x = head;
+    for (size_t i = level_; i-- > 0;)
+    {
+        while ((GetLink(x, i).next != nil) && (pos + GetLink(x, i).span <= target))
+        {
+            pos += GetLink(x, i).span;
+            x = GetLink(x, i).next;
+        }
+
+        if (pos == target)
+        {
+            break;
+        }
+    }
+
+    return keys_[x];
+}
+
+size_t RankedSkipList::GetRandomLevel() noexcept
+{
+    // xorshift64, a level only needs a couple of random bits
+    rngState_ ^= rngState_ << 13;
+    rngState_ ^= rngState_ >> 7;
+    rngState_ ^= rngState_ << 17;
+
+    size_t level = 1;
+    std::uint64_t bits = rngState_;
+    while ((level < maxLevel) && ((bits & 3) == 0))
+    {
+        level++;
+        bits >>= 2;
+    }
+
+    return level;
+}
+} // namespace stats
@@ -0,0 +1,73 @@
+#include <mutex>    // std::lock_guard
+#include <optional> // std::optional, std::nullopt
+#include <utility>  // std::move
+#include <vector>   // std::vector
+
+#include "search/solutioncachelib.hpp"
+
+namespace search
+{
+SolutionCache::SolutionCache(size_t capacity)
+    : capacity_(capacity),
+      hits_(0),
+      misses_(0)
+{
+    index_.reserve(capacity);
+}
+
+std::optional<Solution> SolutionCache::Find(PackedState key)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const auto itr = index_.find(key);
+    if (itr == index_.cend())
+    {
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        return std::nullopt;
+    }
+
+    hits_.fetch_add(1, std::memory_order_relaxed);
+
+    // Move the entry to the front without reallocating it
+    entries_.splice(entries_.begin(), entries_, itr->second);
+
+    return itr->second->solution;
+}
+
+void SolutionCache::Insert(PackedState key, std::vector<short> dirs)
+{
+    if (capacity_ == 0)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const unsigned length = static_cast<unsigned>(dirs.size());
+
+    // Refresh the entry if another caller got there first
+    if (const auto itr = index_.find(key); itr != index_.cend())
+    {
+        itr->second->solution = {length, std::move(dirs)};
+        entries_.splice(entries_.begin(), entries_, itr->second);
+        return;
+    }
+
+    // Evict the least recently used entry
+    if (entries_.size() == capacity_)
+    {
+        index_.erase(entries_.back().key);
+        entries_.pop_back();
+    }
+
+    entries_.push_front({key, {length, std::move(dirs)}});
+    index_[key] = entries_.begin();
+}
+
+size_t SolutionCache::GetSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    return entries_.size();
+}
+} // namespace search
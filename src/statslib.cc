@@ -0,0 +1,245 @@
+#include <algorithm> // std::min
+#include <array>     // std::array
+#include <chrono>    // std::chrono::seconds
+#include <cstring>   // std::memcmp
+#include <utility>   // std::move
+
+#include <fcntl.h>    // open, O_RDWR, O_CREAT, O_APPEND
+#include <sys/stat.h> // fstat
+#include <unistd.h>   // read, write, fsync, ftruncate, close
+
+#include "fmt/core.h"
+
+#include "stats/statslib.hpp"
+
+namespace
+{
+// The first bytes of the log, bump the last digit when GameRecord changes
+constexpr std::array<char, 8> magic{'8', 'P', 'Z', 'S', 'T', 'A', 'T', '1'};
+
+// The longest time a record waits in the queue
+constexpr std::chrono::seconds syncInterval{2};
+
+// The number of records read at a time while loading
+constexpr size_t loadChunkSize = 256;
+
+/// @brief Writes a whole buffer and retries the short writes
+/// @param fd The file descriptor
+/// @param data The buffer
+/// @param size The size of the buffer in bytes
+/// @return FALSE if the write fails
+bool WriteAll(int fd, const void *data, size_t size)
+{
+    const char *bytes = static_cast<const char *>(data);
+    while (size > 0)
+    {
+        const ssize_t written = write(fd, bytes, size);
+        if (written < 0)
+        {
+            return false;
+        }
+
+        bytes += written;
+        size -= static_cast<size_t>(written);
+    }
+
+    return true;
+}
+} // namespace
+
+namespace stats
+{
+StatsLog::StatsLog(std::string path)
+    : path_(std::move(path)),
+      fd_(open(path_.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644)),
+      summary_{},
+      pending_{},
+      stop_(false),
+      numOfPersisted_(0)
+{
+    pending_.reserve(syncBatchSize);
+
+    if (fd_ < 0)
+    {
+        fmt::print(stderr, "WARNING: STATS: Could not open {}, games will not be saved\n", path_);
+    }
+    else
+    {
+        Load();
+    }
+
+    writer_ = std::thread(&StatsLog::WriterLoop, this);
+}
+
+StatsLog::~StatsLog()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_one();
+
+    writer_.join();
+
+    if (fd_ >= 0)
+    {
+        close(fd_);
+    }
+}
+
+void StatsLog::Append(const GameRecord &record)
+{
+    AddToSummary(record);
+
+    bool isBatchFull = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.push_back(record);
+        isBatchFull = (pending_.size() >= syncBatchSize);
+    }
+
+    if (isBatchFull)
+    {
+        cv_.notify_one();
+    }
+}
+
+void StatsLog::Load()
+{
+    struct stat info;
+    if (fstat(fd_, &info) != 0)
+    {
+        close(fd_);
+        fd_ = -1;
+        return;
+    }
+
+    // A new log starts with the magic
+    if (info.st_size == 0)
+    {
+        if (!WriteAll(fd_, magic.data(), magic.size()))
+        {
+            fmt::print(stderr, "WARNING: STATS: Could not write to {}\n", path_);
+            close(fd_);
+            fd_ = -1;
+        }
+        return;
+    }
+
+    // Never append to a file that is not a log of this version
+    std::array<char, magic.size()> header{};
+    if ((read(fd_, header.data(), header.size()) != static_cast<ssize_t>(header.size())) ||
+        (std::memcmp(header.data(), magic.data(), magic.size()) != 0))
+    {
+        fmt::print(stderr, "WARNING: STATS: {} is not a stats log, games will not be saved\n",
+                   path_);
+        close(fd_);
+        fd_ = -1;
+        return;
+    }
+
+    const size_t numOfRecords =
+        (static_cast<size_t>(info.st_size) - magic.size()) / sizeof(GameRecord);
+
+    std::vector<GameRecord> chunk(loadChunkSize);
+    size_t numOfRead = 0;
+    while (numOfRead < numOfRecords)
+    {
+        const size_t count = std::min(loadChunkSize, numOfRecords - numOfRead);
+        const ssize_t bytes = read(fd_, chunk.data(), count * sizeof(GameRecord));
+        if (bytes != static_cast<ssize_t>(count * sizeof(GameRecord)))
+        {
+            break;
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            AddToSummary(chunk[i]);
+        }
+        numOfRead += count;
+    }
+
+    // Drop the torn record that a crash in the middle of a write leaves behind
+    const off_t validSize = static_cast<off_t>(magic.size() + numOfRead * sizeof(GameRecord));
+    if ((info.st_size != validSize) && (ftruncate(fd_, validSize) != 0))
+    {
+        fmt::print(stderr, "WARNING: STATS: Could not repair {}\n", path_);
+    }
+
+    numOfPersisted_.store(numOfRead, std::memory_order_relaxed);
+}
+
+void StatsLog::AddToSummary(const GameRecord &record) noexcept
+{
+    summary_.numOfGames++;
+    summary_.totalDurationMs += record.durationMs;
+
+    if (record.usedHelp)
+    {
+        summary_.numOfHelped++;
+        return;
+    }
+
+    summary_.totalUserMoves += record.userMoves;
+    summary_.totalOptimalMoves += record.optimalMoves;
+
+    if (record.userMoves == record.optimalMoves)
+    {
+        summary_.numOfPerfect++;
+    }
+
+    std::uint32_t &best = summary_.bestDurationMs[std::min<size_t>(record.optimalMoves,
+                                                                   maxOptimalMoves)];
+    if ((best == 0) || (record.durationMs < best))
+    {
+        best = record.durationMs;
+    }
+}
+
+void StatsLog::WriterLoop()
+{
+    std::vector<GameRecord> batch;
+    batch.reserve(syncBatchSize);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        // Wake up for a full batch, or write whatever there is every few seconds
+        cv_.wait_for(lock, syncInterval,
+                     [this] { return stop_ || (pending_.size() >= syncBatchSize); });
+
+        const bool stop = stop_;
+        batch.swap(pending_);
+
+        // The disk is only touched without the lock, so Append() never waits for it
+        lock.unlock();
+        if (!batch.empty())
+        {
+            WriteBatch(batch);
+            batch.clear();
+        }
+        lock.lock();
+
+        if (stop && pending_.empty())
+        {
+            break;
+        }
+    }
+}
+
+void StatsLog::WriteBatch(const std::vector<GameRecord> &batch)
+{
+    if (fd_ < 0)
+    {
+        return;
+    }
+
+    if (!WriteAll(fd_, batch.data(), batch.size() * sizeof(GameRecord)) || (fsync(fd_) != 0))
+    {
+        fmt::print(stderr, "WARNING: STATS: Could not write {} games to {}\n", batch.size(), path_);
+        return;
+    }
+
+    numOfPersisted_.fetch_add(batch.size(), std::memory_order_relaxed);
+}
+} // namespace stats
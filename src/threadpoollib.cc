@@ -0,0 +1,164 @@
+#include <algorithm> // std::min
+#include <mutex>     // std::lock_guard, std::unique_lock
+#include <utility>   // std::move
+
+#include "utils/threadpoollib.hpp"
+
+ThreadPool::ThreadPool(unsigned numOfWorkers)
+    : job_(nullptr),
+      count_(0),
+      grain_(1),
+      next_(0),
+      busy_(0),
+      generation_(0),
+      stop_(false),
+      tasks_{},
+      stopTasks_(false),
+      background_(&ThreadPool::BackgroundLoop, this)
+{
+    workers_.reserve(numOfWorkers);
+    for (unsigned i = 0; i < numOfWorkers; i++)
+    {
+        workers_.emplace_back(&ThreadPool::WorkerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    // The tasks that are already submitted still run, someone may wait for them
+    {
+        std::lock_guard<std::mutex> lock(taskMutex_);
+        stopTasks_ = true;
+    }
+    taskCv_.notify_one();
+    background_.join();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wakeCv_.notify_all();
+
+    for (std::thread &worker : workers_)
+    {
+        worker.join();
+    }
+}
+
+void ThreadPool::ParallelFor(size_t count, size_t grain, const Job &job)
+{
+    grain = (grain == 0) ? 1 : grain;
+
+    // Not worth waking anyone up
+    if (workers_.empty() || (count <= grain))
+    {
+        job(0, count);
+        return;
+    }
+
+    // The workers are on the loop of another thread (e.g. a background task)
+    std::unique_lock<std::mutex> caller(callerMutex_, std::try_to_lock);
+    if (!caller.owns_lock())
+    {
+        job(0, count);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        job_ = &job;
+        count_ = count;
+        grain_ = grain;
+        next_.store(0, std::memory_order_relaxed);
+        busy_ = static_cast<unsigned>(workers_.size());
+        ++generation_;
+    }
+    wakeCv_.notify_all();
+
+    // Help out instead of idling
+    RunChunks();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    doneCv_.wait(lock, [this] { return busy_ == 0; });
+    job_ = nullptr;
+}
+
+std::future<void> ThreadPool::Submit(std::function<void()> task)
+{
+    std::packaged_task<void()> packaged(std::move(task));
+    std::future<void> future = packaged.get_future();
+    {
+        std::lock_guard<std::mutex> lock(taskMutex_);
+        tasks_.push_back(std::move(packaged));
+    }
+    taskCv_.notify_one();
+
+    return future;
+}
+
+void ThreadPool::WorkerLoop()
+{
+    std::uint64_t seen = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wakeCv_.wait(lock, [this, seen] { return stop_ || (generation_ != seen); });
+
+            if (stop_)
+            {
+                return;
+            }
+
+            seen = generation_;
+        }
+
+        RunChunks();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--busy_ == 0)
+            {
+                doneCv_.notify_one();
+            }
+        }
+    }
+}
+
+void ThreadPool::RunChunks()
+{
+    while (true)
+    {
+        const size_t begin = next_.fetch_add(grain_, std::memory_order_relaxed);
+        if (begin >= count_)
+        {
+            break;
+        }
+
+        (*job_)(begin, std::min(begin + grain_, count_));
+    }
+}
+
+void ThreadPool::BackgroundLoop()
+{
+    while (true)
+    {
+        std::packaged_task<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(taskMutex_);
+            taskCv_.wait(lock, [this] { return stopTasks_ || !tasks_.empty(); });
+
+            if (tasks_.empty())
+            {
+                return;
+            }
+
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+
+        // An exception ends up in the future
+        task();
+    }
+}
@@ -0,0 +1,108 @@
+#include <algorithm> // std::copy, std::min
+#include <span>      // std::span
+#include <utility>   // std::swap
+
+#include "gui/timelinelib.hpp"
+
+namespace
+{
+// Long pauses (e.g. after waiting for events) must not skip the animation
+constexpr float maxFrameDelta = 1.0f / 20;
+
+/// @brief Eases a slide out so the piece settles into its grid
+/// @param t The linear progress in [0, 1]
+/// @return The eased progress in [0, 1]
+float EaseOutCubic(float t)
+{
+    const float u = 1.0f - t;
+    return 1.0f - u * u * u;
+}
+} // namespace
+
+Timeline::Timeline(float duration)
+    : duration_(duration),
+      elapsed_(0.0f),
+      layout_{},
+      slides_{},
+      head_(0),
+      count_(0)
+{
+}
+
+void Timeline::Reset(std::span<const int> layout)
+{
+    std::copy(layout.begin(), layout.end(), layout_.begin());
+
+    elapsed_ = 0.0f;
+    head_ = 0;
+    count_ = 0;
+}
+
+void Timeline::Push(int from, int to)
+{
+    // Finish the oldest slide right away rather than dropping the new one
+    if (count_ == capacity)
+    {
+        head_ = (head_ + 1) % capacity;
+        --count_;
+        elapsed_ = 0.0f;
+
+        if (count_ > 0)
+        {
+            StartSlide();
+        }
+    }
+
+    slides_[(head_ + count_) % capacity] = {from, to};
+    ++count_;
+
+    if (count_ == 1)
+    {
+        StartSlide();
+    }
+}
+
+void Timeline::Update(float dt)
+{
+    if (count_ == 0)
+    {
+        return;
+    }
+
+    // Play faster when more slides are waiting so the board never falls far behind
+    elapsed_ += std::min(dt, maxFrameDelta) * static_cast<float>(count_);
+
+    while ((count_ > 0) && (elapsed_ >= duration_))
+    {
+        elapsed_ -= duration_;
+        head_ = (head_ + 1) % capacity;
+        --count_;
+
+        if (count_ > 0)
+        {
+            StartSlide();
+        }
+    }
+
+    if (count_ == 0)
+    {
+        elapsed_ = 0.0f;
+    }
+}
+
+float Timeline::GetProgress() const noexcept
+{
+    if ((count_ == 0) || (duration_ <= 0.0f))
+    {
+        return 1.0f;
+    }
+
+    return EaseOutCubic(std::min(elapsed_ / duration_, 1.0f));
+}
+
+void Timeline::StartSlide()
+{
+    // The piece lands in its target straight away, the draw offsets it back
+    const Slide &slide = slides_[head_];
+    std::swap(layout_[static_cast<size_t>(slide.from)], layout_[static_cast<size_t>(slide.to)]);
+}
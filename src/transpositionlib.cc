@@ -0,0 +1,138 @@
+#include <algorithm> // std::clamp, std::max
+#include <bit>       // std::bit_floor
+#include <climits>   // INT_MAX
+#include <cstdint>   // std::uint64_t
+
+#include "slidr/constants/constantslib.hpp" // constants::EIGHT_PUZZLE_NUM
+
+#include "search/transpositionlib.hpp"
+
+namespace
+{
+// The layout of an entry: the whole packed state is the key, then the bound,
+// the depth and the generation one byte each
+constexpr int keyBits = 4 * constants::EIGHT_PUZZLE_NUM;
+constexpr std::uint64_t keyMask = (std::uint64_t{1} << keyBits) - 1;
+constexpr int boundShift = 40;
+constexpr int depthShift = 48;
+constexpr int generationShift = 56;
+
+// The number of slots a state may take, they share a cache line
+constexpr size_t bucketSize = 4;
+
+/// @brief Gets a field of an entry
+/// @param entry The entry
+/// @param shift The position of the field
+/// @return The value of the field
+int GetField(std::uint64_t entry, int shift) noexcept
+{
+    return static_cast<int>((entry >> shift) & 0xFF);
+}
+} // namespace
+
+namespace search
+{
+TranspositionTable::TranspositionTable(size_t memoryBudget)
+    : slots_(std::max(bucketSize,
+                      std::bit_floor(memoryBudget / sizeof(std::atomic<std::uint64_t>)))),
+      generation_(0)
+{
+}
+
+int TranspositionTable::Probe(PackedState state, TableCounters &counters) const noexcept
+{
+    const size_t bucket = GetBucket(state);
+    for (size_t i = bucket; i < bucket + bucketSize; i++)
+    {
+        const std::uint64_t entry = slots_[i].load(std::memory_order_relaxed);
+        if ((entry != 0) && ((entry & keyMask) == state))
+        {
+            counters.hits++;
+            return GetField(entry, boundShift);
+        }
+    }
+
+    counters.misses++;
+    return 0;
+}
+
+void TranspositionTable::Store(PackedState state, int bound, int depth,
+                               TableCounters &counters) noexcept
+{
+    const int generation = generation_.load(std::memory_order_relaxed);
+    const std::uint64_t entry =
+        state | (static_cast<std::uint64_t>(std::clamp(bound, 0, 0xFF)) << boundShift) |
+        (static_cast<std::uint64_t>(std::clamp(depth, 0, 0xFF)) << depthShift) |
+        (static_cast<std::uint64_t>(generation) << generationShift);
+
+    // Take the slot of the same state, otherwise the one that is worth the least
+    const size_t bucket = GetBucket(state);
+    size_t victim = bucket;
+    std::uint64_t victimEntry = 0;
+    int victimWorth = INT_MAX;
+    for (size_t i = bucket; i < bucket + bucketSize; i++)
+    {
+        const std::uint64_t old = slots_[i].load(std::memory_order_relaxed);
+        if ((old != 0) && ((old & keyMask) == state))
+        {
+            // A tighter bound is already there
+            if (GetField(old, boundShift) >= bound)
+            {
+                return;
+            }
+
+            victim = i;
+            victimEntry = old;
+            break;
+        }
+
+        // An empty slot is worth nothing, an older search less than the current one
+        int worth = -1;
+        if (old != 0)
+        {
+            worth = GetField(old, depthShift);
+            worth += (GetField(old, generationShift) == generation) ? 0x100 : 0;
+        }
+        if (worth < victimWorth)
+        {
+            victim = i;
+            victimEntry = old;
+            victimWorth = worth;
+        }
+    }
+
+    // Another thread wrote the slot meanwhile, its entry is as good as this one
+    if (!slots_[victim].compare_exchange_strong(victimEntry, entry, std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    if ((victimEntry != 0) && ((victimEntry & keyMask) != state) &&
+        (GetField(victimEntry, generationShift) == generation))
+    {
+        counters.collisions++;
+    }
+}
+
+void TranspositionTable::NewSearch() noexcept
+{
+    generation_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void TranspositionTable::Clear() noexcept
+{
+    for (std::atomic<std::uint64_t> &slot : slots_)
+    {
+        slot.store(0, std::memory_order_relaxed);
+    }
+}
+
+size_t TranspositionTable::GetBucket(PackedState state) const noexcept
+{
+    std::uint64_t h = state * 0x9E3779B97F4A7C15ULL;
+    h ^= h >> 29;
+
+    // The slot count is a power of two and at least one bucket
+    return static_cast<size_t>(h) & (slots_.size() - bucketSize);
+}
+} // namespace search
@@ -0,0 +1,48 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "gui/buttonlib.hpp"
+
+TEST_CASE("A press and a release over the same button is a click", "[button]")
+{
+    gui::ClickTracker tracker;
+
+    // Held over a few frames
+    CHECK(tracker.Update(gui::Button::Undo, true, false) == gui::Button::Invalid);
+    CHECK(tracker.Update(gui::Button::Undo, false, false) == gui::Button::Invalid);
+    CHECK(tracker.Update(gui::Button::Undo, false, true) == gui::Button::Undo);
+
+    // Within a single frame
+    CHECK(tracker.Update(gui::Button::Redo, true, true) == gui::Button::Redo);
+
+    // The release ends the click, the next release needs its own press
+    CHECK(tracker.Update(gui::Button::Redo, false, true) == gui::Button::Invalid);
+}
+
+TEST_CASE("A drag onto a button is no click", "[button]")
+{
+    gui::ClickTracker tracker;
+
+    // Pressed on one button and released on another
+    tracker.Update(gui::Button::Undo, true, false);
+    CHECK(tracker.Update(gui::Button::Redo, false, true) == gui::Button::Invalid);
+
+    // Pressed next to the buttons and released on one
+    tracker.Update(gui::Button::Invalid, true, false);
+    CHECK(tracker.Update(gui::Button::Restart, false, true) == gui::Button::Invalid);
+
+    // Pressed on a button, dragged off and released next to it
+    tracker.Update(gui::Button::Help, true, false);
+    CHECK(tracker.Update(gui::Button::Invalid, false, true) == gui::Button::Invalid);
+
+    // Released without a press that was seen, e.g. on a screen entered with the button held
+    CHECK(tracker.Update(gui::Button::NewGame, false, true) == gui::Button::Invalid);
+}
+
+TEST_CASE("A reset forgets the press", "[button]")
+{
+    gui::ClickTracker tracker;
+
+    tracker.Update(gui::Button::Restart, true, false);
+    tracker.Reset();
+    CHECK(tracker.Update(gui::Button::Restart, false, true) == gui::Button::Invalid);
+}
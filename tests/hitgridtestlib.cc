@@ -0,0 +1,190 @@
+#include <array> // std::array
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "raylib.h" // Rectangle, Vector2
+
+#include "gui/hitgridlib.hpp"
+
+namespace
+{
+// A grid of 50 x 50 cells
+constexpr Rectangle area{0, 0, 400, 400};
+
+// The length of a cell
+constexpr float cellLen = 50;
+
+/// @brief Gets the rectangle of a cell
+/// @param col The column
+/// @param row The row
+/// @return The rectangle, edges included on the left and the top only
+constexpr Rectangle GetCell(int col, int row)
+{
+    return {static_cast<float>(col) * cellLen, static_cast<float>(row) * cellLen, cellLen,
+            cellLen};
+}
+} // namespace
+
+TEST_CASE("A point maps to the cell it is in", "[hitgrid]")
+{
+    CHECK(gui::GetCellIndex(area, 8, 8, {0, 0}) == 0);
+    CHECK(gui::GetCellIndex(area, 8, 8, {49.9f, 49.9f}) == 0);
+    CHECK(gui::GetCellIndex(area, 8, 8, {399.9f, 399.9f}) == 63);
+
+    // A point on an edge between two cells belongs to the later one
+    CHECK(gui::GetCellIndex(area, 8, 8, {50, 0}) == 1);
+    CHECK(gui::GetCellIndex(area, 8, 8, {0, 50}) == 8);
+    CHECK(gui::GetCellIndex(area, 8, 8, {50, 50}) == 9);
+
+    // The grid does not have to start at the origin or be square
+    constexpr Rectangle offset{100, 200, 300, 100};
+    CHECK(gui::GetCellIndex(offset, 3, 2, {100, 200}) == 0);
+    CHECK(gui::GetCellIndex(offset, 3, 2, {250, 260}) == 4);
+}
+
+TEST_CASE("A point outside the grid is in no cell", "[hitgrid]")
+{
+    // The right and the bottom edges are outside, like the end of a range
+    CHECK(gui::GetCellIndex(area, 8, 8, {400, 0}) == gui::noHit);
+    CHECK(gui::GetCellIndex(area, 8, 8, {0, 400}) == gui::noHit);
+    CHECK(gui::GetCellIndex(area, 8, 8, {-0.1f, 10}) == gui::noHit);
+    CHECK(gui::GetCellIndex(area, 8, 8, {10, -0.1f}) == gui::noHit);
+    CHECK(gui::GetCellIndex(area, 8, 8, {1000, 1000}) == gui::noHit);
+
+    // An empty grid covers nothing
+    CHECK(gui::GetCellIndex({0, 0, 0, 0}, 8, 8, {0, 0}) == gui::noHit);
+}
+
+TEST_CASE("A query finds the widget under the point", "[hitgrid]")
+{
+    HitGrid grid;
+    grid.Reset(area);
+    REQUIRE(grid.Register(7, {75, 75, 100, 20}));
+
+    CHECK(grid.Query({75, 75}) == 7);
+    CHECK(grid.Query({174.9f, 94.9f}) == 7);
+
+    // Next to the widget, in one of its cells or not
+    CHECK(grid.Query({175, 80}) == gui::noHit);
+    CHECK(grid.Query({80, 95}) == gui::noHit);
+    CHECK(grid.Query({74.9f, 80}) == gui::noHit);
+    CHECK(grid.Query({300, 300}) == gui::noHit);
+
+    // Outside the area of the grid nothing is hit, even where a widget sticks out
+    REQUIRE(grid.Register(8, {350, 350, 100, 100}));
+    CHECK(grid.Query({399, 399}) == 8);
+    CHECK(grid.Query({420, 420}) == gui::noHit);
+    CHECK(grid.Query({-1, -1}) == gui::noHit);
+
+    // A reset drops every widget
+    grid.Reset(area);
+    CHECK(grid.Query({75, 75}) == gui::noHit);
+}
+
+TEST_CASE("The widget registered first wins where they overlap", "[hitgrid]")
+{
+    HitGrid grid;
+    grid.Reset(area);
+    REQUIRE(grid.Register(1, {0, 0, 100, 100}));
+    REQUIRE(grid.Register(2, {50, 50, 100, 100}));
+
+    CHECK(grid.Query({25, 25}) == 1);
+    CHECK(grid.Query({75, 75}) == 1);
+    CHECK(grid.Query({125, 125}) == 2);
+}
+
+TEST_CASE("A widget that ends on a cell edge stays out of the next cell", "[hitgrid]")
+{
+    HitGrid grid;
+    grid.Reset(area);
+
+    // Fill the first cell
+    for (int id = 0; id < HitGrid::maxWidgetsPerCell; id++)
+    {
+        REQUIRE(grid.Register(id, GetCell(0, 0)));
+    }
+    CHECK_FALSE(grid.Register(99, GetCell(0, 0)));
+
+    // Its neighbours to the right and below still have room
+    for (int id = 0; id < HitGrid::maxWidgetsPerCell; id++)
+    {
+        CHECK(grid.Register(10 + id, GetCell(1, 0)));
+    }
+    CHECK(grid.Register(20, GetCell(0, 1)));
+
+    CHECK(grid.Query({49.9f, 49.9f}) == 0);
+    CHECK(grid.Query({50, 0}) == 10);
+    CHECK(grid.Query({0, 50}) == 20);
+}
+
+TEST_CASE("A full cell refuses a widget without touching the others", "[hitgrid]")
+{
+    HitGrid grid;
+    grid.Reset(area);
+    for (int id = 0; id < HitGrid::maxWidgetsPerCell; id++)
+    {
+        REQUIRE(grid.Register(id, GetCell(0, 0)));
+    }
+
+    // Spans the full cell and a free one, so neither gets it
+    CHECK_FALSE(grid.Register(50, {0, 0, 100, 50}));
+    CHECK(grid.Query({75, 25}) == gui::noHit);
+
+    // Nor did it take a slot
+    for (int id = 0; id < HitGrid::maxWidgetsPerCell; id++)
+    {
+        REQUIRE(grid.Register(60 + id, GetCell(1, 0)));
+    }
+    CHECK(grid.Query({75, 25}) == 60);
+}
+
+TEST_CASE("A grid holds a limited number of widgets", "[hitgrid]")
+{
+    HitGrid grid;
+    grid.Reset(area);
+
+    // One widget per cell, so only the total limits them
+    for (int id = 0; id < HitGrid::maxWidgets; id++)
+    {
+        REQUIRE(grid.Register(id, GetCell(id % HitGrid::gridSize, id / HitGrid::gridSize)));
+    }
+    CHECK_FALSE(grid.Register(HitGrid::maxWidgets, GetCell(7, 7)));
+    CHECK(grid.Query({375, 375}) == gui::noHit);
+    CHECK(grid.Query({375, 75}) == HitGrid::maxWidgets - 1);
+
+    // A reset makes room again
+    grid.Reset(area);
+    CHECK(grid.Register(HitGrid::maxWidgets, GetCell(7, 7)));
+    CHECK(grid.Query({375, 375}) == HitGrid::maxWidgets);
+}
+
+TEST_CASE("A grid over a stack of buttons fits all of them", "[hitgrid]")
+{
+    // Five buttons stacked on the right of a window that is much taller than wide
+    constexpr Rectangle screen{0, 0, 400, 4000};
+    constexpr float btnHeight = 80.0f / 3;
+    constexpr float btnStep = btnHeight + 2;
+    std::array<Rectangle, 5> btns{};
+    for (size_t i = 0; i < btns.size(); i++)
+    {
+        btns[i] = {300, 1000 + static_cast<float>(i) * btnStep, 67, btnHeight};
+    }
+
+    // Over the whole window they all fall into the same row of cells
+    HitGrid onScreen;
+    onScreen.Reset(screen);
+    for (size_t i = 0; i < HitGrid::maxWidgetsPerCell; i++)
+    {
+        REQUIRE(onScreen.Register(static_cast<int>(i), btns[i]));
+    }
+    CHECK_FALSE(onScreen.Register(4, btns[4]));
+
+    // Over the buttons alone a row is shorter than a button
+    HitGrid onButtons;
+    onButtons.Reset({300, 1000, 67, 4 * btnStep + btnHeight});
+    for (size_t i = 0; i < btns.size(); i++)
+    {
+        REQUIRE(onButtons.Register(static_cast<int>(i), btns[i]));
+        CHECK(onButtons.Query({310, btns[i].y + 1}) == static_cast<int>(i));
+    }
+}
@@ -0,0 +1,98 @@
+#include <array>      // std::array
+#include <chrono>     // std::chrono::milliseconds
+#include <filesystem> // std::filesystem::temp_directory_path, std::filesystem::remove
+#include <fstream>    // std::ofstream
+#include <optional>   // std::optional
+#include <string>     // std::string
+#include <thread>     // std::this_thread::sleep_for
+#include <vector>     // std::vector
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "slidr/constants/constantslib.hpp" // constants::EMPTY, constants::EIGHT_PUZZLE_NUM
+
+#include "creator/importerlib.hpp"
+
+namespace
+{
+/// @brief A layout of the 8 puzzle
+using Layout = std::array<int, constants::EIGHT_PUZZLE_NUM>;
+
+// The layout one move away from the goal
+constexpr Layout oneMove{1, 2, 3, 4, 5, 6, 7, constants::EMPTY, 8};
+
+/// @brief Parses a line into a fresh layout
+/// @param line The line
+/// @return The layout, nullopt if the line is refused
+std::optional<Layout> Parse(const std::string &line)
+{
+    Layout layout{};
+    if (!creator::ParseLine(line, layout))
+    {
+        return std::nullopt;
+    }
+
+    return layout;
+}
+} // namespace
+
+TEST_CASE("A line with one number per piece is parsed", "[importer]")
+{
+    CHECK(Parse("1 2 3 4 5 6 7 0 8") == oneMove);
+    CHECK(Parse("1,2,3,4,5,6,7,0,8") == oneMove);
+    CHECK(Parse("  1, 2,\t3 4 ,5 6 7 0 8\r") == oneMove);
+
+    // The numbers are taken as they are, the validation comes later
+    const Layout repeated{3, 3, 3, 3, 3, 3, 3, 3, 3};
+    CHECK(Parse("3 3 3 3 3 3 3 3 3") == repeated);
+}
+
+TEST_CASE("A line without one number per piece is refused", "[importer]")
+{
+    CHECK_FALSE(Parse(""));
+    CHECK_FALSE(Parse("   "));
+    CHECK_FALSE(Parse("1 2 3 4 5 6 7 0"));
+    CHECK_FALSE(Parse("1 2 3 4 5 6 7 0 8 9"));
+    CHECK_FALSE(Parse("1 2 3 4 x 6 7 0 8"));
+    CHECK_FALSE(Parse("1 2 3 4 5 6 7 0 8."));
+    CHECK_FALSE(Parse("1;2;3;4;5;6;7;0;8"));
+    CHECK_FALSE(Parse("# 1 2 3 4 5 6 7 0 8"));
+}
+
+TEST_CASE("An importer counts and queues the layouts of a text file", "[importer]")
+{
+    const std::filesystem::path path =
+        std::filesystem::temp_directory_path() / "importertestlib.txt";
+    {
+        std::ofstream out(path);
+        out << "# one puzzle, then everything that is turned away\n"
+            << "\n"
+            << "1 2 3 4 5 6 7 0 8\n"
+            << "1,2,3,4,5,6,7,0,8\n"
+            << "2 1 3 4 5 6 7 0 8\n"
+            << "1 2 3 4 5 6 7 8 0\n"
+            << "1 2 3 4 5 6 7 8\n";
+    }
+
+    creator::PuzzleImporter importer{path.string()};
+    for (int i = 0; (i < 500) && !importer.IsFinished(); i++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    REQUIRE(importer.IsFinished());
+
+    const creator::ImportStats stats = importer.GetStats();
+    CHECK(stats.read == 5);
+    CHECK(stats.invalid == 2);
+    CHECK(stats.unsolvable == 1);
+    CHECK(stats.duplicates == 1);
+    CHECK(stats.queued == 1);
+
+    const std::optional<creator::Puzzle> puzzle = importer.TryPop();
+    REQUIRE(puzzle);
+    CHECK(puzzle->layout == std::vector<int>(oneMove.begin(), oneMove.end()));
+    CHECK(puzzle->dirs.size() == 1);
+    CHECK_FALSE(importer.TryPop());
+
+    std::filesystem::remove(path);
+}
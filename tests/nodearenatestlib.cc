@@ -0,0 +1,228 @@
+#include <cstdint> // UINT16_MAX
+#include <utility> // std::swap
+#include <vector>  // std::vector
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "slidr/constants/constantslib.hpp" // constants::EMPTY, constants::EIGHT_PUZZLE_SIZE
+
+#include "search/nodearenalib.hpp"
+#include "search/packedstatelib.hpp" // search::Pack, search::moves, search::GetTarget
+#include "utils/randomlib.hpp"       // Xoshiro256
+
+namespace
+{
+// The empty piece in the middle, so every move stays on the board
+const std::vector<int> centre{1, 2, 3, 4, constants::EMPTY, 5, 6, 7, 8};
+
+// The empty piece in the bottom right corner
+const std::vector<int> corner{1, 2, 3, 4, 5, 6, 7, 8, constants::EMPTY};
+
+/// @brief Makes random moves that stay on the board
+/// @param arena The arena
+/// @param from The node to start from
+/// @param numOfMoves The number of moves
+/// @param rng The generator
+/// @return The nodes that were visited, the start excluded
+std::vector<search::NodeIndex> Walk(search::NodeArena &arena, search::NodeIndex from,
+                                    int numOfMoves, Xoshiro256 &rng)
+{
+    std::vector<search::NodeIndex> path;
+    search::NodeIndex node = from;
+    while (static_cast<int>(path.size()) < numOfMoves)
+    {
+        const search::Move &move = search::moves[static_cast<size_t>(rng.NextInt(0, 3))];
+        if (const search::NodeIndex child = arena.AddChild(node, move.dir);
+            child != search::noNode)
+        {
+            path.push_back(child);
+            node = child;
+        }
+    }
+
+    return path;
+}
+} // namespace
+
+TEST_CASE("A root holds its layout", "[nodearena]")
+{
+    search::NodeArena arena{16};
+    const search::NodeIndex root = arena.AddRoot(centre);
+
+    const search::ArenaNode &node = arena[root];
+    CHECK(node.state == search::Pack(centre));
+    CHECK(node.parent == search::noNode);
+    CHECK(node.firstChild == search::noNode);
+    CHECK(node.depth == 0);
+    CHECK(node.posX == 4);
+    CHECK(node.dir == -1);
+
+    const search::Layout layout = arena.GetLayout(root);
+    CHECK(std::vector<int>(layout.begin(), layout.end()) == centre);
+}
+
+TEST_CASE("A child is the layout after the move", "[nodearena]")
+{
+    constexpr int N = constants::EIGHT_PUZZLE_SIZE;
+
+    search::NodeArena arena{16};
+    const search::NodeIndex root = arena.AddRoot(centre);
+
+    for (const search::Move &move : search::moves)
+    {
+        const int target = search::GetTarget(4, move, N);
+        REQUIRE(target >= 0);
+
+        std::vector<int> expected = centre;
+        std::swap(expected[4], expected[static_cast<size_t>(target)]);
+
+        const search::NodeIndex child = arena.AddChild(root, move.dir);
+        REQUIRE(child != search::noNode);
+
+        const search::ArenaNode &node = arena[child];
+        CHECK(node.parent == root);
+        CHECK(node.depth == 1);
+        CHECK(node.posX == target);
+        CHECK(node.dir == move.dir);
+
+        const search::Layout layout = arena.GetLayout(child);
+        CHECK(std::vector<int>(layout.begin(), layout.end()) == expected);
+    }
+}
+
+TEST_CASE("A move made before leads back to the same child", "[nodearena]")
+{
+    search::NodeArena arena{16};
+    const search::NodeIndex root = arena.AddRoot(centre);
+
+    const search::NodeIndex up = arena.AddChild(root, constants::UP);
+    const search::NodeIndex left = arena.AddChild(root, constants::LEFT);
+    CHECK(arena.GetRedo(root) == left);
+    CHECK(arena.GetSize() == 3);
+
+    // Going back to the first alternative adds nothing and makes it the redo
+    CHECK(arena.AddChild(root, constants::UP) == up);
+    CHECK(arena.GetSize() == 3);
+    CHECK(arena.GetRedo(root) == up);
+
+    // The children stay linked from the one visited last
+    const search::NodeIndex down = arena.AddChild(root, constants::DOWN);
+    CHECK(arena.AddChild(root, constants::LEFT) == left);
+
+    std::vector<search::NodeIndex> siblings;
+    for (search::NodeIndex child = arena.GetRedo(root); child != search::noNode;
+         child = arena[child].nextSibling)
+    {
+        siblings.push_back(child);
+    }
+    CHECK(siblings == std::vector<search::NodeIndex>{left, down, up});
+}
+
+TEST_CASE("A move off the board adds nothing", "[nodearena]")
+{
+    search::NodeArena arena{16};
+    const search::NodeIndex root = arena.AddRoot(corner);
+
+    CHECK(arena.AddChild(root, constants::DOWN) == search::noNode);
+    CHECK(arena.AddChild(root, constants::RIGHT) == search::noNode);
+    CHECK(arena.GetSize() == 1);
+    CHECK(arena.GetRedo(root) == search::noNode);
+}
+
+TEST_CASE("A reset drops the nodes but keeps the memory", "[nodearena]")
+{
+    search::NodeArena arena{4};
+    search::NodeIndex node = arena.AddRoot(centre);
+    for (int i = 0; i < 100; i++)
+    {
+        // Up and down in turn, so every move stays on the board
+        node = arena.AddChild(node, (i % 2 == 0) ? constants::UP : constants::DOWN);
+        REQUIRE(node != search::noNode);
+    }
+    CHECK(arena[node].depth == 100);
+    CHECK(arena.GetSize() == 101);
+
+    const size_t footprint = arena.GetMemoryFootprint();
+    arena.Reset();
+    CHECK(arena.GetSize() == 0);
+    CHECK(arena.GetMemoryFootprint() == footprint);
+
+    CHECK(arena.AddRoot(corner) == 0);
+}
+
+TEST_CASE("Undo and redo walk the same path without adding nodes", "[nodearena]")
+{
+    search::NodeArena arena{16};
+    const search::NodeIndex root = arena.AddRoot(centre);
+
+    Xoshiro256 rng{49};
+    const std::vector<search::NodeIndex> path = Walk(arena, root, 200, rng);
+    const size_t size = arena.GetSize();
+
+    // Undo follows the parents back to the root
+    search::NodeIndex node = path.back();
+    for (size_t i = path.size(); i-- > 0;)
+    {
+        REQUIRE(node == path[i]);
+        REQUIRE(arena[node].depth == i + 1);
+        node = arena[node].parent;
+    }
+    REQUIRE(node == root);
+
+    // Redo follows the children that were visited last back to the end
+    for (const search::NodeIndex expected : path)
+    {
+        node = arena.GetRedo(node);
+        REQUIRE(node == expected);
+    }
+    CHECK(arena.GetRedo(node) == search::noNode);
+    CHECK(arena.GetSize() == size);
+}
+
+TEST_CASE("A new branch keeps the old one", "[nodearena]")
+{
+    search::NodeArena arena{16};
+    const search::NodeIndex root = arena.AddRoot(centre);
+
+    Xoshiro256 rng{7};
+    const std::vector<search::NodeIndex> first = Walk(arena, root, 20, rng);
+    std::vector<search::Layout> layouts;
+    for (const search::NodeIndex node : first)
+    {
+        layouts.push_back(arena.GetLayout(node));
+    }
+
+    // Go back halfway and wander off somewhere else
+    const search::NodeIndex fork = first[9];
+    const std::vector<search::NodeIndex> second = Walk(arena, fork, 30, rng);
+    REQUIRE(arena[second.front()].parent == fork);
+    CHECK(arena.GetRedo(fork) == second.front());
+
+    // Every node of the old branch can still be jumped to and holds the same layout
+    for (size_t i = 0; i < first.size(); i++)
+    {
+        CHECK(arena.GetLayout(first[i]) == layouts[i]);
+        CHECK(arena[first[i]].depth == i + 1);
+    }
+
+    // Unless the new branch took the same move, the old child is its sibling
+    if (second.front() != first[10])
+    {
+        CHECK(arena[second.front()].nextSibling == first[10]);
+    }
+}
+
+TEST_CASE("A node at the deepest depth has no children", "[nodearena]")
+{
+    search::NodeArena arena{UINT16_MAX + 1};
+    search::NodeIndex node = arena.AddRoot(centre);
+    for (int i = 0; i < UINT16_MAX; i++)
+    {
+        node = arena.AddChild(node, (i % 2 == 0) ? constants::UP : constants::DOWN);
+        REQUIRE(node != search::noNode);
+    }
+
+    CHECK(arena[node].depth == UINT16_MAX);
+    CHECK(arena.AddChild(node, constants::UP) == search::noNode);
+    CHECK(arena.AddChild(node, constants::DOWN) == search::noNode);
+}
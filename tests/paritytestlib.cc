@@ -0,0 +1,130 @@
+#include <cstdint> // std::uint64_t
+#include <numeric> // std::iota
+#include <span>    // std::span
+#include <utility> // std::swap
+#include <vector>  // std::vector
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "creator/paritylib.hpp"
+#include "utils/randomlib.hpp" // Xoshiro256
+
+namespace
+{
+// The value of the empty piece, which fits every side unlike a piece number
+constexpr int empty = 0;
+
+// The number of random layouts checked for each side
+constexpr int numOfLayouts = 500;
+
+/// @brief Makes a random layout
+/// @param rng The generator
+/// @param side The number of pieces in each row and column
+/// @return The layout, pieces 1 to side² - 1 and the empty one
+std::vector<int> MakeLayout(Xoshiro256 &rng, size_t side)
+{
+    std::vector<int> layout(side * side);
+    std::iota(layout.begin(), layout.end(), 1);
+    layout.back() = empty;
+    rng.Shuffle(std::span(layout));
+
+    return layout;
+}
+
+/// @brief Checks the solvability by the textbook rule
+///
+/// Count the inversions of the pieces read row by row, the empty one left
+/// out. On a board with an odd side a layout is solvable when they are even;
+/// on an even side each vertical move also changes them by an odd number, so
+/// the rows between the empty piece and the bottom count as well.
+/// @param layout The layout
+/// @param side The number of pieces in each row and column
+/// @return TRUE if the layout can reach the goal
+bool IsSolvableByInversions(std::span<const int> layout, size_t side)
+{
+    size_t inversions = 0;
+    size_t rowOfEmpty = 0;
+    for (size_t i = 0; i < layout.size(); i++)
+    {
+        if (layout[i] == empty)
+        {
+            rowOfEmpty = i / side;
+            continue;
+        }
+
+        for (size_t j = i + 1; j < layout.size(); j++)
+        {
+            if ((layout[j] != empty) && (layout[i] > layout[j]))
+            {
+                inversions++;
+            }
+        }
+    }
+
+    if (side % 2 == 1)
+    {
+        return (inversions % 2) == 0;
+    }
+
+    return ((inversions + (side - 1 - rowOfEmpty)) % 2) == 0;
+}
+} // namespace
+
+TEST_CASE("The parity agrees with the inversion rule", "[parity]")
+{
+    const size_t side = GENERATE(2U, 3U, 4U, 5U, 6U);
+
+    Xoshiro256 rng{static_cast<std::uint64_t>(side)};
+    size_t numOfSolvable = 0;
+    for (int i = 0; i < numOfLayouts; i++)
+    {
+        const std::vector<int> layout = MakeLayout(rng, side);
+        REQUIRE(creator::IsValidLayout(layout, empty));
+
+        const bool isSolvable = IsSolvableByInversions(layout, side);
+        REQUIRE(creator::IsSolvable(layout, empty) == isSolvable);
+        if (isSolvable)
+        {
+            numOfSolvable++;
+        }
+    }
+
+    // Half of the layouts are solvable, so both answers were checked
+    CHECK(numOfSolvable > 0);
+    CHECK(numOfSolvable < numOfLayouts);
+}
+
+TEST_CASE("The tracker follows the swaps", "[parity]")
+{
+    const size_t side = GENERATE(2U, 3U, 4U, 5U, 6U);
+
+    Xoshiro256 rng{static_cast<std::uint64_t>(side) + 100};
+    std::vector<int> layout = MakeLayout(rng, side);
+    creator::ParityTracker tracker(layout, empty);
+
+    const int last = static_cast<int>(layout.size()) - 1;
+    for (int i = 0; i < numOfLayouts; i++)
+    {
+        const size_t posA = static_cast<size_t>(rng.NextInt(0, last));
+        const size_t posB = static_cast<size_t>(rng.NextInt(0, last));
+        std::swap(layout[posA], layout[posB]);
+        tracker.Swap(posA, posB);
+
+        REQUIRE(layout[tracker.GetPosX()] == empty);
+        REQUIRE(tracker.IsOdd() == creator::IsOddPermutation(layout, empty));
+        REQUIRE(tracker.IsSolvable() == IsSolvableByInversions(layout, side));
+    }
+}
+
+TEST_CASE("A layout that is not square is not solvable", "[parity]")
+{
+    const std::vector<int> none{};
+    const std::vector<int> line{1, 2, empty};
+    const std::vector<int> noEmpty{1, 2, 3, 4};
+
+    CHECK_FALSE(creator::IsSolvable(none, empty));
+    CHECK_FALSE(creator::IsSolvable(line, empty));
+    CHECK_FALSE(creator::ParityTracker(line, empty).IsSolvable());
+    CHECK_FALSE(creator::ParityTracker(noEmpty, empty).IsSolvable());
+}
@@ -0,0 +1,163 @@
+#include <algorithm>  // std::shuffle
+#include <cstdint>    // std::int64_t, std::uint8_t
+#include <filesystem> // std::filesystem::temp_directory_path, std::filesystem::remove
+#include <numeric>    // std::iota
+#include <random>     // std::mt19937, std::uniform_int_distribution
+#include <string>     // std::string
+#include <vector>     // std::vector
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "slidr/constants/constantslib.hpp" // constants::EMPTY, constants::EIGHT_PUZZLE_NUM
+
+#include "creator/puzzlepacklib.hpp"
+#include "search/packedstatelib.hpp" // search::moves, search::GetPiece
+
+namespace
+{
+// The number of pieces of a puzzle
+constexpr int numOfPieces = constants::EIGHT_PUZZLE_NUM;
+
+// The number of random puzzles that are packed
+constexpr int numOfPuzzles = 500;
+
+/// @brief Makes a random layout (not necessarily solvable, packing does not care)
+/// @param rng The generator
+/// @return The layout
+std::vector<int> MakeLayout(std::mt19937 &rng)
+{
+    std::vector<int> layout(numOfPieces);
+    std::iota(layout.begin(), layout.end(), 1);
+    layout.back() = constants::EMPTY;
+    std::shuffle(layout.begin(), layout.end(), rng);
+
+    return layout;
+}
+
+/// @brief Makes a random sequence of directions
+/// @param rng The generator
+/// @param length The number of directions
+/// @return The directions
+std::vector<short> MakeDirs(std::mt19937 &rng, size_t length)
+{
+    std::uniform_int_distribution<size_t> moveDist{0, search::moves.size() - 1};
+
+    std::vector<short> dirs(length);
+    for (short &dir : dirs)
+    {
+        dir = search::moves[moveDist(rng)].dir;
+    }
+
+    return dirs;
+}
+
+/// @brief Gets a path for a pack that does not exist yet
+/// @param name The name of the file
+/// @return The path
+std::string GetFreshPath(const char *name)
+{
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove(path);
+
+    return path.string();
+}
+} // namespace
+
+TEST_CASE("A puzzle survives packing and unpacking", "[puzzlepack]")
+{
+    std::mt19937 rng{7};
+    std::uniform_int_distribution<size_t> lengthDist{0, creator::maxPackedMoves};
+
+    for (int i = 0; i < numOfPuzzles; i++)
+    {
+        const std::vector<int> layout = MakeLayout(rng);
+        const std::vector<short> dirs = MakeDirs(rng, lengthDist(rng));
+
+        const creator::PackedPuzzle packed = creator::PackPuzzle(layout, dirs);
+        REQUIRE(creator::IsValidPuzzle(packed));
+        REQUIRE(layout[packed.posX] == constants::EMPTY);
+
+        const creator::Puzzle puzzle = creator::UnpackPuzzle(packed);
+        REQUIRE(puzzle.layout == layout);
+        REQUIRE(puzzle.dirs == dirs);
+    }
+}
+
+TEST_CASE("A record that does not fit is not valid", "[puzzlepack]")
+{
+    std::mt19937 rng{11};
+    const std::vector<int> layout = MakeLayout(rng);
+    const creator::PackedPuzzle valid = creator::PackPuzzle(layout, MakeDirs(rng, 20));
+
+    creator::PackedPuzzle tooLong = valid;
+    tooLong.optimalMoves = creator::maxPackedMoves + 1;
+    CHECK_FALSE(creator::IsValidPuzzle(tooLong));
+
+    // Unpacking stops at the moves that fit into the solution
+    CHECK(creator::UnpackPuzzle(tooLong).dirs.size() == creator::maxPackedMoves);
+
+    creator::PackedPuzzle wrongEmpty = valid;
+    wrongEmpty.posX = static_cast<std::uint8_t>((valid.posX + 1) % numOfPieces);
+    CHECK_FALSE(creator::IsValidPuzzle(wrongEmpty));
+
+    creator::PackedPuzzle outside = valid;
+    outside.posX = numOfPieces;
+    CHECK_FALSE(creator::IsValidPuzzle(outside));
+
+    // Two copies of the same piece
+    creator::PackedPuzzle duplicate = valid;
+    const int other = (valid.posX == 0) ? 1 : 0;
+    const int piece = search::GetPiece(valid.startState, other);
+    const int next = (other + 1 == valid.posX) ? other + 2 : other + 1;
+    duplicate.startState &= ~(search::PackedState{0xF} << (4 * next));
+    duplicate.startState |= search::PackedState(static_cast<unsigned>(piece)) << (4 * next);
+    CHECK_FALSE(creator::IsValidPuzzle(duplicate));
+}
+
+TEST_CASE("A pack file serves the puzzles it was written with", "[puzzlepack]")
+{
+    const std::string path = GetFreshPath("puzzlepacktestlib.pack");
+    constexpr std::int64_t firstDay = 20000;
+
+    std::mt19937 rng{3};
+    std::vector<creator::PackedPuzzle> packed;
+    std::vector<creator::Puzzle> expected;
+    for (size_t length = 1; length <= 25; length++)
+    {
+        const std::vector<int> layout = MakeLayout(rng);
+        const std::vector<short> dirs = MakeDirs(rng, length);
+        packed.push_back(creator::PackPuzzle(layout, dirs));
+        expected.push_back({layout, dirs});
+    }
+    REQUIRE(creator::WritePack(path, packed, firstDay));
+
+    {
+        const creator::PuzzlePack pack{path};
+        REQUIRE(pack.IsLoaded());
+        REQUIRE(pack.GetSize() == packed.size());
+
+        for (size_t i = 0; i < pack.GetSize(); i++)
+        {
+            const creator::Puzzle puzzle = pack.Get(i);
+            CHECK(puzzle.layout == expected[i].layout);
+            CHECK(puzzle.dirs == expected[i].dirs);
+        }
+
+        // The days wrap around the pack in both directions
+        const std::int64_t size = static_cast<std::int64_t>(pack.GetSize());
+        CHECK(pack.GetDailyIndex(firstDay) == 0);
+        CHECK(pack.GetDailyIndex(firstDay + 3) == 3);
+        CHECK(pack.GetDailyIndex(firstDay + size) == 0);
+        CHECK(pack.GetDailyIndex(firstDay - 1) == pack.GetSize() - 1);
+    }
+
+    // A pack with a bad record is refused as a whole, even with a matching checksum
+    packed[5].optimalMoves = creator::maxPackedMoves + 1;
+    REQUIRE(creator::WritePack(path, packed, firstDay));
+    {
+        const creator::PuzzlePack pack{path};
+        CHECK_FALSE(pack.IsLoaded());
+    }
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,106 @@
+#include <array>         // std::array
+#include <cstdint>       // std::uint64_t
+#include <optional>      // std::optional
+#include <unordered_set> // std::unordered_set
+#include <vector>        // std::vector
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "utils/randomlib.hpp"
+
+namespace
+{
+// Every subsystem that draws random numbers
+constexpr std::array<RandomStream, 4> streams{RandomStream::CREATOR, RandomStream::ARENA,
+                                              RandomStream::CELEBRATION, RandomStream::BENCHMARK};
+
+// The number of values drawn from each generator
+constexpr size_t numOfDraws = 10000;
+
+/// @brief Draws the first values of a generator
+/// @param rng The generator
+/// @return The values
+std::vector<std::uint64_t> Draw(Xoshiro256 rng)
+{
+    std::vector<std::uint64_t> values(numOfDraws);
+    for (std::uint64_t &value : values)
+    {
+        value = rng();
+    }
+
+    return values;
+}
+} // namespace
+
+TEST_CASE("The same seed gives the same numbers", "[random]")
+{
+    CHECK(Draw(Xoshiro256{42}) == Draw(Xoshiro256{42}));
+    CHECK(Draw(Xoshiro256{42}) != Draw(Xoshiro256{43}));
+
+    // Every stream of a run is replayed by the master seed alone
+    const RandomService first{0x5EED};
+    const RandomService second{0x5EED};
+    CHECK(second.GetMasterSeed() == 0x5EED);
+    for (const RandomStream stream : streams)
+    {
+        CHECK(Draw(first.MakeStream(stream)) == Draw(second.MakeStream(stream)));
+        CHECK(Draw(first.MakeStream(stream, 7)) == Draw(second.MakeStream(stream, 7)));
+    }
+
+    // The typed draws follow the bits
+    Xoshiro256 a{7};
+    Xoshiro256 b{7};
+    for (size_t i = 0; i < 100; i++)
+    {
+        REQUIRE(a.NextInt(-5, 5) == b.NextInt(-5, 5));
+        REQUIRE(a.NextFloat(0.0f, 1.0f) == b.NextFloat(0.0f, 1.0f));
+        REQUIRE(a.NextNormal(0.0f, 1.0f) == b.NextNormal(0.0f, 1.0f));
+    }
+}
+
+TEST_CASE("The streams do not repeat each other's numbers", "[random]")
+{
+    const RandomService service{GENERATE(0ULL, 1ULL, 0xFFFFFFFFFFFFFFFFULL)};
+
+    // A stream that is a shifted copy of another would share its values
+    std::unordered_set<std::uint64_t> seen;
+    size_t numOfValues = 0;
+    for (const RandomStream stream : streams)
+    {
+        for (std::uint64_t index = 0; index < 4; index++)
+        {
+            for (const std::uint64_t value : Draw(service.MakeStream(stream, index)))
+            {
+                seen.insert(value);
+                numOfValues++;
+            }
+        }
+    }
+
+    CHECK(seen.size() == numOfValues);
+}
+
+TEST_CASE("A seed is a decimal number that fits into 64 bits", "[random]")
+{
+    CHECK(ParseSeed("0") == 0);
+    CHECK(ParseSeed("42") == 42);
+    CHECK(ParseSeed("0042") == 42);
+    CHECK(ParseSeed("18446744073709551615") == 0xFFFFFFFFFFFFFFFFULL);
+}
+
+TEST_CASE("A seed that is not a number is refused", "[random]")
+{
+    CHECK_FALSE(ParseSeed(""));
+    CHECK_FALSE(ParseSeed("abc"));
+    CHECK_FALSE(ParseSeed("12abc"));
+    CHECK_FALSE(ParseSeed("1.5"));
+    CHECK_FALSE(ParseSeed(" 12"));
+    CHECK_FALSE(ParseSeed("12 "));
+    CHECK_FALSE(ParseSeed("+12"));
+    CHECK_FALSE(ParseSeed("-1"));
+    CHECK_FALSE(ParseSeed("0x10"));
+
+    // One past the largest seed
+    CHECK_FALSE(ParseSeed("18446744073709551616"));
+}
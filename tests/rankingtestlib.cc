@@ -0,0 +1,131 @@
+#include <algorithm> // std::next_permutation
+#include <array>     // std::array
+#include <bit>       // std::countr_zero
+#include <cstdint>   // std::uint8_t, std::uint32_t
+#include <vector>    // std::vector
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "search/rankinglib.hpp"
+
+namespace
+{
+/// @brief Counts the inversions of a permutation pair by pair
+/// @param perm The permutation
+/// @return The number of inversions
+template <size_t N> std::uint32_t CountInversions(const std::array<std::uint8_t, N> &perm)
+{
+    std::uint32_t inversions = 0;
+    for (size_t i = 0; i < N; i++)
+    {
+        for (size_t j = i + 1; j < N; j++)
+        {
+            if (perm[i] > perm[j])
+            {
+                inversions++;
+            }
+        }
+    }
+
+    return inversions;
+}
+} // namespace
+
+TEST_CASE("The select finds every set bit of a mask", "[ranking]")
+{
+    // Every 12 bit mask, since the factorials stop at 12!
+    for (std::uint32_t mask = 1; mask < (1U << 12); mask++)
+    {
+        std::uint32_t rest = mask;
+        for (std::uint32_t k = 0; rest != 0; k++)
+        {
+            REQUIRE(search::SelectBit(mask, k) == std::countr_zero(rest));
+            rest &= rest - 1;
+        }
+    }
+
+    CHECK(search::SelectBit(0x80000000U, 0) == 31);
+    CHECK(search::SelectBit(0xFFFFFFFFU, 31) == 31);
+}
+
+TEST_CASE("Every rank of a small permutation round trips", "[ranking]")
+{
+    // Unranking walks the permutations in lexicographic order
+    std::array<std::uint8_t, 4> expected{0, 1, 2, 3};
+    for (std::uint32_t rank = 0; rank < search::factorials[4]; rank++)
+    {
+        const std::array<std::uint8_t, 4> perm = search::Unrank<4>(rank);
+        REQUIRE(perm == expected);
+        REQUIRE(search::Rank(perm) == rank);
+
+        std::next_permutation(expected.begin(), expected.end());
+    }
+}
+
+TEST_CASE("Every 8 puzzle layout round trips through its rank", "[ranking]")
+{
+    constexpr std::uint32_t numOfRanks = search::factorials[search::Digits{}.size()];
+
+    std::vector<bool> seen(search::numOfHalfRanks, false);
+    std::uint32_t numOfSolvable = 0;
+    for (std::uint32_t rank = 0; rank < numOfRanks; rank++)
+    {
+        const search::Digits digits = search::Unrank<search::Digits{}.size()>(rank);
+        REQUIRE(search::Rank(digits) == rank);
+
+        // The fast parity agrees with counting the inversions pair by pair
+        search::Tiles tiles{};
+        size_t j = 0;
+        for (const std::uint8_t digit : digits)
+        {
+            if (digit != 0)
+            {
+                tiles[j++] = static_cast<std::uint8_t>(digit - 1);
+            }
+        }
+        const bool isSolvable = (CountInversions(tiles) % 2) == 0;
+        REQUIRE(search::IsSolvable(digits) == isSolvable);
+        if (!isSolvable)
+        {
+            continue;
+        }
+
+        // The half ranks number the solvable layouts without gaps or repeats
+        const std::uint32_t halfRank = search::HalfRank(digits);
+        REQUIRE(halfRank < search::numOfHalfRanks);
+        REQUIRE_FALSE(seen[halfRank]);
+        seen[halfRank] = true;
+        REQUIRE(search::HalfUnrank(halfRank) == digits);
+        numOfSolvable++;
+    }
+
+    CHECK(numOfSolvable == search::numOfHalfRanks);
+}
+
+TEST_CASE("The batches rank like the single calls", "[ranking]")
+{
+    std::vector<search::PackedState> states;
+    for (std::uint32_t rank = 0; rank < search::numOfHalfRanks; rank += 997)
+    {
+        // The digits are packed as they are since the empty piece is already 0
+        const search::Digits digits = search::HalfUnrank(rank);
+        search::PackedState state = 0;
+        for (size_t i = 0; i < digits.size(); i++)
+        {
+            state |= static_cast<search::PackedState>(digits[i]) << (4 * i);
+        }
+        states.push_back(state);
+    }
+
+    std::vector<std::uint32_t> ranks(states.size());
+    search::RankBatch(states, ranks);
+    std::vector<std::uint32_t> halfRanks(states.size());
+    search::HalfRankBatch(states, halfRanks);
+
+    for (size_t i = 0; i < states.size(); i++)
+    {
+        const search::Digits digits = search::ToDigits(states[i]);
+        CHECK(ranks[i] == search::Rank(digits));
+        CHECK(halfRanks[i] == static_cast<std::uint32_t>(i) * 997);
+    }
+}
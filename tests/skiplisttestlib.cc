@@ -0,0 +1,60 @@
+#include <algorithm> // std::lower_bound, std::upper_bound
+#include <cstdint>   // std::uint64_t, UINT64_MAX
+#include <iterator>  // std::distance
+#include <random>    // std::mt19937_64, std::uniform_int_distribution
+#include <vector>    // std::vector
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "stats/skiplistlib.hpp"
+
+namespace
+{
+// The number of keys inserted by each round of the fuzz test
+constexpr int numOfInserts = 3000;
+} // namespace
+
+TEST_CASE("An empty list has no keys", "[skiplist]")
+{
+    const stats::RankedSkipList list;
+
+    CHECK(list.GetSize() == 0);
+    CHECK(list.CountLess(0) == 0);
+    CHECK(list.CountLess(UINT64_MAX) == 0);
+}
+
+TEST_CASE("The list agrees with a sorted vector", "[skiplist]")
+{
+    // A narrow range has many duplicates, a wide one hardly any
+    const std::uint64_t maxKey = GENERATE(16ULL, 1000ULL, UINT64_MAX);
+    const std::uint64_t seed = GENERATE(1ULL, 42ULL, 0xDEADBEEFULL);
+
+    std::mt19937_64 rng{seed};
+    std::uniform_int_distribution<std::uint64_t> keyDist{0, maxKey};
+
+    stats::RankedSkipList list{seed};
+    std::vector<std::uint64_t> sorted;
+
+    for (int i = 0; i < numOfInserts; i++)
+    {
+        const std::uint64_t key = keyDist(rng);
+
+        // A new key goes after the keys that are equal to it
+        const auto it = std::upper_bound(sorted.begin(), sorted.end(), key);
+        const size_t expected = static_cast<size_t>(std::distance(sorted.begin(), it));
+        sorted.insert(it, key);
+        REQUIRE(list.Insert(key) == expected);
+
+        const std::uint64_t probe = keyDist(rng);
+        const size_t less = static_cast<size_t>(std::distance(
+            sorted.begin(), std::lower_bound(sorted.begin(), sorted.end(), probe)));
+        REQUIRE(list.CountLess(probe) == less);
+    }
+
+    REQUIRE(list.GetSize() == sorted.size());
+    for (size_t rank = 0; rank < sorted.size(); rank++)
+    {
+        REQUIRE(list.GetKeyAt(rank) == sorted[rank]);
+    }
+}
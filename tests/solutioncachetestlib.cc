@@ -0,0 +1,157 @@
+#include <optional> // std::optional
+#include <thread>   // std::thread
+#include <vector>   // std::vector
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "search/solutioncachelib.hpp"
+
+namespace
+{
+/// @brief Checks if a solution of a puzzle is cached, which counts as a lookup
+/// @param cache The cache
+/// @param key The packed state of the puzzle
+/// @return TRUE if the solution is cached
+bool Contains(search::SolutionCache &cache, search::PackedState key)
+{
+    return cache.Find(key).has_value();
+}
+} // namespace
+
+TEST_CASE("A stored solution is found again", "[solutioncache]")
+{
+    search::SolutionCache cache{4};
+    CHECK_FALSE(cache.Find(1));
+
+    cache.Insert(1, {0, 1, 2});
+    const std::optional<search::Solution> solution = cache.Find(1);
+    REQUIRE(solution);
+    CHECK(solution->length == 3);
+    CHECK(solution->dirs == std::vector<short>{0, 1, 2});
+    CHECK(cache.GetSize() == 1);
+
+    // The solutions of the other puzzles stay unknown
+    CHECK_FALSE(cache.Find(2));
+
+    CHECK(cache.GetHits() == 1);
+    CHECK(cache.GetMisses() == 2);
+}
+
+TEST_CASE("A full cache evicts the least recently used solution", "[solutioncache]")
+{
+    search::SolutionCache cache{3};
+    cache.Insert(1, {0});
+    cache.Insert(2, {1});
+    cache.Insert(3, {2});
+    REQUIRE(cache.GetSize() == 3);
+
+    // The oldest insertion goes first
+    cache.Insert(4, {3});
+    CHECK(cache.GetSize() == 3);
+    CHECK_FALSE(Contains(cache, 1));
+    CHECK(Contains(cache, 2));
+    CHECK(Contains(cache, 3));
+    CHECK(Contains(cache, 4));
+
+    // The lookups above used 2, 3 and 4 in that order, so 2 goes next
+    cache.Insert(5, {0});
+    CHECK_FALSE(Contains(cache, 2));
+
+    // Then 3, then 4
+    cache.Insert(6, {1});
+    CHECK_FALSE(Contains(cache, 3));
+    CHECK(Contains(cache, 4));
+    CHECK(Contains(cache, 5));
+    CHECK(Contains(cache, 6));
+}
+
+TEST_CASE("A hit makes a solution the most recently used", "[solutioncache]")
+{
+    search::SolutionCache cache{2};
+    cache.Insert(1, {0});
+    cache.Insert(2, {1});
+
+    // Without the lookup 1 would be the one to go
+    REQUIRE(Contains(cache, 1));
+    cache.Insert(3, {2});
+    CHECK(Contains(cache, 1));
+    CHECK_FALSE(Contains(cache, 2));
+    CHECK(Contains(cache, 3));
+
+    // A miss changes nothing
+    CHECK_FALSE(Contains(cache, 2));
+    cache.Insert(4, {3});
+    CHECK_FALSE(Contains(cache, 1));
+    CHECK(Contains(cache, 3));
+}
+
+TEST_CASE("Storing a cached puzzle again updates it in place", "[solutioncache]")
+{
+    search::SolutionCache cache{2};
+    cache.Insert(1, {0, 1});
+    cache.Insert(2, {2});
+
+    // The new solution replaces the old one and refreshes the entry
+    cache.Insert(1, {3, 2, 1});
+    CHECK(cache.GetSize() == 2);
+
+    // The update made 1 the most recently used, so 2 goes
+    cache.Insert(3, {0});
+    CHECK(cache.GetSize() == 2);
+
+    const std::optional<search::Solution> solution = cache.Find(1);
+    REQUIRE(solution);
+    CHECK(solution->length == 3);
+    CHECK(solution->dirs == std::vector<short>{3, 2, 1});
+    CHECK_FALSE(Contains(cache, 2));
+
+    // Updating is no lookup
+    CHECK(cache.GetHits() == 1);
+    CHECK(cache.GetMisses() == 1);
+}
+
+TEST_CASE("A cache without capacity stores nothing", "[solutioncache]")
+{
+    search::SolutionCache cache{0};
+    cache.Insert(1, {0});
+    cache.Insert(1, {1});
+
+    CHECK(cache.GetSize() == 0);
+    CHECK_FALSE(cache.Find(1));
+    CHECK(cache.GetHits() == 0);
+    CHECK(cache.GetMisses() == 1);
+}
+
+TEST_CASE("The counters add up the lookups of every thread", "[solutioncache]")
+{
+    constexpr size_t numOfThreads = 4;
+    constexpr search::PackedState numOfStates = 1000;
+
+    search::SolutionCache cache{numOfStates};
+    for (search::PackedState state = 1; state <= numOfStates; state += 2)
+    {
+        cache.Insert(state, {0});
+    }
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < numOfThreads; i++)
+    {
+        threads.emplace_back(
+            [&cache]
+            {
+                for (search::PackedState state = 1; state <= numOfStates; state++)
+                {
+                    cache.Find(state);
+                }
+            });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    // Every odd state was stored and nothing was evicted
+    CHECK(cache.GetHits() == numOfThreads * numOfStates / 2);
+    CHECK(cache.GetMisses() == numOfThreads * numOfStates / 2);
+    CHECK(cache.GetSize() == numOfStates / 2);
+}
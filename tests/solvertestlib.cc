@@ -0,0 +1,161 @@
+#include <cstdint> // std::uint64_t
+#include <span>    // std::span
+#include <utility> // std::swap
+#include <vector>  // std::vector
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "slidr/constants/constantslib.hpp" // constants::EMPTY, constants::EIGHT_PUZZLE_SIZE
+
+#include "creator/creatorlib.hpp"        // creator::GetRandomLayout
+#include "search/bidirectionallib.hpp"   // search::BidirectionalSearch
+#include "search/distancelib.hpp"        // search::DistanceTable
+#include "search/idastarlib.hpp"         // search::IdaStar
+#include "search/packedstatelib.hpp"     // search::Pack, search::Slide, search::moves
+#include "search/parallelidastarlib.hpp" // search::ParallelIdaStar
+#include "utils/randomlib.hpp"           // Xoshiro256
+#include "utils/threadpoollib.hpp"       // ThreadPool
+
+namespace
+{
+// The number of random boards each solver is checked on
+constexpr int numOfBoards = 60;
+
+// A fixed seed so every run checks the same boards
+constexpr std::uint64_t seed = 20250301;
+
+/// @brief Gets the table every solution is checked against
+/// @return The table, built once for all the test cases
+const search::DistanceTable &GetDistanceTable()
+{
+    static const search::DistanceTable table;
+    return table;
+}
+
+/// @brief Gets the position of the empty piece
+/// @param layout The layout
+/// @return The position
+int GetPosX(std::span<const int> layout)
+{
+    int posX = 0;
+    while (layout[static_cast<size_t>(posX)] != constants::EMPTY)
+    {
+        posX++;
+    }
+
+    return posX;
+}
+
+/// @brief Checks that a solution reaches the goal
+/// @param layout The start layout
+/// @param dirs The directions of the empty piece
+/// @return TRUE if every move stays on the board and the last one ends at the goal
+bool ReachesGoal(std::span<const int> layout, std::span<const short> dirs)
+{
+    constexpr int N = constants::EIGHT_PUZZLE_SIZE;
+
+    search::PackedState state = search::Pack(layout);
+    int posX = GetPosX(layout);
+    for (const short dir : dirs)
+    {
+        int target = -1;
+        for (const search::Move &move : search::moves)
+        {
+            if (move.dir == dir)
+            {
+                target = search::GetTarget(posX, move, N);
+            }
+        }
+
+        if (target < 0)
+        {
+            return false;
+        }
+
+        state = search::Slide(state, posX, target);
+        posX = target;
+    }
+
+    const std::vector<int> goal{1, 2, 3, 4, 5, 6, 7, 8, constants::EMPTY};
+    return state == search::Pack(goal);
+}
+
+/// @brief Checks a solver on random boards against the distance table
+/// @param solve Solves a layout given the position of its empty piece
+template <typename Solve> void CheckOnRandomBoards(Solve solve)
+{
+    const search::DistanceTable &table = GetDistanceTable();
+
+    Xoshiro256 rng{seed};
+    for (int i = 0; i < numOfBoards; i++)
+    {
+        const std::vector<int> layout = creator::GetRandomLayout(rng);
+        const std::vector<short> dirs = solve(layout, GetPosX(layout));
+
+        INFO("board " << i);
+        REQUIRE(dirs.size() == table.GetDistance(layout));
+        REQUIRE(ReachesGoal(layout, dirs));
+    }
+
+    // A solved board needs no moves
+    const std::vector<int> goal{1, 2, 3, 4, 5, 6, 7, 8, constants::EMPTY};
+    CHECK(solve(goal, GetPosX(goal)).empty());
+}
+} // namespace
+
+TEST_CASE("IDA* finds optimal solutions", "[solver]")
+{
+    search::IdaStar solver;
+    CheckOnRandomBoards([&](std::span<const int> layout, int posX)
+                        { return solver.Solve(layout, posX); });
+}
+
+TEST_CASE("IDA* finds optimal solutions after some moves", "[solver]")
+{
+    const search::DistanceTable &table = GetDistanceTable();
+    constexpr int N = constants::EIGHT_PUZZLE_SIZE;
+
+    search::IdaStar solver;
+    Xoshiro256 rng{seed};
+    for (int i = 0; i < numOfBoards; i++)
+    {
+        std::vector<int> layout = creator::GetRandomLayout(rng);
+        int posX = GetPosX(layout);
+        solver.Solve(layout, posX);
+
+        // Wander off the optimal path for a few moves, then ask again
+        int movesFromStart = 0;
+        for (; movesFromStart < 3; movesFromStart++)
+        {
+            const search::Move &move = search::moves[static_cast<size_t>(rng.NextInt(0, 3))];
+            const int target = search::GetTarget(posX, move, N);
+            if (target < 0)
+            {
+                break;
+            }
+            std::swap(layout[static_cast<size_t>(posX)], layout[static_cast<size_t>(target)]);
+            posX = target;
+        }
+
+        const std::vector<short> dirs = solver.SolveFrom(layout, posX, movesFromStart);
+
+        INFO("board " << i);
+        REQUIRE(dirs.size() == table.GetDistance(layout));
+        REQUIRE(ReachesGoal(layout, dirs));
+    }
+}
+
+TEST_CASE("The bidirectional search finds optimal solutions", "[solver]")
+{
+    search::BidirectionalSearch solver;
+    CheckOnRandomBoards([&](std::span<const int> layout, int posX)
+                        { return solver.Solve(layout, posX); });
+}
+
+TEST_CASE("The parallel IDA* finds optimal solutions", "[solver]")
+{
+    ThreadPool pool{3};
+    search::ParallelIdaStar solver{pool};
+    CheckOnRandomBoards([&](std::span<const int> layout, int posX)
+                        { return solver.Solve(layout, posX); });
+}
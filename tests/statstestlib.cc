@@ -0,0 +1,123 @@
+#include <cstdint>    // std::uint16_t, std::uint32_t, std::uintmax_t
+#include <filesystem> // std::filesystem::temp_directory_path, std::filesystem::file_size, etc.
+#include <fstream>    // std::ofstream
+#include <string>     // std::string
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "stats/statslib.hpp"
+
+namespace
+{
+// The size of the magic at the start of the log
+constexpr std::uintmax_t headerSize = 8;
+
+/// @brief Makes a record of a game solved without help
+/// @param optimalMoves The number of optimal moves
+/// @param userMoves The number of moves of the user
+/// @param durationMs The time played in milliseconds
+/// @return The record
+stats::GameRecord MakeRecord(std::uint16_t optimalMoves, std::uint16_t userMoves,
+                             std::uint32_t durationMs)
+{
+    return {0x123456789ULL, 1700000000, durationMs, optimalMoves, userMoves, 0, {}};
+}
+
+/// @brief Gets a path for a log that does not exist yet
+/// @param name The name of the file
+/// @return The path
+std::string GetFreshPath(const char *name)
+{
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove(path);
+
+    return path.string();
+}
+} // namespace
+
+TEST_CASE("The log reads back the games it synced", "[stats]")
+{
+    const std::string path = GetFreshPath("statstestlib_reload.bin");
+
+    {
+        stats::StatsLog log{path};
+        log.Append(MakeRecord(10, 10, 5000));
+        log.Append(MakeRecord(20, 24, 9000));
+    }
+
+    stats::StatsLog log{path};
+    const stats::Summary &summary = log.GetSummary();
+    CHECK(log.GetNumOfPersisted() == 2);
+    CHECK(summary.numOfGames == 2);
+    CHECK(summary.numOfPerfect == 1);
+    CHECK(summary.totalUserMoves == 34);
+    CHECK(summary.totalOptimalMoves == 30);
+    CHECK(summary.bestDurationMs[10] == 5000);
+    CHECK(summary.bestDurationMs[20] == 9000);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("The log drops the torn record at its end", "[stats]")
+{
+    const std::string path = GetFreshPath("statstestlib_torn.bin");
+
+    {
+        stats::StatsLog log{path};
+        for (std::uint16_t moves = 1; moves <= 3; moves++)
+        {
+            log.Append(MakeRecord(moves, moves, 1000U * moves));
+        }
+    }
+
+    const std::uintmax_t validSize = headerSize + 3 * sizeof(stats::GameRecord);
+    REQUIRE(std::filesystem::file_size(path) == validSize);
+
+    // A crash in the middle of a write leaves part of a record behind
+    {
+        std::ofstream file{path, std::ios::binary | std::ios::app};
+        const char torn[sizeof(stats::GameRecord) / 2] = {1, 2, 3};
+        file.write(torn, sizeof(torn));
+    }
+
+    {
+        stats::StatsLog log{path};
+        CHECK(log.GetNumOfPersisted() == 3);
+        CHECK(log.GetSummary().numOfGames == 3);
+        CHECK(std::filesystem::file_size(path) == validSize);
+
+        // The next record lands right after the last whole one
+        log.Append(MakeRecord(4, 6, 4000));
+    }
+
+    stats::StatsLog log{path};
+    CHECK(log.GetNumOfPersisted() == 4);
+    CHECK(log.GetSummary().numOfGames == 4);
+    CHECK(log.GetSummary().numOfPerfect == 3);
+    CHECK(std::filesystem::file_size(path) == validSize + sizeof(stats::GameRecord));
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("The log refuses a file that is not a log", "[stats]")
+{
+    const std::string path = GetFreshPath("statstestlib_foreign.bin");
+    {
+        std::ofstream file{path, std::ios::binary};
+        file << "not a stats log at all";
+    }
+    const std::uintmax_t size = std::filesystem::file_size(path);
+
+    {
+        stats::StatsLog log{path};
+        CHECK(log.GetNumOfPersisted() == 0);
+
+        // The summary still works without persistence
+        log.Append(MakeRecord(5, 5, 2000));
+        CHECK(log.GetSummary().numOfGames == 1);
+    }
+
+    CHECK(std::filesystem::file_size(path) == size);
+
+    std::filesystem::remove(path);
+}
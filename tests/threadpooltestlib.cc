@@ -0,0 +1,195 @@
+#include <algorithm> // std::min
+#include <atomic>    // std::atomic
+#include <chrono>    // std::chrono::seconds
+#include <future>    // std::future, std::promise, std::shared_future
+#include <mutex>     // std::mutex, std::lock_guard
+#include <set>       // std::set
+#include <thread>    // std::thread::id, std::this_thread::get_id
+#include <utility>   // std::pair
+#include <vector>    // std::vector
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "utils/threadpoollib.hpp"
+
+namespace
+{
+/// @brief The chunks a job was called with and the threads that ran them
+struct Chunks
+{
+    /// @brief Guards the members below
+    std::mutex mutex;
+
+    /// @brief The [begin, end) of every call
+    std::vector<std::pair<size_t, size_t>> ranges;
+
+    /// @brief The threads that ran a chunk
+    std::set<std::thread::id> threads;
+
+    /// @brief Makes a job that records its chunks
+    /// @return The job
+    ThreadPool::Job Record()
+    {
+        return [this](size_t begin, size_t end)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ranges.emplace_back(begin, end);
+            threads.insert(std::this_thread::get_id());
+        };
+    }
+};
+} // namespace
+
+TEST_CASE("A loop visits every index once in chunks of the grain", "[threadpool]")
+{
+    const unsigned numOfWorkers = GENERATE(0U, 1U, 3U);
+    const size_t count = GENERATE(size_t{1}, size_t{7}, size_t{64}, size_t{1000});
+    const size_t grain = GENERATE(size_t{1}, size_t{3}, size_t{16});
+
+    ThreadPool pool{numOfWorkers};
+    REQUIRE(pool.GetNumOfThreads() == numOfWorkers + 1);
+
+    std::vector<std::atomic<int>> visits(count);
+    pool.ParallelFor(count, grain,
+                     [&visits](size_t begin, size_t end)
+                     {
+                         for (size_t i = begin; i < end; i++)
+                         {
+                             visits[i].fetch_add(1, std::memory_order_relaxed);
+                         }
+                     });
+
+    for (const std::atomic<int> &visit : visits)
+    {
+        REQUIRE(visit.load() == 1);
+    }
+}
+
+TEST_CASE("The chunks start on a multiple of the grain", "[threadpool]")
+{
+    ThreadPool pool{3};
+    Chunks chunks;
+    pool.ParallelFor(100, 8, chunks.Record());
+
+    // The last chunk holds what is left
+    REQUIRE(chunks.ranges.size() == 13);
+    for (const auto &[begin, end] : chunks.ranges)
+    {
+        CHECK(begin % 8 == 0);
+        CHECK(end == std::min<size_t>(begin + 8, 100));
+    }
+}
+
+TEST_CASE("A small loop runs on the caller as one chunk", "[threadpool]")
+{
+    ThreadPool pool{3};
+
+    // Not more indices than the grain, or a grain of zero on a single index
+    const auto [count, grain] = GENERATE(std::pair<size_t, size_t>{0, 1},
+                                         std::pair<size_t, size_t>{5, 8},
+                                         std::pair<size_t, size_t>{8, 8},
+                                         std::pair<size_t, size_t>{1, 0});
+    Chunks chunks;
+    pool.ParallelFor(count, grain, chunks.Record());
+
+    CHECK(chunks.ranges == std::vector<std::pair<size_t, size_t>>{{0, count}});
+    CHECK(chunks.threads == std::set<std::thread::id>{std::this_thread::get_id()});
+}
+
+TEST_CASE("A loop started while another one runs stays on the caller", "[threadpool]")
+{
+    ThreadPool pool{3};
+
+    // A background task runs a loop that holds on to the workers until released
+    std::promise<void> started;
+    std::promise<void> release;
+    const std::shared_future<void> released = release.get_future().share();
+    std::future<void> outer = pool.Submit(
+        [&pool, &started, released]
+        {
+            pool.ParallelFor(16, 1,
+                             [&started, released](size_t begin, size_t)
+                             {
+                                 if (begin == 0)
+                                 {
+                                     started.set_value();
+                                     released.wait();
+                                 }
+                             });
+        });
+    REQUIRE(started.get_future().wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+
+    // The workers belong to the other loop, so this one does not wait for them
+    Chunks chunks;
+    pool.ParallelFor(64, 1, chunks.Record());
+    CHECK(chunks.ranges == std::vector<std::pair<size_t, size_t>>{{0, 64}});
+    CHECK(chunks.threads == std::set<std::thread::id>{std::this_thread::get_id()});
+
+    release.set_value();
+    outer.get();
+
+    // Once the other loop is done the workers help again
+    std::vector<std::atomic<int>> visits(64);
+    pool.ParallelFor(64, 1, [&visits](size_t begin, size_t) { visits[begin].fetch_add(1); });
+    for (const std::atomic<int> &visit : visits)
+    {
+        CHECK(visit.load() == 1);
+    }
+}
+
+TEST_CASE("The submitted tasks run in order off the caller", "[threadpool]")
+{
+    constexpr size_t numOfTasks = 100;
+
+    ThreadPool pool{GENERATE(0U, 2U)};
+
+    // Only the background thread touches the order, the futures publish it
+    std::vector<size_t> order;
+    std::set<std::thread::id> threads;
+    std::vector<std::future<void>> futures;
+    for (size_t i = 0; i < numOfTasks; i++)
+    {
+        futures.push_back(pool.Submit(
+            [&order, &threads, i]
+            {
+                order.push_back(i);
+                threads.insert(std::this_thread::get_id());
+            }));
+    }
+
+    // The last task runs after all the others
+    futures.back().get();
+    for (size_t i = 0; i + 1 < numOfTasks; i++)
+    {
+        CHECK(futures[i].wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+    }
+
+    REQUIRE(order.size() == numOfTasks);
+    for (size_t i = 0; i < numOfTasks; i++)
+    {
+        CHECK(order[i] == i);
+    }
+
+    REQUIRE(threads.size() == 1);
+    CHECK(*threads.begin() != std::this_thread::get_id());
+}
+
+TEST_CASE("The destructor runs the tasks that are still queued", "[threadpool]")
+{
+    std::atomic<int> numOfRun{0};
+    std::vector<std::future<void>> futures;
+    {
+        ThreadPool pool{1};
+        for (int i = 0; i < 50; i++)
+        {
+            futures.push_back(pool.Submit([&numOfRun] { numOfRun.fetch_add(1); }));
+        }
+    }
+
+    CHECK(numOfRun.load() == 50);
+    for (std::future<void> &future : futures)
+    {
+        CHECK(future.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+    }
+}
@@ -0,0 +1,185 @@
+#include <cmath>   // std::abs
+#include <utility> // std::swap
+#include <vector>  // std::vector
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "slidr/constants/constantslib.hpp" // constants::EMPTY
+
+#include "gui/timelinelib.hpp"
+
+namespace
+{
+// The empty piece in the middle, so every neighbour can slide into it
+const std::vector<int> centre{1, 2, 3, 4, constants::EMPTY, 5, 6, 7, 8};
+
+// The grid of the empty piece in the middle
+constexpr int middle = 4;
+
+// The duration of one slide in seconds
+constexpr float duration = 0.1f;
+
+// A frame short enough that even a full queue plays at most a quarter of a slide
+constexpr float tick = duration / (4 * static_cast<float>(Timeline::capacity));
+
+/// @brief Checks if two values are equal up to the rounding of a few float operations
+/// @param value The value
+/// @param expected The expected value
+/// @return TRUE if they are close
+bool IsNear(float value, float expected)
+{
+    return std::abs(value - expected) < 1e-4f;
+}
+
+/// @brief Gets the layout being shown
+/// @param timeline The timeline
+/// @return The layout
+std::vector<int> GetLayout(const Timeline &timeline)
+{
+    return {timeline.GetLayout().begin(), timeline.GetLayout().end()};
+}
+
+/// @brief Slides the piece above the middle down and back up, and so on
+/// @param timeline The timeline
+/// @param numOfSlides The number of slides
+void PushUpAndDown(Timeline &timeline, size_t numOfSlides)
+{
+    for (size_t i = 0; i < numOfSlides; i++)
+    {
+        if (i % 2 == 0)
+        {
+            timeline.Push(1, middle);
+        }
+        else
+        {
+            timeline.Push(middle, 1);
+        }
+    }
+}
+} // namespace
+
+TEST_CASE("A slide plays out and leaves the piece in its target", "[timeline]")
+{
+    Timeline timeline{duration};
+    timeline.Reset(centre);
+    CHECK_FALSE(timeline.IsAnimating());
+    CHECK(timeline.GetMovingFrom() == Timeline::noSlide);
+    CHECK(timeline.GetProgress() == 1.0f);
+
+    timeline.Push(1, middle);
+    CHECK(timeline.IsAnimating());
+    CHECK(timeline.GetMovingFrom() == 1);
+    CHECK(timeline.GetMovingTo() == middle);
+    CHECK(timeline.GetProgress() == 0.0f);
+
+    // The piece is in its target already, the draw offsets it back
+    std::vector<int> expected = centre;
+    std::swap(expected[1], expected[middle]);
+    CHECK(GetLayout(timeline) == expected);
+
+    // Half way through, eased out
+    timeline.Update(duration / 2);
+    CHECK(IsNear(timeline.GetProgress(), 1.0f - 0.5f * 0.5f * 0.5f));
+
+    timeline.Update(duration / 2);
+    CHECK_FALSE(timeline.IsAnimating());
+    CHECK(timeline.GetProgress() == 1.0f);
+    CHECK(GetLayout(timeline) == expected);
+}
+
+TEST_CASE("A full queue finishes the oldest slide and starts the next one", "[timeline]")
+{
+    Timeline timeline{duration};
+    timeline.Reset(centre);
+
+    PushUpAndDown(timeline, Timeline::capacity);
+    timeline.Update(tick);
+    REQUIRE(timeline.IsAnimating());
+    REQUIRE(timeline.GetProgress() > 0.0f);
+    REQUIRE(timeline.GetMovingFrom() == 1);
+
+    // The first slide down is done and the slide back up starts from the beginning
+    timeline.Push(1, middle);
+    CHECK(timeline.GetMovingFrom() == middle);
+    CHECK(timeline.GetMovingTo() == 1);
+    CHECK(timeline.GetProgress() == 0.0f);
+    CHECK(GetLayout(timeline) == centre);
+
+    // Every slide still plays, the new one last
+    size_t numOfSlides = 0;
+    while (timeline.IsAnimating() && (numOfSlides < 2 * Timeline::capacity))
+    {
+        const int from = timeline.GetMovingFrom();
+        while (timeline.IsAnimating() && (timeline.GetMovingFrom() == from))
+        {
+            timeline.Update(tick);
+        }
+        numOfSlides++;
+    }
+    CHECK(numOfSlides == Timeline::capacity);
+
+    std::vector<int> expected = centre;
+    std::swap(expected[1], expected[middle]);
+    CHECK(GetLayout(timeline) == expected);
+}
+
+TEST_CASE("The slides play faster the more are queued", "[timeline]")
+{
+    // One slide plays at its own pace
+    Timeline single{duration};
+    single.Reset(centre);
+    PushUpAndDown(single, 1);
+    single.Update(duration / 4);
+    CHECK(single.GetMovingFrom() == 1);
+    CHECK(IsNear(single.GetProgress(), 1.0f - 0.75f * 0.75f * 0.75f));
+
+    // With four queued the same frame finishes the first one
+    Timeline queued{duration};
+    queued.Reset(centre);
+    PushUpAndDown(queued, 4);
+    queued.Update(0.3f * duration);
+    CHECK(queued.GetMovingFrom() == middle);
+
+    // The time left over carries into the next slide
+    CHECK(IsNear(queued.GetProgress(), 1.0f - 0.8f * 0.8f * 0.8f));
+}
+
+TEST_CASE("A long frame advances the slide by 50 ms at most", "[timeline]")
+{
+    Timeline timeline{1.0f};
+    timeline.Reset(centre);
+    timeline.Push(1, middle);
+
+    timeline.Update(10.0f);
+    CHECK(timeline.IsAnimating());
+    CHECK(IsNear(timeline.GetProgress(), 1.0f - 0.95f * 0.95f * 0.95f));
+
+    // It takes about twenty of them to play the second of the slide
+    for (int i = 0; i < 18; i++)
+    {
+        timeline.Update(10.0f);
+    }
+    CHECK(timeline.IsAnimating());
+
+    timeline.Update(10.0f);
+    timeline.Update(10.0f);
+    CHECK_FALSE(timeline.IsAnimating());
+}
+
+TEST_CASE("A slide without duration is done right away", "[timeline]")
+{
+    const float noDuration = GENERATE(0.0f, -1.0f);
+
+    Timeline timeline{noDuration};
+    timeline.Reset(centre);
+    timeline.Push(1, middle);
+
+    // Still queued until the next update, but shown at its target
+    CHECK(timeline.IsAnimating());
+    CHECK(timeline.GetProgress() == 1.0f);
+
+    timeline.Update(0.0f);
+    CHECK_FALSE(timeline.IsAnimating());
+    CHECK(timeline.GetProgress() == 1.0f);
+}
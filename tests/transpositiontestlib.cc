@@ -0,0 +1,114 @@
+#include <cstdint> // std::uint64_t
+#include <thread>  // std::thread
+#include <vector>  // std::vector
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "search/transpositionlib.hpp"
+
+namespace
+{
+// A budget of a single bucket, so every state competes for the same slots
+constexpr size_t oneBucket = 4 * sizeof(std::uint64_t);
+
+// A budget that is large enough for every state the tests store
+constexpr size_t manyBuckets = size_t{1} << 16;
+} // namespace
+
+TEST_CASE("A stored bound is found again", "[transposition]")
+{
+    search::TranspositionTable table{manyBuckets};
+    search::TableCounters counters{};
+
+    CHECK(table.Probe(0x123456780, counters) == 0);
+    CHECK(counters.misses == 1);
+
+    table.Store(0x123456780, 17, 5, counters);
+    CHECK(table.Probe(0x123456780, counters) == 17);
+    CHECK(counters.hits == 1);
+
+    // A looser bound never replaces a tighter one
+    table.Store(0x123456780, 12, 9, counters);
+    CHECK(table.Probe(0x123456780, counters) == 17);
+
+    table.Store(0x123456780, 21, 2, counters);
+    CHECK(table.Probe(0x123456780, counters) == 21);
+
+    // The bounds of the other states stay unknown
+    CHECK(table.Probe(0x876543210, counters) == 0);
+
+    CHECK(counters.hits == 3);
+    CHECK(counters.misses == 2);
+    CHECK(counters.collisions == 0);
+
+    table.Clear();
+    CHECK(table.Probe(0x123456780, counters) == 0);
+}
+
+TEST_CASE("A full bucket evicts the shallowest entry", "[transposition]")
+{
+    search::TranspositionTable table{oneBucket};
+    REQUIRE(table.GetCapacity() == 4);
+
+    search::TableCounters counters{};
+    for (search::PackedState state = 1; state <= 4; state++)
+    {
+        table.Store(state, 10, static_cast<int>(state), counters);
+    }
+    CHECK(counters.collisions == 0);
+
+    // The state searched the least deep makes room
+    table.Store(5, 10, 8, counters);
+    CHECK(counters.collisions == 1);
+    CHECK(table.Probe(1, counters) == 0);
+    CHECK(table.Probe(5, counters) == 10);
+
+    // The entries of an older search go first and are no collision
+    table.NewSearch();
+    table.Store(6, 10, 0, counters);
+    CHECK(counters.collisions == 1);
+    CHECK(table.Probe(6, counters) == 10);
+}
+
+TEST_CASE("Every thread counts its own probes", "[transposition]")
+{
+    constexpr size_t numOfThreads = 4;
+    constexpr search::PackedState numOfStates = 1000;
+
+    search::TranspositionTable table{manyBuckets};
+    search::TableCounters setup{};
+    for (search::PackedState state = 1; state <= numOfStates; state += 2)
+    {
+        table.Store(state, 20, 1, setup);
+    }
+    REQUIRE(setup.collisions == 0);
+
+    std::vector<search::TableCounters> counters(numOfThreads, search::TableCounters{});
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < counters.size(); i++)
+    {
+        threads.emplace_back(
+            [&table, &counters, i]
+            {
+                for (search::PackedState state = 1; state <= numOfStates; state++)
+                {
+                    table.Probe(state, counters[i]);
+                }
+            });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    // Every odd state was stored and nothing was evicted
+    search::TableCounters sum{};
+    for (const search::TableCounters &perThread : counters)
+    {
+        CHECK(perThread.hits == numOfStates / 2);
+        CHECK(perThread.misses == numOfStates / 2);
+        sum += perThread;
+    }
+    CHECK(sum.hits == numOfThreads * numOfStates / 2);
+    CHECK(sum.misses == numOfThreads * numOfStates / 2);
+}